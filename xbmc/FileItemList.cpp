@@ -28,6 +28,7 @@
 #include "utils/FileExtensionProvider.h"
 #include "utils/Random.h"
 #include "utils/RegExp.h"
+#include "utils/SortKeys.h"
 #include "utils/URIUtils.h"
 #include "utils/log.h"
 #include "video/VideoFileItemClassify.h"
@@ -326,14 +327,8 @@ void CFileItemList::Sort(SortBy sortBy,
   m_sortDescription = sorting;
 }
 
-void CFileItemList::Sort(SortDescription sortDescription)
+SortDescription CFileItemList::GetEffectiveSortDescription(SortDescription sortDescription) const
 {
-  if (sortDescription.sortBy == SortByNone ||
-      (m_sortDescription.sortBy == sortDescription.sortBy &&
-       m_sortDescription.sortOrder == sortDescription.sortOrder &&
-       m_sortDescription.sortAttributes == sortDescription.sortAttributes))
-    return;
-
   if (sortDescription.sortAttributes & SortAttributeForceConsiderFolders)
   {
     sortDescription.sortAttributes =
@@ -351,6 +346,19 @@ void CFileItemList::Sort(SortDescription sortDescription)
         static_cast<SortAttribute>(sortDescription.sortAttributes | SortAttributeIgnoreFolders);
   }
 
+  return sortDescription;
+}
+
+void CFileItemList::Sort(SortDescription sortDescription)
+{
+  if (sortDescription.sortBy == SortByNone ||
+      (m_sortDescription.sortBy == sortDescription.sortBy &&
+       m_sortDescription.sortOrder == sortDescription.sortOrder &&
+       m_sortDescription.sortAttributes == sortDescription.sortAttributes))
+    return;
+
+  sortDescription = GetEffectiveSortDescription(sortDescription);
+
   const Fields fields = SortUtils::GetFieldsForSorting(sortDescription.sortBy);
   SortItems sortItems(static_cast<size_t>(Size()));
   for (int index = 0; index < Size(); index++)
@@ -379,6 +387,51 @@ void CFileItemList::Sort(SortDescription sortDescription)
   m_items = std::move(sortedFileItems);
 }
 
+void CFileItemList::Merge(const CFileItemList& itemlist)
+{
+  std::unique_lock lock(m_lock);
+  if (m_items.empty())
+  {
+    Append(itemlist);
+    m_sortDescription = itemlist.m_sortDescription;
+    m_sortIgnoreFolders = itemlist.m_sortIgnoreFolders;
+    return;
+  }
+
+  const size_t middle = m_items.size();
+  Append(itemlist);
+  if (m_sortDescription.sortBy == SortByNone ||
+      m_sortDescription.sortBy != itemlist.m_sortDescription.sortBy ||
+      m_sortDescription.sortOrder != itemlist.m_sortDescription.sortOrder ||
+      m_sortDescription.sortAttributes != itemlist.m_sortDescription.sortAttributes)
+    return;
+
+  // the sort labels of both lists were set when they were sorted
+  const SortDescription sorting = itemlist.GetEffectiveSortDescription(m_sortDescription);
+  CSortKeys keys;
+  keys.Reserve(m_items.size(), m_items.size() * 32);
+  for (const auto& item : m_items)
+  {
+    CSortKeys::Special special = CSortKeys::Special::NONE;
+    if (item->SortsOnTop())
+      special = CSortKeys::Special::ON_TOP;
+    else if (item->SortsOnBottom())
+      special = CSortKeys::Special::ON_BOTTOM;
+    keys.Add(item->GetSortLabel(), special,
+             item->IsFolder() ? CSortKeys::Folder::YES : CSortKeys::Folder::NO);
+  }
+
+  const std::vector<uint32_t> order =
+      keys.Merge(middle, sorting.sortOrder == SortOrderDescending,
+                 sorting.sortAttributes & SortAttributeIgnoreFolders);
+
+  std::vector<std::shared_ptr<CFileItem>> mergedFileItems;
+  mergedFileItems.reserve(m_items.size());
+  for (const uint32_t index : order)
+    mergedFileItems.emplace_back(std::move(m_items[index]));
+  m_items = std::move(mergedFileItems);
+}
+
 void CFileItemList::Randomize()
 {
   std::unique_lock lock(m_lock);
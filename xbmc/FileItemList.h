@@ -66,6 +66,13 @@ public:
   already been sorted with the same options before.
   */
   void Sort(SortDescription sortDescription);
+  /* \brief Adds items which are sorted like this list and keeps the list in order
+
+  The added items are merged into the items of the list instead of sorting
+  all of them again. If either list isn't sorted or they are sorted
+  differently, the items are appended.
+  */
+  void Merge(const CFileItemList& itemlist);
   void Randomize();
   void FillInDefaultIcons();
   int GetFolderCount() const;
@@ -201,6 +208,8 @@ private:
   std::map<std::string, std::shared_ptr<CFileItem>, std::less<>> m_map;
   bool m_ignoreURLOptions = false;
   bool m_fastLookup = false;
+  SortDescription GetEffectiveSortDescription(SortDescription sortDescription) const;
+
   SortDescription m_sortDescription;
   bool m_sortIgnoreFolders = false;
   CacheType m_cacheToDisc = CacheType::IF_SLOW;
@@ -132,12 +132,17 @@ bool CGUILargeTextureManager::CLargeTexture::DecrRef(bool deleteImmediately)
     if (deleteImmediately)
       delete this;
     else
-      m_timeToDelete = CTimeUtils::GetFrameTime() + TIME_TO_DELETE;
+      SetUnused();
     return true;
   }
   return false;
 }
 
+void CGUILargeTextureManager::CLargeTexture::SetUnused()
+{
+  m_timeToDelete = CTimeUtils::GetFrameTime() + TIME_TO_DELETE;
+}
+
 bool CGUILargeTextureManager::CLargeTexture::DeleteIfRequired(bool deleteImmediately)
 {
   if (m_refCount == 0 && (deleteImmediately || m_timeToDelete < CTimeUtils::GetFrameTime()))
@@ -196,7 +201,10 @@ bool CGUILargeTextureManager::GetImage(const std::string& path,
         image->GetTargetHeight() == height && image->GetAspectRatio() == aspectRatio)
     {
       if (firstRequest)
+      {
         image->AddRef();
+        image->SetPrefetchOwner(nullptr);
+      }
       texture = image->GetTexture();
       return texture.size() > 0;
     }
@@ -242,6 +250,61 @@ void CGUILargeTextureManager::ReleaseImage(const std::string& path,
   }
 }
 
+void CGUILargeTextureManager::PrefetchImage(const std::string& path,
+                                            unsigned int width,
+                                            unsigned int height,
+                                            CAspectRatio::AspectRatio aspectRatio,
+                                            bool useCache,
+                                            const void* owner)
+{
+  if (path.empty())
+    return;
+
+  std::unique_lock lock(m_listSection);
+  for (CLargeTexture* image : m_allocated)
+  {
+    if (image->GetPath() == path && image->GetTargetWidth() == width &&
+        image->GetTargetHeight() == height && image->GetAspectRatio() == aspectRatio)
+    {
+      if (image->IsUnused())
+        image->SetUnused(); // postpone the deletion
+      return;
+    }
+  }
+  for (const auto& [id, image] : m_queued)
+  {
+    if (image->GetPath() == path && image->GetTargetWidth() == width &&
+        image->GetTargetHeight() == height && image->GetAspectRatio() == aspectRatio)
+      return; // already queued
+  }
+
+  // queue the item without a reference, below the priority of visible images
+  CLargeTexture* image = new CLargeTexture(path, width, height, aspectRatio);
+  image->DecrRef(false);
+  image->SetPrefetchOwner(owner);
+  unsigned int jobID = CServiceBroker::GetJobManager()->AddJob(
+      new CImageLoader(path, width, height, aspectRatio, useCache), this, CJob::PRIORITY_LOW);
+  m_queued.emplace_back(jobID, image);
+}
+
+void CGUILargeTextureManager::CancelPrefetches(const void* owner)
+{
+  std::unique_lock lock(m_listSection);
+  auto it = m_queued.begin();
+  while (it != m_queued.end())
+  {
+    CLargeTexture* image = it->second;
+    if (image->GetPrefetchOwner() == owner && image->IsUnused())
+    {
+      CServiceBroker::GetJobManager()->CancelJob(it->first);
+      delete image;
+      it = m_queued.erase(it);
+    }
+    else
+      ++it;
+  }
+}
+
 // queue the image, and start the background loader if necessary
 void CGUILargeTextureManager::QueueImage(const std::string& path,
                                          unsigned int width,
@@ -259,6 +322,14 @@ void CGUILargeTextureManager::QueueImage(const std::string& path,
     if (image->GetPath() == path && image->GetTargetWidth() == width &&
         image->GetTargetHeight() == height && image->GetAspectRatio() == aspectRatio)
     {
+      if (image->GetPrefetchOwner())
+      { // only prefetched so far, load it at the priority of visible images
+        CServiceBroker::GetJobManager()->CancelJob(it->first);
+        it->first = CServiceBroker::GetJobManager()->AddJob(
+            new CImageLoader(path, width, height, aspectRatio, useCache), this,
+            CJob::PRIORITY_NORMAL);
+        image->SetPrefetchOwner(nullptr);
+      }
       image->AddRef();
       return; // already queued
     }
@@ -283,6 +354,8 @@ void CGUILargeTextureManager::OnJobComplete(unsigned int jobID, bool success, CJ
       CLargeTexture *image = it->second;
       image->SetTexture(std::move(loader->m_texture));
       loader->m_texture = NULL; // we want to keep the texture, and jobs are auto-deleted.
+      if (image->IsUnused())
+        image->SetUnused(); // prefetched, keep it for a while
       m_queued.erase(it);
       m_allocated.push_back(image);
       return;
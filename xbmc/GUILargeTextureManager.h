@@ -120,6 +120,33 @@ public:
                     CAspectRatio::AspectRatio aspectRatio,
                     bool immediately = false);
 
+  /*!
+   \brief Request a texture to be loaded ahead of use, e.g. for items about to scroll into view.
+
+   The image is loaded at a lower priority than images requested by GetImage(). It is kept for a
+   while if it isn't requested in the meantime, a request of the image while it is being loaded
+   raises the priority of the load.
+
+   \param path path of the image to load.
+   \param width target width of the image. 0 means original width.
+   \param height target height of the image. 0 means original height.
+   \param useCache whether to load from image cache.
+   \param owner identifies the requester, to cancel its prefetches.
+   \sa GetImage, CancelPrefetches
+   */
+  void PrefetchImage(const std::string& path,
+                     unsigned int width,
+                     unsigned int height,
+                     CAspectRatio::AspectRatio aspectRatio,
+                     bool useCache,
+                     const void* owner);
+
+  /*!
+   \brief Cancel the loads of prefetched images which haven't been requested yet.
+   \param owner the requester given to PrefetchImage().
+   */
+  void CancelPrefetches(const void* owner);
+
   /*!
    \brief Cleanup images that are no longer in use.
 
@@ -144,6 +171,11 @@ private:
     void AddRef();
     bool DecrRef(bool deleteImmediately);
     bool DeleteIfRequired(bool deleteImmediately = false);
+    /*!
+     \brief Start the delay to delete an image which isn't referenced.
+     */
+    void SetUnused();
+    bool IsUnused() const { return m_refCount == 0; }
     void SetTexture(std::unique_ptr<CTexture> texture);
 
     const std::string& GetPath() const { return m_path; }
@@ -151,6 +183,8 @@ private:
     unsigned int GetTargetWidth() const { return m_targetWidth; }
     unsigned int GetTargetHeight() const { return m_targetHeight; }
     CAspectRatio::AspectRatio GetAspectRatio() const { return m_aspectRatio; }
+    const void* GetPrefetchOwner() const { return m_prefetchOwner; }
+    void SetPrefetchOwner(const void* owner) { m_prefetchOwner = owner; }
 
   private:
     static const unsigned int TIME_TO_DELETE = 2000;
@@ -162,6 +196,7 @@ private:
     unsigned int m_targetHeight;
     CAspectRatio::AspectRatio m_aspectRatio;
     unsigned int m_timeToDelete;
+    const void* m_prefetchOwner{nullptr}; ///< set while the image is only prefetched
   };
 
   void QueueImage(const std::string& path,
@@ -534,6 +534,11 @@ bool CAddonInfoBuilder::ParseXML(const AddonInfoPtr& addon,
       if (element && element->GetText() != nullptr)
         addon->AddExtraInfo("reuselanguageinvoker", element->GetText());
 
+      /* Parse addon.xml "<languageinvokerpool">...</languageinvokerpool>" */
+      element = child->FirstChildElement("languageinvokerpool");
+      if (element && element->GetText() != nullptr)
+        addon->AddExtraInfo("languageinvokerpool", element->GetText());
+
       /* Parse addon.xml "<size">...</size>" */
       element = child->FirstChildElement("size");
       if (element && element->GetText() != nullptr)
@@ -80,6 +80,7 @@
 #include "guilib/GUIAudioManager.h"
 #include "guilib/GUIComponent.h"
 #include "guilib/GUIControlProfiler.h"
+#include "guilib/GUIFrameProfiler.h"
 #include "guilib/GUIFontManager.h"
 #include "guilib/GUIWindowManager.h"
 #include "guilib/LocalizeStrings.h"
@@ -889,8 +890,11 @@ void CApplication::Render()
     infoMgr.GetInfoProviders().GetSystemInfoProvider().UpdateFPS();
   }
 
-  CServiceBroker::GetWinSystem()->GetGfxContext().Flip(hasRendered,
-                                                       appPlayer->IsRenderingVideoLayer());
+  {
+    CGUIFrameProfiler::CScope profile(CGUIFrameProfiler::Phase::PRESENT);
+    CServiceBroker::GetWinSystem()->GetGfxContext().Flip(hasRendered,
+                                                         appPlayer->IsRenderingVideoLayer());
+  }
 
   CTimeUtils::UpdateFrameTime(hasRendered);
 }
@@ -1401,6 +1405,8 @@ bool CApplication::OnAction(const CAction &action)
   {
     CGUIControlProfiler::Instance().SetOutputFile(CSpecialProtocol::TranslatePath("special://home/guiprofiler.xml"));
     CGUIControlProfiler::Instance().Start();
+    CGUIFrameProfiler::Instance().SaveTrace(
+        CSpecialProtocol::TranslatePath("special://home/guiframes.json"));
     return true;
   }
   if (action.GetID() == ACTION_SHOW_PLAYLIST)
@@ -1777,6 +1783,7 @@ void CApplication::UnlockFrameMoveGuard()
 
 void CApplication::FrameMove(bool processEvents, bool processGUI)
 {
+  CGUIFrameProfiler::CScope profile(CGUIFrameProfiler::Phase::FRAME_MOVE);
   const auto appPlayer = GetComponent<CApplicationPlayer>();
   bool renderGUI = GetComponent<CApplicationPowerHandling>()->GetRenderGUI();
   if (processEvents)
@@ -1901,6 +1908,7 @@ int CApplication::Run()
     // Animate and render a frame
 
     lastFrameTime = std::chrono::steady_clock::now();
+    CGUIFrameProfiler::Instance().BeginFrame(lastFrameTime);
     Process();
 
     bool renderGUI = GetComponent<CApplicationPowerHandling>()->GetRenderGUI();
@@ -1981,6 +1989,7 @@ bool CApplication::Cleanup()
     g_localizeStrings.Clear();
     g_LangCodeExpander.Clear();
     g_charsetConverter.clear();
+    g_directoryCache.PrintStats();
     g_directoryCache.Clear();
     //CServiceBroker::GetInputManager().ClearKeymaps(); //! @todo
     CEventServer::RemoveInstance();
@@ -3229,6 +3238,7 @@ void CApplication::ConfigureAndEnableAddons()
 
 void CApplication::Process()
 {
+  CGUIFrameProfiler::CScope profile(CGUIFrameProfiler::Phase::APP_PROCESS);
   // dispatch the messages generated by python or other threads to the current window
   CServiceBroker::GetGUI()->GetWindowManager().DispatchThreadMessages();
 
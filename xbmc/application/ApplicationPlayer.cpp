@@ -15,6 +15,7 @@
 #include "cores/playercorefactory/PlayerCoreFactory.h"
 #include "guilib/GUIComponent.h"
 #include "guilib/GUIWindowManager.h"
+#include "rendering/RenderSystem.h"
 #include "settings/AdvancedSettings.h"
 #include "settings/SettingsComponent.h"
 #include "video/VideoFileItemClassify.h"
@@ -850,7 +851,11 @@ void CApplicationPlayer::Render(bool clear, uint32_t alpha, bool gui)
 {
   std::shared_ptr<IPlayer> player = GetInternal();
   if (player)
+  {
+    // video renderers draw on their own, so get queued GUI textures out of the way
+    CServiceBroker::GetRenderSystem()->FlushQuadBatch();
     player->Render(clear, alpha, gui);
+  }
 }
 
 void CApplicationPlayer::FlushRenderer()
@@ -26,6 +26,7 @@
 #include "cores/RetroPlayer/streams/RetroPlayerVideo.h"
 #include "filesystem/File.h"
 #include "pictures/Picture.h"
+#include "rendering/RenderSystem.h"
 #include "threads/SingleLock.h"
 #include "utils/ColorUtils.h"
 #include "utils/TransformMatrix.h"
@@ -481,6 +482,9 @@ void CRPRenderManager::RenderInternal(const std::shared_ptr<CRPBaseRenderer>& re
 {
   CSingleExit exitLock(m_renderContext.GraphicsMutex());
 
+  // not all renderers draw through the render system
+  m_renderContext.Rendering()->FlushQuadBatch();
+
   if (renderBuffer != nullptr)
   {
     bool bUploaded = true;
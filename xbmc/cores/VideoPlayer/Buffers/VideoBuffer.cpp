@@ -14,6 +14,18 @@
 #include <string.h>
 #include <utility>
 
+namespace
+{
+std::atomic<uint64_t> copiedPictures{0};
+std::atomic<uint64_t> copiedBytes{0};
+
+void CountCopy(uint64_t bytes)
+{
+  copiedPictures.fetch_add(1, std::memory_order_relaxed);
+  copiedBytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+} // unnamed namespace
+
 //-----------------------------------------------------------------------------
 // CVideoBuffer
 //-----------------------------------------------------------------------------
@@ -101,6 +113,8 @@ bool CVideoBuffer::CopyPicture(YuvImage* pDst, YuvImage *pSrc)
       d += pDst->stride[2];
     }
   }
+  CountCopy(static_cast<uint64_t>(pDst->width * pDst->bpp) * pDst->height +
+            static_cast<uint64_t>(w) * h * 2);
   return true;
 }
 
@@ -145,6 +159,7 @@ bool CVideoBuffer::CopyNV12Picture(YuvImage* pDst, YuvImage *pSrc)
     }
   }
 
+  CountCopy(static_cast<uint64_t>(pDst->width) * pDst->height * 3 / 2);
   return true;
 }
 
@@ -170,9 +185,20 @@ bool CVideoBuffer::CopyYUV422PackedPicture(YuvImage* pDst, YuvImage *pSrc)
     }
   }
 
+  CountCopy(static_cast<uint64_t>(w) * h * 2);
   return true;
 }
 
+uint64_t CVideoBuffer::GetCopiedPictures()
+{
+  return copiedPictures;
+}
+
+uint64_t CVideoBuffer::GetCopiedBytes()
+{
+  return copiedBytes;
+}
+
 CVideoBufferSysMem::CVideoBufferSysMem(IVideoBufferPool &pool, int id, AVPixelFormat format, int size)
 : CVideoBuffer(id)
 {
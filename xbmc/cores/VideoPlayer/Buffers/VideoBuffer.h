@@ -109,6 +109,10 @@ public:
   static bool CopyNV12Picture(YuvImage* pDst, YuvImage *pSrc);
   static bool CopyYUV422PackedPicture(YuvImage* pDst, YuvImage *pSrc);
 
+  // number of pictures and bytes copied by the cpu with the functions above
+  static uint64_t GetCopiedPictures();
+  static uint64_t GetCopiedBytes();
+
 protected:
   explicit CVideoBuffer(int id);
   AVPixelFormat m_pixFormat = AV_PIX_FMT_NONE;
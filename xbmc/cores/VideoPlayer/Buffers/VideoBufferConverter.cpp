@@ -0,0 +1,487 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "VideoBufferConverter.h"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(HAVE_AVX2) && defined(__AVX2__)
+#include <immintrin.h>
+#define CONVERTER_AVX2
+#elif defined(HAVE_SSE2) && defined(__SSE2__)
+#include <emmintrin.h>
+#define CONVERTER_SSE2
+#elif defined(HAS_NEON) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#include <arm_neon.h>
+#define CONVERTER_NEON
+#endif
+
+using Coefficients = CVideoBufferConverter::Coefficients;
+using Sample = CVideoBufferConverter::Sample;
+
+namespace
+{
+// fixed point precision of the color coefficients. the samples are multiplied in the upper 8 bits
+// of 16 bits and only the high half of the products is kept, like mulhi of the simd kernels, which
+// leaves SHIFT fractional bits.
+constexpr int COEFFICIENT_SHIFT = 13;
+constexpr int SHIFT = COEFFICIENT_SHIFT + 8 - 16;
+
+// (sample << 8) * coefficient >> 16
+int MulHigh(int sample, int coefficient)
+{
+  return (sample * 256 * coefficient) >> 16;
+}
+
+std::vector<Sample> GetSamples(int count, int dstCount)
+{
+  std::vector<Sample> samples(dstCount);
+  for (int i = 0; i < dstCount; ++i)
+  {
+    // position of the center of the pixel in the source, in 1/256
+    const int64_t pos = std::max<int64_t>(
+        (static_cast<int64_t>(2 * i + 1) * count * 256) / (2 * dstCount) - 128, 0);
+    Sample& sample = samples[i];
+    sample.index = std::min(static_cast<int>(pos >> 8), count - 1);
+    sample.next = std::min(sample.index + 1, count - 1);
+    sample.frac = sample.next == sample.index ? 0 : static_cast<int>(pos & 0xff);
+  }
+  return samples;
+}
+
+uint8_t Clamp(int value)
+{
+  return static_cast<uint8_t>(std::clamp(value, 0, 255));
+}
+
+void LerpRowC(const uint8_t* a, const uint8_t* b, uint8_t* dst, int count, int frac)
+{
+  for (int x = 0; x < count; ++x)
+    dst[x] = static_cast<uint8_t>((a[x] * (256 - frac) + b[x] * frac + 128) >> 8);
+}
+
+void NarrowRowC(const uint16_t* src, uint8_t* dst, int count, int shift)
+{
+  for (int x = 0; x < count; ++x)
+    dst[x] = static_cast<uint8_t>(std::min(src[x] >> shift, 255));
+}
+} // unnamed namespace
+
+Coefficients CVideoBufferConverter::GetCoefficients(AVColorSpace colorSpace, bool fullRange)
+{
+  double kr;
+  double kb;
+  switch (colorSpace)
+  {
+    case AVCOL_SPC_BT709:
+      kr = 0.2126;
+      kb = 0.0722;
+      break;
+    case AVCOL_SPC_BT2020_NCL:
+    case AVCOL_SPC_BT2020_CL:
+      kr = 0.2627;
+      kb = 0.0593;
+      break;
+    default:
+      kr = 0.299;
+      kb = 0.114;
+      break;
+  }
+  const double kg = 1.0 - kr - kb;
+  const double yScale = fullRange ? 1.0 : 255.0 / 219.0;
+  const double cScale = fullRange ? 1.0 : 255.0 / 224.0;
+  const auto fixed = [](double value)
+  { return static_cast<int16_t>(std::lround(value * (1 << COEFFICIENT_SHIFT))); };
+
+  Coefficients coefficients;
+  coefficients.y = fixed(yScale);
+  // the offset of the luma is subtracted after scaling, together with the rounding of the result
+  coefficients.yOffset = static_cast<int16_t>(
+      std::lround((fullRange ? 0 : 16) * yScale * (1 << SHIFT)) - (1 << (SHIFT - 1)));
+  coefficients.rv = fixed(2.0 * (1.0 - kr) * cScale);
+  coefficients.gu = fixed(2.0 * (1.0 - kb) * kb / kg * cScale);
+  coefficients.gv = fixed(2.0 * (1.0 - kr) * kr / kg * cScale);
+  coefficients.bu = fixed(2.0 * (1.0 - kb) * cScale);
+  return coefficients;
+}
+
+void CVideoBufferConverter::ConvertRowC(const uint8_t* y,
+                                        const uint8_t* u,
+                                        const uint8_t* v,
+                                        uint8_t* dst,
+                                        int width,
+                                        const Coefficients& c)
+{
+  for (int x = 0; x < width; ++x)
+  {
+    const int luma = MulHigh(y[x], c.y) - c.yOffset;
+    const int cb = u[x] - 128;
+    const int cr = v[x] - 128;
+    dst[4 * x + 0] = Clamp((luma + MulHigh(cb, c.bu)) >> SHIFT);
+    dst[4 * x + 1] = Clamp((luma - MulHigh(cb, c.gu) - MulHigh(cr, c.gv)) >> SHIFT);
+    dst[4 * x + 2] = Clamp((luma + MulHigh(cr, c.rv)) >> SHIFT);
+    dst[4 * x + 3] = 0xff;
+  }
+}
+
+// the sums of the products fit into 16 bits, so the simd kernels give the same results as the C
+// version
+void CVideoBufferConverter::ConvertRow(const uint8_t* y,
+                                       const uint8_t* u,
+                                       const uint8_t* v,
+                                       uint8_t* dst,
+                                       int width,
+                                       const Coefficients& c)
+{
+  int x = 0;
+#if defined(CONVERTER_AVX2)
+  const __m256i yOffset = _mm256_set1_epi16(c.yOffset);
+  const __m256i cOffset = _mm256_set1_epi16(128);
+  const __m256i cy = _mm256_set1_epi16(c.y);
+  const __m256i crv = _mm256_set1_epi16(c.rv);
+  const __m256i cgu = _mm256_set1_epi16(c.gu);
+  const __m256i cgv = _mm256_set1_epi16(c.gv);
+  const __m256i cbu = _mm256_set1_epi16(c.bu);
+  const __m128i alpha = _mm_set1_epi8(-1);
+  for (; x + 16 <= width; x += 16)
+  {
+    const __m256i ys = _mm256_slli_epi16(
+        _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(y + x))), 8);
+    const __m256i us = _mm256_slli_epi16(
+        _mm256_sub_epi16(
+            _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(u + x))),
+            cOffset),
+        8);
+    const __m256i vs = _mm256_slli_epi16(
+        _mm256_sub_epi16(
+            _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(v + x))),
+            cOffset),
+        8);
+    const __m256i luma = _mm256_sub_epi16(_mm256_mulhi_epu16(ys, cy), yOffset);
+
+    const __m256i r =
+        _mm256_srai_epi16(_mm256_add_epi16(luma, _mm256_mulhi_epi16(vs, crv)), SHIFT);
+    const __m256i g = _mm256_srai_epi16(
+        _mm256_sub_epi16(_mm256_sub_epi16(luma, _mm256_mulhi_epi16(us, cgu)),
+                         _mm256_mulhi_epi16(vs, cgv)),
+        SHIFT);
+    const __m256i b =
+        _mm256_srai_epi16(_mm256_add_epi16(luma, _mm256_mulhi_epi16(us, cbu)), SHIFT);
+
+    // pack the lanes in order
+    const __m128i b8 = _mm_packus_epi16(_mm256_castsi256_si128(b), _mm256_extracti128_si256(b, 1));
+    const __m128i g8 = _mm_packus_epi16(_mm256_castsi256_si128(g), _mm256_extracti128_si256(g, 1));
+    const __m128i r8 = _mm_packus_epi16(_mm256_castsi256_si128(r), _mm256_extracti128_si256(r, 1));
+    const __m128i bgLow = _mm_unpacklo_epi8(b8, g8);
+    const __m128i bgHigh = _mm_unpackhi_epi8(b8, g8);
+    const __m128i raLow = _mm_unpacklo_epi8(r8, alpha);
+    const __m128i raHigh = _mm_unpackhi_epi8(r8, alpha);
+    __m128i* out = reinterpret_cast<__m128i*>(dst + 4 * x);
+    _mm_storeu_si128(out, _mm_unpacklo_epi16(bgLow, raLow));
+    _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(bgLow, raLow));
+    _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(bgHigh, raHigh));
+    _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(bgHigh, raHigh));
+  }
+#elif defined(CONVERTER_SSE2)
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i yOffset = _mm_set1_epi16(c.yOffset);
+  const __m128i cOffset = _mm_set1_epi16(128);
+  const __m128i cy = _mm_set1_epi16(c.y);
+  const __m128i crv = _mm_set1_epi16(c.rv);
+  const __m128i cgu = _mm_set1_epi16(c.gu);
+  const __m128i cgv = _mm_set1_epi16(c.gv);
+  const __m128i cbu = _mm_set1_epi16(c.bu);
+  const __m128i alpha = _mm_set1_epi8(-1);
+  for (; x + 8 <= width; x += 8)
+  {
+    // the samples in the upper 8 bits
+    const __m128i ys =
+        _mm_unpacklo_epi8(zero, _mm_loadl_epi64(reinterpret_cast<const __m128i*>(y + x)));
+    const __m128i us = _mm_slli_epi16(
+        _mm_sub_epi16(
+            _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(u + x)), zero),
+            cOffset),
+        8);
+    const __m128i vs = _mm_slli_epi16(
+        _mm_sub_epi16(
+            _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(v + x)), zero),
+            cOffset),
+        8);
+    const __m128i luma = _mm_sub_epi16(_mm_mulhi_epu16(ys, cy), yOffset);
+
+    const __m128i r = _mm_srai_epi16(_mm_add_epi16(luma, _mm_mulhi_epi16(vs, crv)), SHIFT);
+    const __m128i g = _mm_srai_epi16(
+        _mm_sub_epi16(_mm_sub_epi16(luma, _mm_mulhi_epi16(us, cgu)), _mm_mulhi_epi16(vs, cgv)),
+        SHIFT);
+    const __m128i b = _mm_srai_epi16(_mm_add_epi16(luma, _mm_mulhi_epi16(us, cbu)), SHIFT);
+
+    const __m128i bg = _mm_unpacklo_epi8(_mm_packus_epi16(b, b), _mm_packus_epi16(g, g));
+    const __m128i ra = _mm_unpacklo_epi8(_mm_packus_epi16(r, r), alpha);
+    __m128i* out = reinterpret_cast<__m128i*>(dst + 4 * x);
+    _mm_storeu_si128(out, _mm_unpacklo_epi16(bg, ra));
+    _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(bg, ra));
+  }
+#elif defined(CONVERTER_NEON)
+  const int16x8_t yOffset = vdupq_n_s16(c.yOffset);
+  const int16x8_t cOffset = vdupq_n_s16(128);
+  for (; x + 8 <= width; x += 8)
+  {
+    // the doubling multiply takes the samples in the upper 7 bits
+    const int16x8_t ys = vreinterpretq_s16_u16(vshll_n_u8(vld1_u8(y + x), 7));
+    const int16x8_t us =
+        vshlq_n_s16(vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vld1_u8(u + x))), cOffset), 7);
+    const int16x8_t vs =
+        vshlq_n_s16(vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vld1_u8(v + x))), cOffset), 7);
+    const int16x8_t luma = vsubq_s16(vqdmulhq_n_s16(ys, c.y), yOffset);
+
+    uint8x8x4_t bgra;
+    bgra.val[0] = vqshrun_n_s16(vaddq_s16(luma, vqdmulhq_n_s16(us, c.bu)), SHIFT);
+    bgra.val[1] = vqshrun_n_s16(
+        vsubq_s16(vsubq_s16(luma, vqdmulhq_n_s16(us, c.gu)), vqdmulhq_n_s16(vs, c.gv)), SHIFT);
+    bgra.val[2] = vqshrun_n_s16(vaddq_s16(luma, vqdmulhq_n_s16(vs, c.rv)), SHIFT);
+    bgra.val[3] = vdup_n_u8(0xff);
+    vst4_u8(dst + 4 * x, bgra);
+  }
+#endif
+  ConvertRowC(y + x, u + x, v + x, dst + 4 * x, width - x, c);
+}
+
+namespace
+{
+
+// blend two rows with frac/256 of b
+void LerpRow(const uint8_t* a, const uint8_t* b, uint8_t* dst, int count, int frac)
+{
+  int x = 0;
+#if defined(CONVERTER_AVX2)
+  const __m256i weightA = _mm256_set1_epi16(256 - frac);
+  const __m256i weightB = _mm256_set1_epi16(frac);
+  const __m256i round = _mm256_set1_epi16(128);
+  for (; x + 16 <= count; x += 16)
+  {
+    const __m256i as =
+        _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a + x)));
+    const __m256i bs =
+        _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(b + x)));
+    const __m256i sum = _mm256_srli_epi16(
+        _mm256_add_epi16(_mm256_add_epi16(_mm256_mullo_epi16(as, weightA),
+                                          _mm256_mullo_epi16(bs, weightB)),
+                         round),
+        8);
+    _mm_storeu_si128(
+        reinterpret_cast<__m128i*>(dst + x),
+        _mm_packus_epi16(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1)));
+  }
+#elif defined(CONVERTER_SSE2)
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i weightA = _mm_set1_epi16(256 - frac);
+  const __m128i weightB = _mm_set1_epi16(frac);
+  const __m128i round = _mm_set1_epi16(128);
+  for (; x + 16 <= count; x += 16)
+  {
+    const __m128i as = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + x));
+    const __m128i bs = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + x));
+    const __m128i low = _mm_srli_epi16(
+        _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(as, zero), weightA),
+                                    _mm_mullo_epi16(_mm_unpacklo_epi8(bs, zero), weightB)),
+                      round),
+        8);
+    const __m128i high = _mm_srli_epi16(
+        _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(as, zero), weightA),
+                                    _mm_mullo_epi16(_mm_unpackhi_epi8(bs, zero), weightB)),
+                      round),
+        8);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x), _mm_packus_epi16(low, high));
+  }
+#elif defined(CONVERTER_NEON)
+  const uint8x8_t weightA = vdup_n_u8(static_cast<uint8_t>(256 - frac));
+  const uint8x8_t weightB = vdup_n_u8(static_cast<uint8_t>(frac));
+  for (; x + 8 <= count; x += 8)
+  {
+    const uint16x8_t sum = vmlal_u8(vmull_u8(vld1_u8(a + x), weightA), vld1_u8(b + x), weightB);
+    vst1_u8(dst + x, vrshrn_n_u16(sum, 8));
+  }
+#endif
+  LerpRowC(a + x, b + x, dst + x, count - x, frac);
+}
+
+// samples of more than 8 bits to 8 bits
+void NarrowRow(const uint16_t* src, uint8_t* dst, int count, int shift)
+{
+  int x = 0;
+#if defined(CONVERTER_AVX2) || defined(CONVERTER_SSE2)
+  const __m128i count128 = _mm_cvtsi32_si128(shift);
+  for (; x + 16 <= count; x += 16)
+  {
+    const __m128i low = _mm_srl_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x)),
+                                      count128);
+    const __m128i high = _mm_srl_epi16(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x + 8)), count128);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x), _mm_packus_epi16(low, high));
+  }
+#elif defined(CONVERTER_NEON)
+  const int16x8_t shiftRight = vdupq_n_s16(static_cast<int16_t>(-shift));
+  for (; x + 8 <= count; x += 8)
+    vst1_u8(dst + x, vqmovn_u16(vshlq_u16(vld1q_u16(src + x), shiftRight)));
+#endif
+  NarrowRowC(src + x, dst + x, count - x, shift);
+}
+
+// resample a row, step is the distance of the samples of a component
+void Horizontal(const uint8_t* src, const std::vector<Sample>& columns, int step, uint8_t* dst)
+{
+  for (size_t x = 0; x < columns.size(); ++x)
+  {
+    const Sample& sample = columns[x];
+    dst[x] = static_cast<uint8_t>(
+        (src[sample.index * step] * (256 - sample.frac) + src[sample.next * step] * sample.frac +
+         128) >>
+        8);
+  }
+}
+} // unnamed namespace
+
+bool CVideoBufferConverter::IsSupported(AVPixelFormat format)
+{
+  switch (format)
+  {
+    case AV_PIX_FMT_YUV420P:
+    case AV_PIX_FMT_YUVJ420P:
+    case AV_PIX_FMT_NV12:
+    case AV_PIX_FMT_P010LE:
+    case AV_PIX_FMT_YUV420P10LE:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool CVideoBufferConverter::Configure(AVPixelFormat format,
+                                      int width,
+                                      int height,
+                                      AVColorSpace colorSpace,
+                                      bool fullRange,
+                                      int dstWidth,
+                                      int dstHeight)
+{
+  m_configured = false;
+  if (!IsSupported(format) || width <= 0 || height <= 0 || dstWidth <= 0 || dstHeight <= 0)
+    return false;
+
+  m_interleaved = format == AV_PIX_FMT_NV12 || format == AV_PIX_FMT_P010LE;
+  if (format == AV_PIX_FMT_P010LE)
+    m_shift = 8;
+  else if (format == AV_PIX_FMT_YUV420P10LE)
+    m_shift = 2;
+  else
+    m_shift = 0;
+
+  if (colorSpace == AVCOL_SPC_UNSPECIFIED)
+    colorSpace = height > 576 ? AVCOL_SPC_BT709 : AVCOL_SPC_BT470BG;
+  m_coefficients = GetCoefficients(colorSpace, fullRange || format == AV_PIX_FMT_YUVJ420P);
+
+  m_width = width;
+  m_height = height;
+  m_dstWidth = dstWidth;
+  m_dstHeight = dstHeight;
+
+  const int chromaWidth = (width + 1) / 2;
+  const int chromaHeight = (height + 1) / 2;
+  m_rows = GetSamples(height, dstHeight);
+  m_columns = GetSamples(width, dstWidth);
+  m_chromaRows = GetSamples(chromaHeight, dstHeight);
+  m_chromaColumns = GetSamples(chromaWidth, dstWidth);
+
+  m_lineY.resize(width);
+  m_lineU.resize(m_interleaved ? 2 * chromaWidth : chromaWidth);
+  m_lineV.resize(chromaWidth);
+  m_narrowA.resize(std::max(width, 2 * chromaWidth));
+  m_narrowB.resize(m_narrowA.size());
+  m_rowY.resize(dstWidth);
+  m_rowU.resize(dstWidth);
+  m_rowV.resize(dstWidth);
+
+  m_configured = true;
+  return true;
+}
+
+const uint8_t* CVideoBufferConverter::Vertical(
+    const uint8_t* plane, int stride, const Sample& sample, int count, std::vector<uint8_t>& line)
+{
+  const uint8_t* a = plane + static_cast<ptrdiff_t>(sample.index) * stride;
+  const uint8_t* b = plane + static_cast<ptrdiff_t>(sample.next) * stride;
+  if (m_shift)
+  {
+    if (!sample.frac)
+    {
+      NarrowRow(reinterpret_cast<const uint16_t*>(a), line.data(), count, m_shift);
+      return line.data();
+    }
+
+    NarrowRow(reinterpret_cast<const uint16_t*>(a), m_narrowA.data(), count, m_shift);
+    NarrowRow(reinterpret_cast<const uint16_t*>(b), m_narrowB.data(), count, m_shift);
+    a = m_narrowA.data();
+    b = m_narrowB.data();
+  }
+  else if (!sample.frac)
+    return a;
+
+  LerpRow(a, b, line.data(), count, sample.frac);
+  return line.data();
+}
+
+bool CVideoBufferConverter::Convert(uint8_t* (&planes)[YuvImage::MAX_PLANES],
+                                    const int (&strides)[YuvImage::MAX_PLANES],
+                                    uint8_t* dst,
+                                    int dstStride)
+{
+  if (!m_configured || !planes[0] || !planes[1] || (!m_interleaved && !planes[2]))
+    return false;
+
+  const int chromaWidth = static_cast<int>(m_lineV.size());
+  const bool scaleX = m_width != m_dstWidth;
+  for (int y = 0; y < m_dstHeight; ++y)
+  {
+    const uint8_t* lineY = Vertical(planes[0], strides[0], m_rows[y], m_width, m_lineY);
+    if (scaleX)
+    {
+      Horizontal(lineY, m_columns, 1, m_rowY.data());
+      lineY = m_rowY.data();
+    }
+
+    if (m_interleaved)
+    {
+      const uint8_t* lineUV =
+          Vertical(planes[1], strides[1], m_chromaRows[y], 2 * chromaWidth, m_lineU);
+      Horizontal(lineUV, m_chromaColumns, 2, m_rowU.data());
+      Horizontal(lineUV + 1, m_chromaColumns, 2, m_rowV.data());
+    }
+    else
+    {
+      Horizontal(Vertical(planes[1], strides[1], m_chromaRows[y], chromaWidth, m_lineU),
+                 m_chromaColumns, 1, m_rowU.data());
+      Horizontal(Vertical(planes[2], strides[2], m_chromaRows[y], chromaWidth, m_lineV),
+                 m_chromaColumns, 1, m_rowV.data());
+    }
+
+    ConvertRow(lineY, m_rowU.data(), m_rowV.data(), dst + static_cast<ptrdiff_t>(y) * dstStride,
+               m_dstWidth, m_coefficients);
+  }
+
+  return true;
+}
+
+bool CVideoBufferConverter::Convert(CVideoBuffer& buffer, uint8_t* dst, int dstStride)
+{
+  uint8_t* planes[YuvImage::MAX_PLANES]{};
+  int strides[YuvImage::MAX_PLANES]{};
+  buffer.GetPlanes(planes);
+  buffer.GetStrides(strides);
+  return Convert(planes, strides, dst, dstStride);
+}
@@ -0,0 +1,122 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "cores/VideoPlayer/Buffers/VideoBuffer.h"
+
+#include <stdint.h>
+#include <vector>
+
+extern "C"
+{
+#include <libavutil/pixfmt.h>
+}
+
+/*!
+ * \brief Converts decoded YUV pictures to BGRA and scales them on the cpu.
+ *
+ * Used where pictures are needed without a render system, e.g. for thumbnails and for render
+ * captures of renderers which scan out the pictures directly. Pictures are scaled bilinearly, the
+ * color conversion and the vertical pass use SSE2, AVX2 or NEON when built for them.
+ */
+class CVideoBufferConverter
+{
+public:
+  static bool IsSupported(AVPixelFormat format);
+
+  /*!
+   * \brief Set up the conversion of pictures.
+   * \param format the format of the pictures: YUV420P, NV12, P010 or YUV420P10.
+   * \param width, height the size of the pictures.
+   * \param colorSpace the matrix of the pictures, chosen by the height if unspecified.
+   * \param fullRange true if the pictures use the full range.
+   * \param dstWidth, dstHeight the size of the converted pictures.
+   * \return false if the format isn't supported or a size is invalid.
+   */
+  bool Configure(AVPixelFormat format,
+                 int width,
+                 int height,
+                 AVColorSpace colorSpace,
+                 bool fullRange,
+                 int dstWidth,
+                 int dstHeight);
+
+  /*!
+   * \brief Convert a picture into a BGRA image of the configured size.
+   */
+  bool Convert(uint8_t* (&planes)[YuvImage::MAX_PLANES],
+               const int (&strides)[YuvImage::MAX_PLANES],
+               uint8_t* dst,
+               int dstStride);
+  bool Convert(CVideoBuffer& buffer, uint8_t* dst, int dstStride);
+
+  struct Sample
+  {
+    int index;
+    int next;
+    int frac; //!< weight of next in 1/256
+  };
+
+  //! the color matrix in fixed point, with the offset of the luma scaled like the products
+  struct Coefficients
+  {
+    int16_t y;
+    int16_t yOffset;
+    int16_t rv;
+    int16_t gu;
+    int16_t gv;
+    int16_t bu;
+  };
+
+  static Coefficients GetCoefficients(AVColorSpace colorSpace, bool fullRange);
+
+  /*!
+   * \brief Convert a row of samples of full resolution to BGRA, with simd if built for it.
+   */
+  static void ConvertRow(const uint8_t* y,
+                         const uint8_t* u,
+                         const uint8_t* v,
+                         uint8_t* dst,
+                         int width,
+                         const Coefficients& coefficients);
+  //! ConvertRow without simd, the simd kernels give the same results
+  static void ConvertRowC(const uint8_t* y,
+                          const uint8_t* u,
+                          const uint8_t* v,
+                          uint8_t* dst,
+                          int width,
+                          const Coefficients& coefficients);
+
+private:
+  const uint8_t* Vertical(
+      const uint8_t* plane, int stride, const Sample& sample, int count, std::vector<uint8_t>& line);
+
+  bool m_configured{false};
+  bool m_interleaved{false};
+  int m_shift{0}; //!< shift of samples of more than 8 bits to 8 bits, 0 for 8 bit formats
+  int m_width{0};
+  int m_height{0};
+  int m_dstWidth{0};
+  int m_dstHeight{0};
+  Coefficients m_coefficients{};
+
+  std::vector<Sample> m_rows;
+  std::vector<Sample> m_columns;
+  std::vector<Sample> m_chromaRows;
+  std::vector<Sample> m_chromaColumns;
+
+  std::vector<uint8_t> m_lineY;
+  std::vector<uint8_t> m_lineU;
+  std::vector<uint8_t> m_lineV;
+  std::vector<uint8_t> m_narrowA;
+  std::vector<uint8_t> m_narrowB;
+  std::vector<uint8_t> m_rowY;
+  std::vector<uint8_t> m_rowU;
+  std::vector<uint8_t> m_rowV;
+};
@@ -15,6 +15,7 @@
 
 extern "C"
 {
+#include <libavutil/buffer.h>
 #include <libavutil/imgutils.h>
 #include <libavutil/pixdesc.h>
 }
@@ -163,14 +164,41 @@ void CVideoBufferDMA::Export(AVFrame* frame, uint32_t width, uint32_t height)
   frame->opaque_ref = nullptr;
 }
 
+bool CVideoBufferDMA::Attach(AVFrame* frame, uint32_t width, uint32_t height)
+{
+  frame->opaque = static_cast<void*>(this);
+  frame->opaque_ref =
+      av_buffer_create(nullptr, 0, ReleaseFrame, frame->opaque, AV_BUFFER_FLAG_READONLY);
+  if (!frame->opaque_ref)
+  {
+    frame->opaque = nullptr;
+    Release();
+    return false;
+  }
+
+  Export(frame, width, height);
+  SyncStart();
+  return true;
+}
+
+void CVideoBufferDMA::ReleaseFrame(void* opaque, uint8_t* data)
+{
+  // frames which are dropped, skipped or filtered never reach the renderer
+  auto buffer = static_cast<CVideoBufferDMA*>(opaque);
+  buffer->SyncEnd();
+  buffer->Release();
+}
+
 void CVideoBufferDMA::SyncStart()
 {
-  m_bo->SyncStart();
+  if (!m_syncing.exchange(true))
+    m_bo->SyncStart();
 }
 
 void CVideoBufferDMA::SyncEnd()
 {
-  m_bo->SyncEnd();
+  if (m_syncing.exchange(false))
+    m_bo->SyncEnd();
 }
 
 void CVideoBufferDMA::Destroy()
@@ -10,6 +10,7 @@
 
 #include "cores/VideoPlayer/Buffers/VideoBufferDRMPRIME.h"
 
+#include <atomic>
 #include <memory>
 
 class IBufferObject;
@@ -39,10 +40,19 @@ public:
   bool Alloc();
   void Export(AVFrame* frame, uint32_t width, uint32_t height);
 
+  /*!
+   * \brief Attach the buffer to a frame for get_buffer2 of a decoder. The frame takes over the
+   * reference of the caller and the buffer is synced for cpu access until the picture is handed to
+   * the renderer or the last reference of the frame is freed, whatever comes first.
+   * \return false if the frame couldn't be referenced, the reference of the caller is released
+   */
+  bool Attach(AVFrame* frame, uint32_t width, uint32_t height);
+
   void SyncStart();
   void SyncEnd();
 
 private:
+  static void ReleaseFrame(void* opaque, uint8_t* data);
   void Destroy();
 
   std::unique_ptr<IBufferObject> m_bo;
@@ -58,4 +68,5 @@ private:
   uint64_t m_size{0};
   uint8_t* m_addr{nullptr};
   int m_fd{-1};
+  std::atomic_bool m_syncing{false};
 };
@@ -0,0 +1,297 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/VideoPlayer/Buffers/VideoBufferConverter.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+constexpr int Y = 180;
+constexpr int U = 90;
+constexpr int V = 200;
+
+struct Matrix
+{
+  AVColorSpace colorSpace;
+  double kr;
+  double kb;
+};
+
+constexpr Matrix MATRICES[] = {{AVCOL_SPC_BT470BG, 0.299, 0.114},
+                               {AVCOL_SPC_BT709, 0.2126, 0.0722},
+                               {AVCOL_SPC_BT2020_NCL, 0.2627, 0.0593}};
+
+struct Picture
+{
+  Picture(AVPixelFormat format, int width, int height, int u = U, int v = V)
+    : m_format(format), m_width(width), m_height(height)
+  {
+    const bool wide = format == AV_PIX_FMT_P010LE || format == AV_PIX_FMT_YUV420P10LE;
+    const bool interleaved = format == AV_PIX_FMT_NV12 || format == AV_PIX_FMT_P010LE;
+    const int bytes = wide ? 2 : 1;
+    const int chromaWidth = (width + 1) / 2;
+    const int chromaHeight = (height + 1) / 2;
+
+    strides[0] = width * bytes;
+    strides[1] = (interleaved ? chromaWidth * 2 : chromaWidth) * bytes;
+    strides[2] = interleaved ? 0 : chromaWidth * bytes;
+    m_data[0].resize(strides[0] * height);
+    m_data[1].resize(strides[1] * chromaHeight);
+    m_data[2].resize(strides[2] * chromaHeight);
+
+    for (int i = 0; i < width * height; ++i)
+      Put(0, i, Y);
+    for (int i = 0; i < chromaWidth * chromaHeight; ++i)
+    {
+      if (interleaved)
+      {
+        Put(1, i * 2, u);
+        Put(1, i * 2 + 1, v);
+      }
+      else
+      {
+        Put(1, i, u);
+        Put(2, i, v);
+      }
+    }
+
+    for (int plane = 0; plane < YuvImage::MAX_PLANES; ++plane)
+      planes[plane] = m_data[plane].data();
+  }
+
+  void Put(int plane, int index, int value)
+  {
+    if (m_format == AV_PIX_FMT_YUV420P || m_format == AV_PIX_FMT_NV12)
+    {
+      m_data[plane][index] = value;
+      return;
+    }
+    // P010 stores the samples in the high bits, YUV420P10 in the low bits
+    const uint16_t sample = m_format == AV_PIX_FMT_P010LE ? value << 8 : value << 2;
+    memcpy(&m_data[plane][index * 2], &sample, sizeof(sample));
+  }
+
+  void FillLuma(const std::function<int(int x, int y)>& luma)
+  {
+    for (int y = 0; y < m_height; ++y)
+    {
+      for (int x = 0; x < m_width; ++x)
+        Put(0, y * m_width + x, luma(x, y));
+    }
+  }
+
+  uint8_t* planes[YuvImage::MAX_PLANES];
+  int strides[YuvImage::MAX_PLANES];
+
+private:
+  AVPixelFormat m_format;
+  int m_width;
+  int m_height;
+  std::vector<uint8_t> m_data[YuvImage::MAX_PLANES];
+};
+
+int Clamp(double value)
+{
+  return static_cast<int>(std::lround(std::clamp(value, 0.0, 255.0)));
+}
+
+// BGRA of the conversion in floating point
+std::array<int, 4> Reference(const Matrix& matrix, bool fullRange, int y, int u, int v)
+{
+  const double kr = matrix.kr;
+  const double kb = matrix.kb;
+  const double kg = 1.0 - kr - kb;
+  const double luma = fullRange ? y : (y - 16) * 255.0 / 219;
+  const double cb = (u - 128) * (fullRange ? 1.0 : 255.0 / 224);
+  const double cr = (v - 128) * (fullRange ? 1.0 : 255.0 / 224);
+  return {Clamp(luma + 2.0 * (1.0 - kb) * cb),
+          Clamp(luma - 2.0 * (1.0 - kb) * kb / kg * cb - 2.0 * (1.0 - kr) * kr / kg * cr),
+          Clamp(luma + 2.0 * (1.0 - kr) * cr), 255};
+}
+} // unnamed namespace
+
+TEST(TestVideoBufferConverter, IsSupported)
+{
+  EXPECT_TRUE(CVideoBufferConverter::IsSupported(AV_PIX_FMT_YUV420P));
+  EXPECT_TRUE(CVideoBufferConverter::IsSupported(AV_PIX_FMT_YUVJ420P));
+  EXPECT_TRUE(CVideoBufferConverter::IsSupported(AV_PIX_FMT_NV12));
+  EXPECT_TRUE(CVideoBufferConverter::IsSupported(AV_PIX_FMT_P010LE));
+  EXPECT_TRUE(CVideoBufferConverter::IsSupported(AV_PIX_FMT_YUV420P10LE));
+  EXPECT_FALSE(CVideoBufferConverter::IsSupported(AV_PIX_FMT_YUV444P));
+  EXPECT_FALSE(CVideoBufferConverter::IsSupported(AV_PIX_FMT_RGB24));
+
+  CVideoBufferConverter converter;
+  EXPECT_FALSE(
+      converter.Configure(AV_PIX_FMT_YUV444P, 64, 64, AVCOL_SPC_BT709, false, 64, 64));
+  EXPECT_FALSE(converter.Configure(AV_PIX_FMT_YUV420P, 64, 64, AVCOL_SPC_BT709, false, 0, 64));
+}
+
+TEST(TestVideoBufferConverter, ConvertAndScale)
+{
+  const std::array<int, 4> expected = Reference(MATRICES[1], false, Y, U, V);
+
+  for (AVPixelFormat format : {AV_PIX_FMT_YUV420P, AV_PIX_FMT_NV12, AV_PIX_FMT_P010LE,
+                               AV_PIX_FMT_YUV420P10LE})
+  {
+    // odd sizes exercise the scalar tails of the simd kernels
+    for (const auto& [width, height, dstWidth, dstHeight] :
+         std::vector<std::tuple<int, int, int, int>>{
+             {64, 64, 64, 64}, {33, 17, 33, 17}, {1920, 64, 97, 9}, {64, 17, 20, 40}})
+    {
+      Picture picture(format, width, height);
+      CVideoBufferConverter converter;
+      ASSERT_TRUE(converter.Configure(format, width, height, AVCOL_SPC_BT709, false, dstWidth,
+                                      dstHeight));
+
+      std::vector<uint8_t> dst(dstWidth * dstHeight * 4);
+      ASSERT_TRUE(converter.Convert(picture.planes, picture.strides, dst.data(), dstWidth * 4));
+
+      for (int i = 0; i < dstWidth * dstHeight; ++i)
+      {
+        for (int c = 0; c < 4; ++c)
+          ASSERT_NEAR(expected[c], dst[i * 4 + c], 1)
+              << "format " << format << " size " << width << "x" << height << " pixel " << i;
+      }
+    }
+  }
+}
+
+TEST(TestVideoBufferConverter, ColorSweep)
+{
+  constexpr int STEP = 5;
+  std::vector<uint8_t> y;
+  std::vector<uint8_t> u;
+  std::vector<uint8_t> v;
+  for (int luma = 0; luma < 256; ++luma)
+  {
+    for (int cb = 0; cb < 256; cb += STEP)
+    {
+      for (int cr = 0; cr < 256; cr += STEP)
+      {
+        y.push_back(luma);
+        u.push_back(cb);
+        v.push_back(cr);
+      }
+    }
+  }
+  const int width = static_cast<int>(y.size());
+  std::vector<uint8_t> dst(width * 4);
+
+  for (const Matrix& matrix : MATRICES)
+  {
+    for (bool fullRange : {false, true})
+    {
+      const auto coefficients =
+          CVideoBufferConverter::GetCoefficients(matrix.colorSpace, fullRange);
+      CVideoBufferConverter::ConvertRow(y.data(), u.data(), v.data(), dst.data(), width,
+                                        coefficients);
+
+      for (int i = 0; i < width; ++i)
+      {
+        const std::array<int, 4> expected = Reference(matrix, fullRange, y[i], u[i], v[i]);
+        for (int c = 0; c < 4; ++c)
+          ASSERT_NEAR(expected[c], dst[i * 4 + c], 1)
+              << "matrix " << matrix.colorSpace << " full range " << fullRange << " yuv "
+              << int{y[i]} << " " << int{u[i]} << " " << int{v[i]} << " component " << c;
+      }
+    }
+  }
+}
+
+TEST(TestVideoBufferConverter, SimdMatchesScalar)
+{
+  // odd width for the scalar tails
+  constexpr int WIDTH = 1027;
+  std::mt19937 random(0);
+  std::uniform_int_distribution<int> sample(0, 255);
+  std::vector<uint8_t> planes[3];
+  for (auto& plane : planes)
+  {
+    plane.resize(WIDTH);
+    for (auto& value : plane)
+      value = static_cast<uint8_t>(sample(random));
+    // the extremes
+    plane[0] = 0;
+    plane[1] = 255;
+  }
+  std::vector<uint8_t> simd(WIDTH * 4);
+  std::vector<uint8_t> scalar(WIDTH * 4);
+
+  for (const Matrix& matrix : MATRICES)
+  {
+    for (bool fullRange : {false, true})
+    {
+      const auto coefficients =
+          CVideoBufferConverter::GetCoefficients(matrix.colorSpace, fullRange);
+      CVideoBufferConverter::ConvertRow(planes[0].data(), planes[1].data(), planes[2].data(),
+                                        simd.data(), WIDTH, coefficients);
+      CVideoBufferConverter::ConvertRowC(planes[0].data(), planes[1].data(), planes[2].data(),
+                                         scalar.data(), WIDTH, coefficients);
+      EXPECT_EQ(scalar, simd) << "matrix " << matrix.colorSpace << " full range " << fullRange;
+    }
+  }
+}
+
+TEST(TestVideoBufferConverter, GradientAndCheckerboard)
+{
+  constexpr int WIDTH = 64;
+  constexpr int HEIGHT = 32;
+  const Matrix& matrix = MATRICES[1];
+
+  for (AVPixelFormat format : {AV_PIX_FMT_YUV420P, AV_PIX_FMT_NV12, AV_PIX_FMT_P010LE,
+                               AV_PIX_FMT_YUV420P10LE})
+  {
+    for (bool fullRange : {false, true})
+    {
+      const int black = fullRange ? 0 : 16;
+      const int white = fullRange ? 255 : 235;
+      const std::vector<std::function<int(int, int)>> patterns{
+          [&](int x, int y) { return black + (white - black) * x / (WIDTH - 1); },
+          [&](int x, int y) { return (x / 4 + y / 4) % 2 ? white : black; }};
+
+      for (const auto& [u, v] : std::vector<std::pair<int, int>>{
+               {128, 128}, {16, 240}, {240, 16}, {U, V}, {0, 255}})
+      {
+        for (size_t pattern = 0; pattern < patterns.size(); ++pattern)
+        {
+          Picture picture(format, WIDTH, HEIGHT, u, v);
+          picture.FillLuma(patterns[pattern]);
+          CVideoBufferConverter converter;
+          ASSERT_TRUE(converter.Configure(format, WIDTH, HEIGHT, matrix.colorSpace, fullRange,
+                                          WIDTH, HEIGHT));
+
+          std::vector<uint8_t> dst(WIDTH * HEIGHT * 4);
+          ASSERT_TRUE(converter.Convert(picture.planes, picture.strides, dst.data(), WIDTH * 4));
+
+          for (int y = 0; y < HEIGHT; ++y)
+          {
+            for (int x = 0; x < WIDTH; ++x)
+            {
+              const std::array<int, 4> expected =
+                  Reference(matrix, fullRange, patterns[pattern](x, y), u, v);
+              for (int c = 0; c < 4; ++c)
+                ASSERT_NEAR(expected[c], dst[(y * WIDTH + x) * 4 + c], 1)
+                    << "format " << format << " full range " << fullRange << " pattern "
+                    << pattern << " chroma " << u << " " << v << " pixel " << x << "," << y;
+            }
+          }
+        }
+      }
+    }
+  }
+}
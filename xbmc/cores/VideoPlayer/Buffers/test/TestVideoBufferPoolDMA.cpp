@@ -0,0 +1,156 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/VideoPlayer/Buffers/VideoBufferDMA.h"
+#include "cores/VideoPlayer/Buffers/VideoBufferPoolDMA.h"
+#include "utils/BufferObjectFactory.h"
+#include "utils/DMAHeapBufferObject.h"
+
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include <drm_fourcc.h>
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include <libavutil/buffer.h>
+#include <libavutil/frame.h>
+#include <libavutil/imgutils.h>
+}
+
+namespace
+{
+constexpr int WIDTH = 64;
+constexpr int HEIGHT = 32;
+} // unnamed namespace
+
+class TestVideoBufferPoolDMA : public ::testing::Test
+{
+protected:
+  static void SetUpTestSuite() { CDMAHeapBufferObject::Register(); }
+
+  void SetUp() override
+  {
+    if (!CBufferObjectFactory::CreateBufferObject(true))
+      GTEST_SKIP() << "no dma heap available";
+
+    m_size = av_image_get_buffer_size(AV_PIX_FMT_YUV420P, WIDTH, HEIGHT, 1);
+    m_pool->Configure(AV_PIX_FMT_YUV420P, m_size);
+  }
+
+  std::shared_ptr<CVideoBufferPoolDMA> m_pool{std::make_shared<CVideoBufferPoolDMA>()};
+  int m_size{0};
+};
+
+TEST_F(TestVideoBufferPoolDMA, Configure)
+{
+  EXPECT_TRUE(m_pool->IsConfigured());
+  EXPECT_TRUE(m_pool->IsCompatible(AV_PIX_FMT_YUVJ420P, m_size));
+  EXPECT_FALSE(m_pool->IsCompatible(AV_PIX_FMT_YUV444P, m_size));
+  EXPECT_FALSE(m_pool->IsCompatible(AV_PIX_FMT_YUV420P, m_size * 2));
+}
+
+TEST_F(TestVideoBufferPoolDMA, DecodeWithoutCopy)
+{
+  const uint64_t copiedPictures = CVideoBuffer::GetCopiedPictures();
+
+  // the reference of the pool is owned by the frame, like in get_buffer2 of the decoder
+  auto buffer = dynamic_cast<CVideoBufferDMA*>(m_pool->Get());
+  ASSERT_NE(nullptr, buffer);
+
+  AVFrame* frame = av_frame_alloc();
+  frame->format = AV_PIX_FMT_YUV420P;
+  frame->width = WIDTH;
+  frame->height = HEIGHT;
+  ASSERT_TRUE(buffer->Attach(frame, WIDTH, HEIGHT));
+  EXPECT_EQ(buffer, frame->opaque);
+  EXPECT_EQ(buffer, av_buffer_get_opaque(frame->buf[0]));
+  for (int plane = 0; plane < YuvImage::MAX_PLANES; ++plane)
+    memset(frame->data[plane], plane + 1, frame->linesize[plane] * (plane ? HEIGHT / 2 : HEIGHT));
+
+  // hand the picture to the renderer
+  buffer->Acquire();
+  buffer->SyncEnd();
+  buffer->SetDimensions(WIDTH, HEIGHT);
+
+  uint8_t* planes[YuvImage::MAX_PLANES];
+  int strides[YuvImage::MAX_PLANES];
+  buffer->GetPlanes(planes);
+  buffer->GetStrides(strides);
+  for (int plane = 0; plane < YuvImage::MAX_PLANES; ++plane)
+  {
+    EXPECT_EQ(frame->data[plane], planes[plane]);
+    EXPECT_EQ(frame->linesize[plane], strides[plane]);
+    EXPECT_EQ(plane + 1, planes[plane][0]);
+  }
+
+  const AVDRMFrameDescriptor* descriptor = buffer->GetDescriptor();
+  EXPECT_EQ(1, descriptor->nb_objects);
+  EXPECT_GE(descriptor->objects[0].fd, 0);
+  EXPECT_EQ(DRM_FORMAT_YUV420, descriptor->layers[0].format);
+  EXPECT_EQ(copiedPictures, CVideoBuffer::GetCopiedPictures());
+
+  // the buffer returns to the pool once the decoder and the renderer are done with it
+  av_frame_free(&frame);
+  buffer->Release();
+  CVideoBuffer* recycled = m_pool->Get();
+  EXPECT_EQ(buffer, recycled);
+  recycled->Release();
+}
+
+TEST_F(TestVideoBufferPoolDMA, DropWithoutRenderer)
+{
+  auto buffer = dynamic_cast<CVideoBufferDMA*>(m_pool->Get());
+  ASSERT_NE(nullptr, buffer);
+
+  AVFrame* frame = av_frame_alloc();
+  frame->format = AV_PIX_FMT_YUV420P;
+  frame->width = WIDTH;
+  frame->height = HEIGHT;
+  ASSERT_TRUE(buffer->Attach(frame, WIDTH, HEIGHT));
+
+  // a dropped frame ends the sync and returns the buffer when the decoder frees it
+  av_frame_free(&frame);
+  CVideoBuffer* recycled = m_pool->Get();
+  EXPECT_EQ(buffer, recycled);
+  recycled->Release();
+}
+
+TEST_F(TestVideoBufferPoolDMA, CountCopies)
+{
+  CVideoBuffer* buffer = m_pool->Get();
+  ASSERT_NE(nullptr, buffer);
+
+  // what the renderer does without a dma buffer, the picture is copied into its textures
+  std::vector<uint8_t> data(m_size);
+  YuvImage src{};
+  YuvImage dst{};
+  src.plane[0] = buffer->GetMemPtr();
+  dst.plane[0] = data.data();
+  for (YuvImage* image : {&src, &dst})
+  {
+    image->plane[1] = image->plane[0] + WIDTH * HEIGHT;
+    image->plane[2] = image->plane[1] + WIDTH * HEIGHT / 4;
+    image->stride[0] = WIDTH;
+    image->stride[1] = image->stride[2] = WIDTH / 2;
+    image->width = WIDTH;
+    image->height = HEIGHT;
+    image->cshift_x = image->cshift_y = 1;
+    image->bpp = 1;
+  }
+
+  const uint64_t copiedPictures = CVideoBuffer::GetCopiedPictures();
+  const uint64_t copiedBytes = CVideoBuffer::GetCopiedBytes();
+  EXPECT_TRUE(CVideoBuffer::CopyPicture(&dst, &src));
+  EXPECT_EQ(copiedPictures + 1, CVideoBuffer::GetCopiedPictures());
+  EXPECT_EQ(copiedBytes + m_size, CVideoBuffer::GetCopiedBytes());
+
+  buffer->Release();
+}
@@ -13,6 +13,9 @@
 #include "DVDStreamInfo.h"
 #include "ServiceBroker.h"
 #include "cores/FFmpeg.h"
+#if defined(HAVE_GBM) || defined(HAVE_WAYLAND)
+#include "cores/VideoPlayer/Buffers/VideoBufferDMA.h"
+#endif
 #include "cores/VideoPlayer/Interface/TimingConstants.h"
 #include "cores/VideoPlayer/VideoRenderers/RenderManager.h"
 #include "cores/VideoSettings.h"
@@ -31,6 +34,7 @@ extern "C" {
 #include <libavfilter/avfilter.h>
 #include <libavfilter/buffersink.h>
 #include <libavfilter/buffersrc.h>
+#include <libavutil/imgutils.h>
 #include <libavutil/mastering_display_metadata.h>
 #include <libavutil/opt.h>
 #include <libavutil/pixdesc.h>
@@ -120,6 +124,49 @@ void CVideoBufferFFmpeg::Unref()
 
 //------------------------------------------------------------------------------
 
+#if defined(HAVE_GBM) || defined(HAVE_WAYLAND)
+namespace
+{
+// the tail padding of the buffers of avcodec_default_get_buffer2, 16 + STRIDE_ALIGN - 1 with the
+// largest STRIDE_ALIGN of libavcodec. simd code of the decoders reads and writes past the last line.
+constexpr int BUFFER_PADDING_DMA = 16 + 64 - 1;
+
+// the dma buffer a frame was decoded into, frames of the filters are allocated by ffmpeg
+CVideoBufferDMA* GetBufferDMA(const AVFrame* frame)
+{
+  if (!frame->opaque || !frame->buf[0] || av_buffer_get_opaque(frame->buf[0]) != frame->opaque)
+    return nullptr;
+
+  return static_cast<CVideoBufferDMA*>(frame->opaque);
+}
+
+int GetBufferSizeDMA(AVCodecContext* avctx, AVPixelFormat format, int& width, int& height)
+{
+  int stride_align[AV_NUM_DATA_POINTERS];
+  avcodec_align_dimensions2(avctx, &width, &height, stride_align);
+
+  // increase the alignment of the width until all planes are aligned, the buffer is exported with
+  // linesizes derived from the width
+  int linesize[4];
+  int unaligned;
+  do
+  {
+    av_image_fill_linesizes(linesize, format, width);
+    unaligned = 0;
+    for (int i = 0; i < 4; i++)
+      unaligned |= linesize[i] % stride_align[i];
+    if (unaligned)
+      width += width & ~(width - 1);
+  } while (unaligned);
+
+  const int size = av_image_get_buffer_size(format, width, height, 1);
+  return size < 0 ? size : size + BUFFER_PADDING_DMA;
+}
+} // unnamed namespace
+#endif
+
+//------------------------------------------------------------------------------
+
 class CVideoBufferPoolFFmpeg : public IVideoBufferPool
 {
 public:
@@ -271,7 +318,7 @@ enum AVPixelFormat CDVDVideoCodecFFmpeg::GetFormat(struct AVCodecContext * avctx
   if (ctx->HasHardware())
   {
     ctx->SetHardware(nullptr);
-    avctx->get_buffer2 = avcodec_default_get_buffer2;
+    avctx->get_buffer2 = GetBuffer;
     avctx->slice_flags = 0;
     av_buffer_unref(&avctx->hw_frames_ctx);
   }
@@ -305,6 +352,59 @@ enum AVPixelFormat CDVDVideoCodecFFmpeg::GetFormat(struct AVCodecContext * avctx
   return avcodec_default_get_format(avctx, fmt);
 }
 
+int CDVDVideoCodecFFmpeg::GetBuffer(struct AVCodecContext* avctx, AVFrame* frame, int flags)
+{
+#if defined(HAVE_GBM) || defined(HAVE_WAYLAND)
+  ICallbackHWAccel* cb = static_cast<ICallbackHWAccel*>(avctx->opaque);
+  CDVDVideoCodecFFmpeg* ctx = dynamic_cast<CDVDVideoCodecFFmpeg*>(cb);
+
+  // decode straight into dma buffers which the renderer imports, saves the copy of every picture
+  // into the textures. libpostproc can't process them and decoders without direct rendering
+  // require the buffers of libavcodec.
+  if (ctx->m_dmaUpload && !ctx->m_processInfo.GetVideoSettings().m_PostProcess &&
+      (avctx->codec->capabilities & AV_CODEC_CAP_DR1))
+  {
+    const AVPixelFormat format = static_cast<AVPixelFormat>(frame->format);
+    switch (format)
+    {
+      case AV_PIX_FMT_YUV420P:
+      case AV_PIX_FMT_YUVJ420P:
+      case AV_PIX_FMT_YUV422P:
+      case AV_PIX_FMT_YUVJ422P:
+      case AV_PIX_FMT_YUV444P:
+      case AV_PIX_FMT_YUVJ444P:
+      {
+        int width = frame->width;
+        int height = frame->height;
+        const int size = GetBufferSizeDMA(avctx, format, width, height);
+        if (size < 0)
+          break;
+
+        // the buffer manager falls back to system memory buffers without a dma pool
+        CVideoBuffer* videoBuffer =
+            ctx->m_processInfo.GetVideoBufferManager().Get(format, size, nullptr);
+        auto buffer = dynamic_cast<CVideoBufferDMA*>(videoBuffer);
+        if (!buffer)
+        {
+          if (videoBuffer)
+            videoBuffer->Release();
+          break;
+        }
+
+        if (!buffer->Attach(frame, width, height))
+          return AVERROR(ENOMEM);
+
+        return 0;
+      }
+      default:
+        break;
+    }
+  }
+#endif
+
+  return avcodec_default_get_buffer2(avctx, frame, flags);
+}
+
 CDVDVideoCodecFFmpeg::CDVDVideoCodecFFmpeg(CProcessInfo& processInfo)
   : CDVDVideoCodec(processInfo),
     m_videoBufferPool(std::make_shared<CVideoBufferPoolFFmpeg>()),
@@ -328,6 +428,7 @@ bool CDVDVideoCodecFFmpeg::Open(CDVDStreamInfo &hints, CDVDCodecOptions &options
 
   m_hints = hints;
   m_options = options;
+  m_dmaUpload = CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_videoDmaUpload;
 
   const AVCodec* pCodec = nullptr;
 
@@ -368,6 +469,7 @@ bool CDVDVideoCodecFFmpeg::Open(CDVDStreamInfo &hints, CDVDCodecOptions &options
   m_pCodecContext->debug = 0;
   m_pCodecContext->workaround_bugs = FF_BUG_AUTODETECT;
   m_pCodecContext->get_format = GetFormat;
+  m_pCodecContext->get_buffer2 = GetBuffer;
   m_pCodecContext->codec_tag = hints.codec_tag;
 
 #if LIBAVCODEC_VERSION_MAJOR >= 60
@@ -912,6 +1014,20 @@ bool CDVDVideoCodecFFmpeg::SetPictureParams(VideoPicture* pVideoPicture)
     pVideoPicture->videoBuffer->Release();
   pVideoPicture->videoBuffer = nullptr;
 
+#if defined(HAVE_GBM) || defined(HAVE_WAYLAND)
+  CVideoBufferDMA* bufferDMA = GetBufferDMA(m_pFrame);
+  if (bufferDMA)
+  {
+    bufferDMA->SetPictureParams(*pVideoPicture);
+    bufferDMA->Acquire();
+    bufferDMA->SyncEnd();
+    bufferDMA->SetDimensions(m_pFrame->width, m_pFrame->height);
+    pVideoPicture->videoBuffer = bufferDMA;
+    av_frame_unref(m_pFrame);
+    return true;
+  }
+#endif
+
   CVideoBufferFFmpeg *buffer = dynamic_cast<CVideoBufferFFmpeg*>(m_videoBufferPool->Get());
   buffer->SetRef(m_pFrame);
   pVideoPicture->videoBuffer = buffer;
@@ -29,6 +29,7 @@
 #ifdef HAVE_LIBBLURAY
 #include "DVDInputStreams/DVDInputStreamBluray.h"
 #endif
+#include "Buffers/VideoBufferConverter.h"
 #include "DVDCodecs/DVDFactoryCodec.h"
 #include "DVDCodecs/Video/DVDVideoCodec.h"
 #include "DVDCodecs/Video/DVDVideoCodecFFmpeg.h"
@@ -218,9 +219,26 @@ std::unique_ptr<CTexture> CDVDFileInfo::ExtractThumbToTexture(const CFileItem& f
 
           result = CTexture::CreateTexture(nWidth, nHeight);
           result->SetAlpha(false);
-          struct SwsContext* context =
-              sws_getContext(picture.iWidth, picture.iHeight, AV_PIX_FMT_YUV420P, nWidth, nHeight,
-                             AV_PIX_FMT_BGRA, SWS_FAST_BILINEAR, NULL, NULL, NULL);
+
+          CVideoBufferConverter converter;
+          struct SwsContext* context = nullptr;
+          if (converter.Configure(picture.videoBuffer->GetFormat(), picture.iWidth,
+                                  picture.iHeight, picture.color_space, picture.color_range == 1,
+                                  nWidth, nHeight))
+          {
+            result->SetOrientation(DegreeToOrientation(hint.orientation));
+            if (!converter.Convert(*picture.videoBuffer, result->GetPixels(), result->GetPitch()))
+            {
+              CLog::LogF(LOGERROR, "failed to convert the picture of {}", redactPath);
+              result.reset();
+            }
+          }
+          else
+          {
+            context =
+                sws_getContext(picture.iWidth, picture.iHeight, AV_PIX_FMT_YUV420P, nWidth,
+                               nHeight, AV_PIX_FMT_BGRA, SWS_FAST_BILINEAR, NULL, NULL, NULL);
+          }
 
           if (context)
           {
@@ -25,6 +25,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <limits>
 #include <mutex>
 
 using namespace KODI::SUBTITLES::STYLE;
@@ -36,6 +37,9 @@ constexpr int ASS_BORDER_STYLE_OUTLINE = 1; // Outline + drop shadow
 constexpr int ASS_BORDER_STYLE_BOX = 3; // Box + drop shadow
 constexpr int ASS_BORDER_STYLE_SQUARE_BOX = 4; // Square box + outline
 
+// number of changes remembered for HasChanged(), older changes invalidate everything
+constexpr size_t MAX_TRACKED_CHANGES = 256;
+
 // Convert RGB/ARGB to RGBA by also applying the opacity value
 COLOR::Color ConvColor(COLOR::Color argbColor, int opacity = 100)
 {
@@ -165,6 +169,7 @@ bool CDVDSubtitlesLibass::DecodeHeader(char* data, int size)
   m_track = ass_new_track(m_library);
 
   ass_process_codec_private(m_track, data, size);
+  MarkChanged();
   return true;
 }
 
@@ -180,6 +185,7 @@ bool CDVDSubtitlesLibass::DecodeDemuxPkt(const char* data, int size, double star
   //! @bug libass isn't const correct
   ass_process_chunk(m_track, const_cast<char*>(data), size, DVD_TIME_TO_MSEC(start),
                     DVD_TIME_TO_MSEC(duration));
+  MarkChanged(start, start + duration);
   return true;
 }
 
@@ -211,6 +217,7 @@ bool CDVDSubtitlesLibass::CreateTrack()
   if (ass_track_set_feature(m_track, ASS_FEATURE_BIDI_BRACKETS, 1) != 0)
     CLog::LogF(LOGWARNING, "ASS track ASS_FEATURE_BIDI_BRACKETS feature cannot be set");
 
+  MarkChanged();
   return true;
 }
 
@@ -230,6 +237,7 @@ bool CDVDSubtitlesLibass::CreateStyle()
   }
 
   m_defaultKodiStyleId = ass_alloc_style(m_track);
+  MarkChanged();
   return true;
 }
 
@@ -248,6 +256,7 @@ bool CDVDSubtitlesLibass::CreateTrack(char* buf, size_t size)
   if (m_track == NULL)
     return false;
 
+  MarkChanged();
   return true;
 }
 
@@ -661,6 +670,7 @@ int CDVDSubtitlesLibass::AddEvent(const char* text,
       event->MarginR = opts->marginRight;
       event->MarginV = opts->marginVertical;
     }
+    MarkChanged(startTime, stopTime);
     return eventId;
   }
   else
@@ -697,6 +707,8 @@ void CDVDSubtitlesLibass::AppendTextToEvent(int eventId, const char* text)
     free(assEvent->Text);
     assEvent->Text = strdup(appendedText);
     delete[] appendedText;
+    MarkChanged(DVD_MSEC_TO_TIME(assEvent->Start),
+                DVD_MSEC_TO_TIME(assEvent->Start + assEvent->Duration));
   }
 }
 
@@ -721,7 +733,11 @@ void CDVDSubtitlesLibass::ChangeEventStopTime(int eventId, double stopTime)
 
   ASS_Event* assEvent = (assEvents + eventId);
   if (assEvent)
+  {
+    const double oldStopTime = DVD_MSEC_TO_TIME(assEvent->Start + assEvent->Duration);
     assEvent->Duration = (DVD_TIME_TO_MSEC(stopTime) - assEvent->Start);
+    MarkChanged(std::min(oldStopTime, stopTime), std::max(oldStopTime, stopTime));
+  }
 }
 
 void CDVDSubtitlesLibass::FlushEvents()
@@ -734,6 +750,7 @@ void CDVDSubtitlesLibass::FlushEvents()
   }
 
   ass_flush_events(m_track);
+  MarkChanged();
 }
 
 int CDVDSubtitlesLibass::DeleteEvents(int nEvents, int threshold)
@@ -758,9 +775,47 @@ int CDVDSubtitlesLibass::DeleteEvents(int nEvents, int threshold)
     ass_free_event(m_track, n);
     m_track->n_events--;
   }
+  MarkChanged();
   for (int i = 0; n > 0 && i < threshold; i++)
   {
     m_track->events[i] = m_track->events[i + n];
   }
   return m_track->n_events - 1;
 }
+
+uint64_t CDVDSubtitlesLibass::GetChangeCount() const
+{
+  std::unique_lock lock(m_section);
+  return m_changeCount;
+}
+
+bool CDVDSubtitlesLibass::HasChanged(uint64_t changeCount, double startTime, double stopTime) const
+{
+  std::unique_lock lock(m_section);
+  if (changeCount == m_changeCount)
+    return false;
+
+  // changes older than the remembered ones could have touched any time
+  if (m_changes.empty() || m_changes.front().m_changeCount > changeCount + 1)
+    return true;
+
+  return std::ranges::any_of(m_changes,
+                             [&](const Change& change)
+                             {
+                               return change.m_changeCount > changeCount &&
+                                      change.m_startTime <= stopTime &&
+                                      change.m_stopTime >= startTime;
+                             });
+}
+
+void CDVDSubtitlesLibass::MarkChanged(double startTime, double stopTime)
+{
+  m_changes.push_back({++m_changeCount, startTime, stopTime});
+  if (m_changes.size() > MAX_TRACKED_CHANGES)
+    m_changes.pop_front();
+}
+
+void CDVDSubtitlesLibass::MarkChanged()
+{
+  MarkChanged(std::numeric_limits<double>::lowest(), std::numeric_limits<double>::max());
+}
@@ -12,6 +12,8 @@
 #include "threads/CriticalSection.h"
 #include "utils/ColorUtils.h"
 
+#include <cstdint>
+#include <deque>
 #include <memory>
 
 #include <ass/ass.h>
@@ -83,6 +85,24 @@ public:
   */
   int GetPlayResY();
 
+  /*!
+  * \brief Get a counter that is increased whenever the track or its events
+  * change
+  * \return The current change count
+  */
+  uint64_t GetChangeCount() const;
+
+  /*!
+  * \brief Check whether the subtitles shown between startTime and stopTime
+  * may have changed since GetChangeCount() returned changeCount, e.g. to
+  * validate images rendered ahead of time
+  * \param changeCount The change count when the images were rendered
+  * \param startTime The PTS start time of the images
+  * \param stopTime The PTS stop time of the images
+  * \return True if the images have to be rendered again, otherwise false
+  */
+  bool HasChanged(uint64_t changeCount, double startTime, double stopTime) const;
+
 protected:
   /*!
   * \brief Create a new empty ASS track
@@ -154,6 +174,24 @@ private:
   void ApplyStyle(const std::shared_ptr<struct KODI::SUBTITLES::STYLE::style>& subStyle,
                   const KODI::SUBTITLES::STYLE::renderOpts& opts);
 
+  /*!
+  * \brief Record a change of the events shown between startTime and stopTime,
+  * m_section must be locked
+  */
+  void MarkChanged(double startTime, double stopTime);
+
+  /*!
+  * \brief Record a change of the whole track, m_section must be locked
+  */
+  void MarkChanged();
+
+  struct Change
+  {
+    uint64_t m_changeCount;
+    double m_startTime;
+    double m_stopTime;
+  };
+
   ASS_Library* m_library = nullptr;
   ASS_Track* m_track = nullptr;
   ASS_Renderer* m_renderer = nullptr;
@@ -166,4 +204,8 @@ private:
   // default allocated style ID for the kodi user configured subtitle style
   int m_defaultKodiStyleId{ASS_NO_ID};
   std::string m_defaultFontFamilyName;
+
+  // the most recent changes, to invalidate only the images rendered for their times
+  std::deque<Change> m_changes;
+  uint64_t m_changeCount{0};
 };
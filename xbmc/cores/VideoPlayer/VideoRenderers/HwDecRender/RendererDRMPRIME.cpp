@@ -12,7 +12,7 @@
 #include "cores/VideoPlayer/Buffers/VideoBufferDRMPRIME.h"
 #include "cores/VideoPlayer/DVDCodecs/Video/DVDVideoCodec.h"
 #include "cores/VideoPlayer/VideoRenderers/HwDecRender/VideoLayerBridgeDRMPRIME.h"
-#include "cores/VideoPlayer/VideoRenderers/RenderCapture.h"
+#include "cores/VideoPlayer/VideoRenderers/RenderCaptureSoftware.h"
 #include "cores/VideoPlayer/VideoRenderers/RenderFactory.h"
 #include "cores/VideoPlayer/VideoRenderers/RenderFlags.h"
 #include "settings/DisplaySettings.h"
@@ -24,6 +24,8 @@
 #include "windowing/gbm/WinSystemGbm.h"
 #include "windowing/gbm/drm/DRMAtomic.h"
 
+#include <drm_fourcc.h>
+
 using namespace KODI::WINDOWING::GBM;
 
 const std::string SETTING_VIDEOPLAYER_USEPRIMERENDERER = "videoplayer.useprimerenderer";
@@ -231,11 +233,39 @@ void CRendererDRMPRIME::RenderUpdate(
 
 bool CRendererDRMPRIME::RenderCapture(int index, CRenderCapture* capture)
 {
-  capture->BeginRender();
-  capture->EndRender();
+  // the planes are scanned out directly, only pictures mapped by the cpu can be captured
+  auto buffer = dynamic_cast<CVideoBufferDRMPRIME*>(m_buffers[index].videoBuffer);
+  if (!buffer || !buffer->GetMemPtr())
+    return false;
+
+  AVPixelFormat format;
+  switch (buffer->GetDescriptor()->layers[0].format)
+  {
+    case DRM_FORMAT_YUV420:
+      format = AV_PIX_FMT_YUV420P;
+      break;
+    case DRM_FORMAT_NV12:
+      format = AV_PIX_FMT_NV12;
+      break;
+    case DRM_FORMAT_P010:
+      format = AV_PIX_FMT_P010LE;
+      break;
+    default:
+      return false;
+  }
+
+  auto softwareCapture = static_cast<CRenderCaptureSoftware*>(capture);
+  softwareCapture->BeginRender();
+  softwareCapture->Capture(*buffer, format, buffer->GetPicture());
+  softwareCapture->EndRender();
   return true;
 }
 
+CRenderCapture* CRendererDRMPRIME::GetRenderCapture()
+{
+  return new CRenderCaptureSoftware;
+}
+
 bool CRendererDRMPRIME::ConfigChanged(const VideoPicture& picture)
 {
   if (picture.videoBuffer->GetFormat() != m_format)
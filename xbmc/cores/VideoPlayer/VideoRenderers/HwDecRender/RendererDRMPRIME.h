@@ -37,6 +37,7 @@ public:
   void RenderUpdate(
       int index, int index2, bool clear, unsigned int flags, unsigned int alpha) override;
   bool RenderCapture(int index, CRenderCapture* capture) override;
+  CRenderCapture* GetRenderCapture() override;
   bool ConfigChanged(const VideoPicture& picture) override;
 
   // Feature support
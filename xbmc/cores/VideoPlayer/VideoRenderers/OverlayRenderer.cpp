@@ -11,15 +11,18 @@
 
 #include "OverlayRendererUtil.h"
 #include "ServiceBroker.h"
+#include "SubtitlePrerenderer.h"
 #include "application/ApplicationComponents.h"
 #include "application/ApplicationPlayer.h"
 #include "cores/VideoPlayer/DVDCodecs/Overlay/DVDOverlay.h"
 #include "cores/VideoPlayer/DVDCodecs/Overlay/DVDOverlayImage.h"
 #include "cores/VideoPlayer/DVDCodecs/Overlay/DVDOverlayLibass.h"
 #include "cores/VideoPlayer/DVDCodecs/Overlay/DVDOverlaySpu.h"
+#include "settings/AdvancedSettings.h"
 #include "settings/DisplaySettings.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
+#include "utils/StringUtils.h"
 #include "windowing/GraphicContext.h"
 
 #include <algorithm>
@@ -42,6 +45,13 @@ COverlay::COverlay()
 
 COverlay::~COverlay() = default;
 
+std::shared_ptr<COverlay> COverlay::Create(ASS_Image* images, float width, float height)
+{
+  SQuads quads;
+  convert_quad(images, quads, static_cast<int>(width));
+  return Create(quads, width, height);
+}
+
 unsigned int CRenderer::m_textureid = 1;
 
 CRenderer::CRenderer()
@@ -80,6 +90,9 @@ void CRenderer::UnInit()
   }
 
   Flush();
+
+  std::unique_lock lock(m_section);
+  m_prerenderer.reset();
 }
 
 void CRenderer::Flush()
@@ -90,6 +103,8 @@ void CRenderer::Flush()
     Release(buffer);
 
   ReleaseCache();
+  if (m_prerenderer)
+    m_prerenderer->Flush();
   Reset();
 }
 
@@ -508,6 +523,11 @@ std::shared_ptr<COverlay> CRenderer::ConvertLibass(
       rOpts.horizontalAlignment = SUBTITLES::STYLE::HorizontalAlign::CENTER;
   }
 
+  if (m_prerenderer)
+    return m_prerenderer->GetOverlay(o.GetLibassHandler(), pts, rOpts, updateStyle, overlayStyle);
+
+  // rendered on the render thread, e.g. the debug info or with prerendering disabled
+
   // changes: Detect changes from previously rendered images, if > 0 they are changed
   int changes = 0;
   ASS_Image* images =
@@ -553,6 +573,9 @@ std::shared_ptr<COverlay> CRenderer::Convert(CDVDOverlay& o, double pts)
       CreateSubtitlesStyle();
     }
 
+    if (!m_prerenderer &&
+        CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_videoPrerenderSubtitles)
+      m_prerenderer = std::make_unique<CSubtitlePrerenderer>();
     r = ConvertLibass(ovAss, pts, updateStyle, m_overlayStyle);
 
     if (!r)
@@ -583,6 +606,16 @@ std::shared_ptr<COverlay> CRenderer::Convert(CDVDOverlay& o, double pts)
   return r;
 }
 
+std::string CRenderer::GetPrerenderInfo()
+{
+  std::unique_lock lock(m_section);
+  if (!m_prerenderer)
+    return {};
+
+  const CSubtitlePrerenderer::Stats stats = m_prerenderer->GetStats();
+  return StringUtils::Format("subs: ready:{} late:{}", stats.m_hits, stats.m_late);
+}
+
 void CRenderer::Notify(const Observable& obs, const ObservableMessage msg)
 {
   switch (msg)
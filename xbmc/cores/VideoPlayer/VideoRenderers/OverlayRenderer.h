@@ -19,6 +19,7 @@
 #include <atomic>
 #include <map>
 #include <memory>
+#include <string>
 #include <vector>
 
 typedef struct ass_image ASS_Image;
@@ -32,6 +33,9 @@ class CDVDOverlayText;
 
 namespace OVERLAY {
 
+  class CSubtitlePrerenderer;
+  struct SQuads;
+
   struct SRenderState
   {
     float x;
@@ -46,6 +50,7 @@ namespace OVERLAY {
     static std::shared_ptr<COverlay> Create(const CDVDOverlayImage& o, CRect& rSource);
     static std::shared_ptr<COverlay> Create(const CDVDOverlaySpu& o);
     static std::shared_ptr<COverlay> Create(ASS_Image* images, float width, float height);
+    static std::shared_ptr<COverlay> Create(const SQuads& quads, float width, float height);
 
     COverlay();
     virtual ~COverlay();
@@ -126,6 +131,12 @@ namespace OVERLAY {
      */
     void SetSubtitleVerticalPosition(const int value, bool save);
 
+    /*!
+     * \brief Get the statistics of the subtitle pre-rendering for the debug info
+     * \return The statistics, empty if no subtitles have been pre-rendered
+     */
+    std::string GetPrerenderInfo();
+
   protected:
     /*!
      * \brief Reset the subtitle position to default value
@@ -197,5 +208,9 @@ namespace OVERLAY {
 
     std::shared_ptr<struct KODI::SUBTITLES::STYLE::style> m_overlayStyle;
     std::atomic<bool> m_isSettingsChanged{false};
+
+    // renders the libass subtitles ahead of time, only used for the player's overlays unless
+    // disabled by the prerendersubtitles advanced setting
+    std::unique_ptr<CSubtitlePrerenderer> m_prerenderer;
   };
 }
@@ -61,12 +61,12 @@ static bool LoadTexture(int width, int height, int stride
   return true;
 }
 
-std::shared_ptr<COverlay> COverlay::Create(ASS_Image* images, float width, float height)
+std::shared_ptr<COverlay> COverlay::Create(const SQuads& quads, float width, float height)
 {
-  return std::make_shared<COverlayQuadsDX>(images, width, height);
+  return std::make_shared<COverlayQuadsDX>(quads, width, height);
 }
 
-COverlayQuadsDX::COverlayQuadsDX(ASS_Image* images, float width, float height)
+COverlayQuadsDX::COverlayQuadsDX(const SQuads& quads, float width, float height)
 {
   m_width  = 1.0;
   m_height = 1.0;
@@ -76,8 +76,7 @@ COverlayQuadsDX::COverlayQuadsDX(ASS_Image* images, float width, float height)
   m_y      = 0.0f;
   m_count  = 0;
 
-  SQuads quads;
-  if (!convert_quad(images, quads, static_cast<int>(width)))
+  if (quads.quad.empty())
     return;
 
   float u, v;
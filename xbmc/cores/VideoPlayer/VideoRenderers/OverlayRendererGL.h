@@ -42,7 +42,7 @@ namespace OVERLAY {
   class COverlayGlyphGL : public COverlay
   {
   public:
-    COverlayGlyphGL(ASS_Image* images, float width, float height);
+    COverlayGlyphGL(const SQuads& quads, float width, float height);
 
     ~COverlayGlyphGL() override;
 
@@ -243,12 +243,12 @@ COverlayTextureGLES::COverlayTextureGLES(const CDVDOverlaySpu& o)
   m_pma = !!USE_PREMULTIPLIED_ALPHA;
 }
 
-std::shared_ptr<COverlay> COverlay::Create(ASS_Image* images, float width, float height)
+std::shared_ptr<COverlay> COverlay::Create(const SQuads& quads, float width, float height)
 {
-  return std::make_shared<COverlayGlyphGLES>(images, width, height);
+  return std::make_shared<COverlayGlyphGLES>(quads, width, height);
 }
 
-COverlayGlyphGLES::COverlayGlyphGLES(ASS_Image* images, float width, float height)
+COverlayGlyphGLES::COverlayGlyphGLES(const SQuads& quads, float width, float height)
 {
   m_width = 1.0;
   m_height = 1.0;
@@ -257,8 +257,7 @@ COverlayGlyphGLES::COverlayGlyphGLES(ASS_Image* images, float width, float heigh
   m_x = 0.0f;
   m_y = 0.0f;
 
-  SQuads quads;
-  if (!convert_quad(images, quads, static_cast<int>(width)))
+  if (quads.quad.empty())
     return;
 
   glGenTextures(1, &m_texture);
@@ -0,0 +1,45 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "RenderCaptureSoftware.h"
+
+#include "cores/VideoPlayer/DVDCodecs/Video/DVDVideoCodec.h"
+
+CRenderCaptureSoftware::~CRenderCaptureSoftware()
+{
+  delete[] m_pixels;
+}
+
+void CRenderCaptureSoftware::BeginRender()
+{
+  if (m_bufferSize != m_width * m_height * 4)
+  {
+    delete[] m_pixels;
+    m_bufferSize = m_width * m_height * 4;
+    m_pixels = new uint8_t[m_bufferSize];
+  }
+}
+
+void CRenderCaptureSoftware::EndRender()
+{
+  if (m_state != CAPTURESTATE_FAILED)
+    SetState(CAPTURESTATE_DONE);
+}
+
+bool CRenderCaptureSoftware::Capture(CVideoBuffer& buffer,
+                                     AVPixelFormat format,
+                                     const VideoPicture& picture)
+{
+  if (m_converter.Configure(format, picture.iWidth, picture.iHeight, picture.color_space,
+                            picture.color_range == 1, m_width, m_height) &&
+      m_converter.Convert(buffer, m_pixels, m_width * 4))
+    return true;
+
+  SetState(CAPTURESTATE_FAILED);
+  return false;
+}
@@ -0,0 +1,39 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "RenderCapture.h"
+#include "cores/VideoPlayer/Buffers/VideoBufferConverter.h"
+
+struct VideoPicture;
+
+/*!
+ * \brief Captures pictures by converting them on the cpu, for renderers without a render system
+ * to read back from.
+ */
+class CRenderCaptureSoftware : public CRenderCapture
+{
+public:
+  CRenderCaptureSoftware() = default;
+  ~CRenderCaptureSoftware() override;
+
+  void BeginRender() override;
+  void EndRender() override;
+
+  /*!
+   * \brief Convert a picture into the capture, between BeginRender and EndRender.
+   * \param buffer the buffer of the picture, its planes have to be mapped.
+   * \param format the format of the planes of the buffer.
+   * \param picture the parameters of the picture.
+   */
+  bool Capture(CVideoBuffer& buffer, AVPixelFormat format, const VideoPicture& picture);
+
+private:
+  CVideoBufferConverter m_converter;
+};
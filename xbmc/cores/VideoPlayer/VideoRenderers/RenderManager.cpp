@@ -15,6 +15,7 @@
 #include "RenderFlags.h"
 #include "ServiceBroker.h"
 #include "application/Application.h"
+#include "cores/VideoPlayer/Buffers/VideoBuffer.h"
 #include "cores/VideoPlayer/Interface/TimingConstants.h"
 #include "messaging/ApplicationMessenger.h"
 #include "settings/AdvancedSettings.h"
@@ -756,6 +757,12 @@ void CRenderManager::Render(bool clear, DWORD flags, DWORD alpha, bool gui)
           info.vsync += StringUtils::Format("VSync: refresh:{:.3f} missed:{} speed:{:.3f}%",
                                             refreshrate, missedvblanks, clockspeed * 100);
         }
+        info.vsync += StringUtils::Format("  Copied: pictures:{} MiB:{:.1f}",
+                                          CVideoBuffer::GetCopiedPictures(),
+                                          CVideoBuffer::GetCopiedBytes() / (1024.0 * 1024.0));
+        const std::string subtitles = m_overlays.GetPrerenderInfo();
+        if (!subtitles.empty())
+          info.vsync += "  " + subtitles;
 
         m_debugRenderer.SetInfo(info);
       }
@@ -0,0 +1,327 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "SubtitlePrerenderer.h"
+
+#include "OverlayRenderer.h"
+#include "cores/VideoPlayer/DVDSubtitles/DVDSubtitlesLibass.h"
+#include "cores/VideoPlayer/Interface/TimingConstants.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <mutex>
+
+using namespace KODI;
+using namespace OVERLAY;
+
+namespace
+{
+constexpr int64_t NO_POSITION = std::numeric_limits<int64_t>::min();
+// how far ahead of the playback position the images are rendered
+constexpr int64_t PRERENDER_AHEAD_MS = 1000;
+// the frame duration is averaged over the positions asked for, limited to 10 to 100 fps
+constexpr double DEFAULT_FRAME_DURATION_MS = 40;
+constexpr int64_t MIN_FRAME_DURATION_MS = 10;
+constexpr int64_t MAX_FRAME_DURATION_MS = 100;
+constexpr double FRAME_DURATION_WEIGHT = 0.25;
+// unchanged images are only shared with a frame that close, to not skip short events in between
+constexpr int64_t MAX_SHARE_DISTANCE_MS = MAX_FRAME_DURATION_MS;
+// bounds of the cache
+constexpr size_t MAX_FRAMES = 256;
+constexpr size_t MAX_CACHE_SIZE = 64 * 1024 * 1024;
+constexpr size_t MAX_OVERLAYS = 4;
+
+bool IsSameOptions(const SUBTITLES::STYLE::renderOpts& a, const SUBTITLES::STYLE::renderOpts& b)
+{
+  return a.frameWidth == b.frameWidth && a.frameHeight == b.frameHeight &&
+         a.videoWidth == b.videoWidth && a.videoHeight == b.videoHeight &&
+         a.sourceWidth == b.sourceWidth && a.sourceHeight == b.sourceHeight &&
+         a.m_par == b.m_par && a.marginsMode == b.marginsMode && a.position == b.position &&
+         a.horizontalAlignment == b.horizontalAlignment;
+}
+
+size_t GetSize(const SQuads& quads)
+{
+  return quads.texture.size() + quads.quad.size() * sizeof(SQuad);
+}
+} // unnamed namespace
+
+CSubtitlePrerenderer::CSubtitlePrerenderer()
+  : CThread("SubtitlePrerender"),
+    m_positionMs(NO_POSITION),
+    m_frameDurationMs(DEFAULT_FRAME_DURATION_MS)
+{
+}
+
+CSubtitlePrerenderer::~CSubtitlePrerenderer()
+{
+  StopThread();
+
+  const Stats stats = GetStats();
+  CLog::Log(LOGDEBUG, "CSubtitlePrerenderer: {} hits, {} prerendered, {} late", stats.m_hits,
+            stats.m_prerendered, stats.m_late);
+}
+
+std::shared_ptr<COverlay> CSubtitlePrerenderer::GetOverlay(
+    const std::shared_ptr<CDVDSubtitlesLibass>& libass,
+    double pts,
+    const SUBTITLES::STYLE::renderOpts& opts,
+    bool updateStyle,
+    const std::shared_ptr<struct SUBTITLES::STYLE::style>& style)
+{
+  const int64_t ms = DVD_TIME_TO_MSEC(pts);
+
+  std::shared_ptr<CFrame> frame;
+  bool reset;
+  bool late = false;
+  {
+    std::unique_lock lock(m_cacheSection);
+    reset = updateStyle || libass != m_libass || style != m_style || !IsSameOptions(opts, m_opts);
+    if (!reset)
+    {
+      // average the durations, the positions are rounded to ms and alternate e.g. between 41 and
+      // 42 ms at 23.976 fps
+      if (m_positionMs != NO_POSITION && ms > m_positionMs)
+      {
+        const int64_t duration =
+            std::clamp(ms - m_positionMs, MIN_FRAME_DURATION_MS, MAX_FRAME_DURATION_MS);
+        m_frameDurationMs +=
+            FRAME_DURATION_WEIGHT * (static_cast<double>(duration) - m_frameDurationMs);
+      }
+      late = m_positionMs != NO_POSITION;
+      m_positionMs = ms;
+      TrimFrames(ms);
+      frame = FindFrame(ms);
+    }
+  }
+
+  if (reset)
+  {
+    // keep the worker from rendering with the old style until the new one is applied
+    std::unique_lock renderLock(m_renderSection);
+    uint64_t epoch;
+    {
+      std::unique_lock lock(m_cacheSection);
+      m_libass = libass;
+      m_opts = opts;
+      m_style = style;
+      m_frames.clear();
+      m_cacheSize = 0;
+      m_positionMs = ms;
+      epoch = ++m_epoch;
+    }
+    frame = RenderFrame(libass, ms, opts, updateStyle, style, epoch);
+    InsertFrame(frame, epoch);
+  }
+  else if (frame)
+  {
+    ++m_hits;
+  }
+  else
+  {
+    uint64_t epoch;
+    {
+      std::unique_lock lock(m_cacheSection);
+      epoch = m_epoch;
+    }
+    {
+      std::unique_lock renderLock(m_renderSection);
+      frame = RenderFrame(libass, ms, opts, false, style, epoch);
+    }
+    InsertFrame(frame, epoch);
+    if (late)
+      ++m_late;
+  }
+
+  if (!m_started)
+  {
+    m_started = true;
+    Create();
+  }
+  m_wakeup.Set();
+
+  if (!frame || frame->m_quads.quad.empty())
+    return nullptr;
+
+  const auto it = std::ranges::find_if(m_overlays, [&frame](const auto& overlay)
+                                      { return overlay.first == frame->m_id; });
+  if (it != m_overlays.end())
+    return it->second;
+
+  // only the textures of the images shown now are needed
+  if (m_overlays.size() >= MAX_OVERLAYS)
+    m_overlays.erase(m_overlays.begin());
+  return m_overlays
+      .emplace_back(frame->m_id,
+                    COverlay::Create(frame->m_quads, opts.frameWidth, opts.frameHeight))
+      .second;
+}
+
+void CSubtitlePrerenderer::Flush()
+{
+  std::unique_lock lock(m_cacheSection);
+  m_overlays.clear();
+  m_frames.clear();
+  m_cacheSize = 0;
+  m_positionMs = NO_POSITION;
+  ++m_epoch;
+}
+
+void CSubtitlePrerenderer::Process()
+{
+  while (!m_bStop)
+  {
+    if (AbortableWait(m_wakeup) != WAIT_SIGNALED)
+      break;
+
+    PrerenderAhead();
+  }
+}
+
+void CSubtitlePrerenderer::PrerenderAhead()
+{
+  while (!m_bStop)
+  {
+    std::shared_ptr<CDVDSubtitlesLibass> libass;
+    SUBTITLES::STYLE::renderOpts opts;
+    std::shared_ptr<struct SUBTITLES::STYLE::style> style;
+    uint64_t epoch;
+    int64_t ms;
+    {
+      std::unique_lock lock(m_cacheSection);
+      if (!m_libass || m_positionMs == NO_POSITION || IsFull())
+        return;
+
+      // the first frame ahead which isn't rendered yet
+      int frames = 1;
+      do
+      {
+        ms = m_positionMs + std::llround(frames++ * m_frameDurationMs);
+        if (ms > m_positionMs + PRERENDER_AHEAD_MS)
+          return;
+      } while (FindFrame(ms));
+
+      libass = m_libass;
+      opts = m_opts;
+      style = m_style;
+      epoch = m_epoch;
+    }
+
+    std::shared_ptr<CFrame> frame;
+    {
+      std::unique_lock renderLock(m_renderSection);
+      frame = RenderFrame(libass, ms, opts, false, style, epoch);
+    }
+    InsertFrame(frame, epoch);
+    ++m_prerendered;
+  }
+}
+
+std::shared_ptr<CSubtitlePrerenderer::CFrame> CSubtitlePrerenderer::RenderFrame(
+    const std::shared_ptr<CDVDSubtitlesLibass>& libass,
+    int64_t ms,
+    const SUBTITLES::STYLE::renderOpts& opts,
+    bool updateStyle,
+    const std::shared_ptr<struct SUBTITLES::STYLE::style>& style,
+    uint64_t epoch)
+{
+  const uint64_t changeCount = libass->GetChangeCount();
+  int changes = 0;
+  ASS_Image* images = libass->RenderImage(DVD_MSEC_TO_TIME(static_cast<double>(ms)), opts,
+                                          updateStyle, style, &changes);
+
+  // libass compares with the images it rendered last, share them if nothing changed
+  if (changes == 0 && !updateStyle && m_lastFrame && m_lastEpoch == epoch &&
+      m_lastFrame->m_changeCount == changeCount)
+  {
+    std::unique_lock lock(m_cacheSection);
+    if (ms >= m_lastFrame->m_startMs - MAX_SHARE_DISTANCE_MS &&
+        ms <= m_lastFrame->m_endMs + MAX_SHARE_DISTANCE_MS)
+    {
+      m_lastFrame->m_startMs = std::min(m_lastFrame->m_startMs, ms);
+      m_lastFrame->m_endMs = std::max(m_lastFrame->m_endMs, ms);
+      return m_lastFrame;
+    }
+  }
+
+  auto frame = std::make_shared<CFrame>();
+  frame->m_id = ++m_nextFrameId;
+  frame->m_startMs = ms;
+  frame->m_endMs = ms;
+  frame->m_changeCount = changeCount;
+  convert_quad(images, frame->m_quads, static_cast<int>(opts.frameWidth));
+
+  m_lastFrame = frame;
+  m_lastEpoch = epoch;
+  return frame;
+}
+
+std::shared_ptr<CSubtitlePrerenderer::CFrame> CSubtitlePrerenderer::FindFrame(int64_t ms)
+{
+  // the pts of the frames are rounded to ms and vary around the predicted positions, e.g. by 41 and
+  // 42 ms at 23.976 fps, so a frame also covers half a frame duration around its range
+  const int64_t tolerance = std::llround(m_frameDurationMs / 2);
+  auto nearest = m_frames.end();
+  int64_t nearestDistance = tolerance + 1;
+  for (auto it = m_frames.begin(); it != m_frames.end(); ++it)
+  {
+    const CFrame& frame = **it;
+    const int64_t distance = std::max({frame.m_startMs - ms, ms - frame.m_endMs, int64_t{0}});
+    if (distance < nearestDistance)
+    {
+      nearest = it;
+      nearestDistance = distance;
+    }
+  }
+  if (nearest == m_frames.end())
+    return nullptr;
+
+  // events shown at that time may have been added or changed since
+  const std::shared_ptr<CFrame> frame = *nearest;
+  if (m_libass->HasChanged(frame->m_changeCount,
+                           DVD_MSEC_TO_TIME(static_cast<double>(frame->m_startMs)),
+                           DVD_MSEC_TO_TIME(static_cast<double>(frame->m_endMs))))
+  {
+    m_cacheSize -= GetSize(frame->m_quads);
+    m_frames.erase(nearest);
+    return nullptr;
+  }
+  return frame;
+}
+
+void CSubtitlePrerenderer::InsertFrame(const std::shared_ptr<CFrame>& frame, uint64_t epoch)
+{
+  std::unique_lock lock(m_cacheSection);
+  if (epoch != m_epoch || std::ranges::find(m_frames, frame) != m_frames.end())
+    return;
+
+  m_frames.push_back(frame);
+  m_cacheSize += GetSize(frame->m_quads);
+}
+
+void CSubtitlePrerenderer::TrimFrames(int64_t ms)
+{
+  // drop the frames which have been shown and the ones too far ahead, e.g. after seeking back
+  const int64_t tolerance = std::llround(m_frameDurationMs / 2);
+  std::erase_if(m_frames,
+                [this, ms, tolerance](const std::shared_ptr<CFrame>& frame)
+                {
+                  if (frame->m_endMs + tolerance >= ms &&
+                      frame->m_startMs <= ms + 2 * PRERENDER_AHEAD_MS)
+                    return false;
+                  m_cacheSize -= GetSize(frame->m_quads);
+                  return true;
+                });
+}
+
+bool CSubtitlePrerenderer::IsFull() const
+{
+  return m_frames.size() >= MAX_FRAMES || m_cacheSize >= MAX_CACHE_SIZE;
+}
@@ -0,0 +1,132 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "OverlayRendererUtil.h"
+#include "cores/VideoPlayer/DVDSubtitles/SubtitlesStyle.h"
+#include "threads/CriticalSection.h"
+#include "threads/Event.h"
+#include "threads/Thread.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+class CDVDSubtitlesLibass;
+
+namespace OVERLAY
+{
+class COverlay;
+
+/*!
+ \brief Renders libass subtitles ahead of the playback position on a worker thread.
+
+ ass_render_frame is too slow for heavily typeset tracks to be called on the render thread for
+ every frame. The worker renders the images of the next second and packs them into quads, the
+ render thread only creates the textures of images that are ready. As long as libass reports no
+ changes the images of consecutive frames are shared. Images are only rendered on the render
+ thread after a seek or a style change, or when the worker fell behind, the latter are counted as
+ late.
+ */
+class CSubtitlePrerenderer : private CThread
+{
+public:
+  struct Stats
+  {
+    uint64_t m_hits{0};
+    uint64_t m_late{0}; ///< images that had to be rendered when they were due
+    uint64_t m_prerendered{0};
+  };
+
+  CSubtitlePrerenderer();
+  ~CSubtitlePrerenderer() override;
+
+  /*!
+   \brief Get the overlay showing the subtitles at pts, must be called on the render thread.
+   \param updateStyle true if the style has changed and has to be applied to libass.
+   \return the overlay or nullptr if there is nothing to show.
+   */
+  std::shared_ptr<COverlay> GetOverlay(
+      const std::shared_ptr<CDVDSubtitlesLibass>& libass,
+      double pts,
+      const KODI::SUBTITLES::STYLE::renderOpts& opts,
+      bool updateStyle,
+      const std::shared_ptr<struct KODI::SUBTITLES::STYLE::style>& style);
+
+  /*!
+   \brief Drop all rendered images, e.g. after a seek.
+   */
+  void Flush();
+
+  Stats GetStats() const { return {m_hits, m_late, m_prerendered}; }
+
+protected:
+  void Process() override;
+
+private:
+  // the images shown from m_startMs to m_endMs
+  struct CFrame
+  {
+    uint64_t m_id;
+    int64_t m_startMs;
+    int64_t m_endMs;
+    uint64_t m_changeCount; // of the libass track when the images were rendered
+    SQuads m_quads;
+  };
+
+  /*!
+   \brief Render the images at ms, m_renderSection must be locked.
+   */
+  std::shared_ptr<CFrame> RenderFrame(
+      const std::shared_ptr<CDVDSubtitlesLibass>& libass,
+      int64_t ms,
+      const KODI::SUBTITLES::STYLE::renderOpts& opts,
+      bool updateStyle,
+      const std::shared_ptr<struct KODI::SUBTITLES::STYLE::style>& style,
+      uint64_t epoch);
+  /*!
+   \brief Find the valid images nearest to ms within half a frame duration, m_cacheSection must be
+   locked.
+   */
+  std::shared_ptr<CFrame> FindFrame(int64_t ms);
+  void InsertFrame(const std::shared_ptr<CFrame>& frame, uint64_t epoch);
+  void TrimFrames(int64_t ms);
+  bool IsFull() const;
+  void PrerenderAhead();
+
+  // serialises the rendering, the images returned by libass are only valid until the next call
+  CCriticalSection m_renderSection;
+  std::shared_ptr<CFrame> m_lastFrame;
+  uint64_t m_lastEpoch{0};
+  uint64_t m_nextFrameId{0};
+
+  mutable CCriticalSection m_cacheSection;
+  std::shared_ptr<CDVDSubtitlesLibass> m_libass;
+  KODI::SUBTITLES::STYLE::renderOpts m_opts{};
+  std::shared_ptr<struct KODI::SUBTITLES::STYLE::style> m_style;
+  std::vector<std::shared_ptr<CFrame>> m_frames;
+  size_t m_cacheSize{0};
+  uint64_t m_epoch{0}; // increased whenever the cached frames are dropped
+  int64_t m_positionMs;
+  double m_frameDurationMs;
+
+  // textures of the frames shown last, only created and destroyed on the render thread
+  std::vector<std::pair<uint64_t, std::shared_ptr<COverlay>>> m_overlays;
+
+  CEvent m_wakeup;
+  bool m_started{false};
+
+  std::atomic<uint64_t> m_hits{0};
+  std::atomic<uint64_t> m_late{0};
+  std::atomic<uint64_t> m_prerendered{0};
+};
+
+} // namespace OVERLAY
@@ -20,6 +20,7 @@
 #include "utils/URIUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
 #include <cmath>
 #include <mutex>
 
@@ -62,7 +63,7 @@ void CAudioDecoder::Destroy()
   m_canPlay = false;
 }
 
-bool CAudioDecoder::Create(const CFileItem &file, int64_t seekOffset)
+bool CAudioDecoder::Create(const CFileItem& file, int64_t seekOffset, unsigned int bufferSeconds)
 {
   Destroy();
 
@@ -100,8 +101,8 @@ bool CAudioDecoder::Create(const CFileItem &file, int64_t seekOffset)
     return false;
   }
 
-  /* allocate the pcmBuffer for 2 seconds of audio */
-  m_pcmBuffer.Create(2 * blockSize * m_codec->m_format.m_sampleRate);
+  /* allocate the pcmBuffer for at least 2 seconds of audio, the stream is queued once it is 90% full */
+  m_pcmBuffer.Create(std::max(bufferSeconds, 2u) * blockSize * m_codec->m_format.m_sampleRate);
 
   if (file.HasMusicInfoTag())
   {
@@ -200,6 +201,18 @@ unsigned int CAudioDecoder::GetDataSize(bool checkPktSize)
   }
 }
 
+unsigned int CAudioDecoder::GetBufferedTime()
+{
+  if (!m_codec || m_codec->m_format.m_dataFormat == AE_FMT_RAW)
+    return 0;
+
+  const unsigned int bytesPerSecond =
+      (m_codec->m_bitsPerSample >> 3) * GetChannels() * m_codec->m_format.m_sampleRate;
+  if (!bytesPerSecond)
+    return 0;
+  return static_cast<uint64_t>(m_pcmBuffer.getMaxReadSize()) * 1000 / bytesPerSecond;
+}
+
 void *CAudioDecoder::GetData(unsigned int samples)
 {
   unsigned int size  = samples * (m_codec->m_bitsPerSample >> 3);
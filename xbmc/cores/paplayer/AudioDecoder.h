@@ -43,7 +43,7 @@ public:
   CAudioDecoder();
   ~CAudioDecoder();
 
-  bool Create(const CFileItem &file, int64_t seekOffset);
+  bool Create(const CFileItem& file, int64_t seekOffset, unsigned int bufferSeconds = 2);
   void Destroy();
 
   int ReadSamples(int numsamples);
@@ -60,6 +60,7 @@ public:
   unsigned int GetChannels();
   // Data management
   unsigned int GetDataSize(bool checkPktSize);
+  unsigned int GetBufferedTime(); // decoded audio in ms
   void *GetData(unsigned int samples);
   uint8_t* GetRawData(int &size);
   ICodec *GetCodec() const { return m_codec; }
@@ -30,6 +30,8 @@
 #include "utils/log.h"
 #include "video/Bookmark.h"
 
+#include <algorithm>
+#include <chrono>
 #include <memory>
 #include <mutex>
 
@@ -203,6 +205,8 @@ void PAPlayer::CloseAllStreams(bool fade/* = true */)
 bool PAPlayer::OpenFile(const CFileItem& file, const CPlayerOptions &options)
 {
   m_defaultCrossfadeMS = CServiceBroker::GetSettingsComponent()->GetSettings()->GetInt(CSettings::SETTING_MUSICPLAYER_CROSSFADE) * 1000;
+  m_decodeAheadMS =
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_audioDecodeAhead * 1000;
   m_fullScreen = options.fullscreen;
 
   if (m_streams.size() > 1 || !m_defaultCrossfadeMS || m_isPaused)
@@ -307,6 +311,7 @@ bool PAPlayer::QueueNextFileEx(const CFileItem &file, bool fadeIn)
     m_currentStream->m_nextFileItem.reset();
   }
 
+  const auto start = std::chrono::steady_clock::now();
   StreamInfo *si = new StreamInfo();
   si->m_fileItem = std::make_unique<CFileItem>(file);
 
@@ -325,7 +330,9 @@ bool PAPlayer::QueueNextFileEx(const CFileItem &file, bool fadeIn)
     starttime = 0; // No resume point
   }
 
-  if (!si->m_decoder.Create(file, si->m_startOffset))
+  // a following stream is decoded ahead, the first one starts as soon as possible
+  const unsigned int bufferSeconds = m_currentStream ? m_decodeAheadMS / 1000 : 0;
+  if (!si->m_decoder.Create(file, si->m_startOffset, bufferSeconds))
   {
     CLog::Log(LOGWARNING, "PAPlayer::QueueNextFileEx - Failed to create the decoder");
 
@@ -359,6 +366,7 @@ bool PAPlayer::QueueNextFileEx(const CFileItem &file, bool fadeIn)
     /* yield our time so that the main PAP thread doesn't stall */
     CThread::Sleep(1ms);
   }
+  const unsigned int decodedAhead = si->m_decoder.GetBufferedTime();
 
   // set m_upcomingCrossfadeMS depending on type of file and user settings
   UpdateCrossfadeTime(*si->m_fileItem);
@@ -404,10 +412,7 @@ bool PAPlayer::QueueNextFileEx(const CFileItem &file, bool fadeIn)
   si->m_prepareNextAtFrame = 0;
   // cd drives don't really like it to be crossfaded or prepared
   if (!MUSIC::IsCDDA(file))
-  {
-    if (streamTotalTime >= TIME_TO_CACHE_NEXT_FILE + m_defaultCrossfadeMS)
-      si->m_prepareNextAtFrame = (int)((streamTotalTime - TIME_TO_CACHE_NEXT_FILE - m_defaultCrossfadeMS) * si->m_audioFormat.m_sampleRate / 1000.0f);
-  }
+    si->m_prepareNextAtFrame = GetPrepareNextAtFrame(si, streamTotalTime);
 
   if (m_currentStream && ((m_currentStream->m_audioFormat.m_dataFormat == AE_FMT_RAW) || (si->m_audioFormat.m_dataFormat == AE_FMT_RAW)))
   {
@@ -442,9 +447,44 @@ bool PAPlayer::QueueNextFileEx(const CFileItem &file, bool fadeIn)
   //update the current stream to start playing the next track at the correct frame.
   UpdateStreamInfoPlayNextAtFrame(m_currentStream, m_upcomingCrossfadeMS);
 
+  // report the margin to the transition, a negative one is heard as a gap
+  if (m_currentStream && m_currentStream != si)
+  {
+    StreamInfo* current = m_currentStream;
+    int transitionFrame = current->m_playNextAtFrame;
+    if (!transitionFrame)
+      transitionFrame = (int)(current->m_decoder.TotalTime() *
+                              current->m_audioFormat.m_sampleRate / 1000.0f);
+    const int64_t margin = static_cast<int64_t>(transitionFrame - current->m_framesSent) * 1000 /
+                           current->m_audioFormat.m_sampleRate;
+    const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start);
+    if (margin < 0)
+      CLog::Log(LOGWARNING,
+                "PAPlayer::QueueNextFileEx - Next stream ready {} ms after the transition, "
+                "opening took {} ms",
+                -margin, elapsed.count());
+    else
+      CLog::Log(LOGDEBUG,
+                "PAPlayer::QueueNextFileEx - Next stream ready {} ms before the transition, "
+                "opening took {} ms, {} ms decoded ahead",
+                margin, elapsed.count(), decodedAhead);
+  }
+
   return true;
 }
 
+int PAPlayer::GetPrepareNextAtFrame(const StreamInfo* si, int64_t streamTotalTime) const
+{
+  if (streamTotalTime < TIME_TO_CACHE_NEXT_FILE + m_defaultCrossfadeMS)
+    return 0;
+
+  // open the next stream early enough to decode ahead of the transition
+  const int64_t leadTime = std::min<int64_t>(
+      streamTotalTime, TIME_TO_CACHE_NEXT_FILE + m_decodeAheadMS + m_defaultCrossfadeMS);
+  return std::max(1, (int)((streamTotalTime - leadTime) * si->m_audioFormat.m_sampleRate / 1000.0f));
+}
+
 void PAPlayer::UpdateStreamInfoPlayNextAtFrame(StreamInfo *si, unsigned int crossFadingTime)
 {
   // if no crossfading or cue sheet, wait for eof
@@ -810,9 +850,7 @@ inline bool PAPlayer::ProcessStream(StreamInfo *si, double &freeBufferTime)
         streamTotalTime = si->m_endOffset - si->m_startOffset;
 
       // calculate time when to prepare next stream
-      si->m_prepareNextAtFrame = 0;
-      if (streamTotalTime >= TIME_TO_CACHE_NEXT_FILE + m_defaultCrossfadeMS)
-        si->m_prepareNextAtFrame = (int)((streamTotalTime - TIME_TO_CACHE_NEXT_FILE - m_defaultCrossfadeMS) * si->m_audioFormat.m_sampleRate / 1000.0f);
+      si->m_prepareNextAtFrame = GetPrepareNextAtFrame(si, streamTotalTime);
 
       si->m_prepareTriggered = false;
       si->m_playNextAtFrame = 0;
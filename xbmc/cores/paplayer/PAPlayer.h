@@ -120,6 +120,7 @@ private:
   bool m_fullScreen;
   unsigned int m_defaultCrossfadeMS = 0; /* how long the default crossfade is in ms */
   unsigned int m_upcomingCrossfadeMS = 0; /* how long the upcoming crossfade is in ms */
+  unsigned int m_decodeAheadMS = 0; /* how much of the next stream to decode ahead in ms */
   CEvent              m_startEvent;          /* event for playback start */
   StreamInfo* m_currentStream = nullptr;
   IAudioCallback*     m_audioCallback;       /* the viz audio callback */
@@ -144,6 +145,7 @@ private:
   int64_t GetTotalTime64();
   void UpdateCrossfadeTime(const CFileItem& file);
   void UpdateStreamInfoPlayNextAtFrame(StreamInfo *si, unsigned int crossFadingTime);
+  int GetPrepareNextAtFrame(const StreamInfo* si, int64_t streamTotalTime) const;
   void UpdateGUIData(StreamInfo *si);
   int64_t GetTimeInternal();
   bool SetTimeInternal(int64_t time);
@@ -0,0 +1,181 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace dbiplus
+{
+/*!
+ \brief Keeps idle connections to a database server so that they can be reused by the next
+ database object connecting to the same server instead of setting up a new connection.
+
+ Connections are grouped by a key describing the server and the credentials. A connection which
+ has been idle for longer than the keepalive interval is pinged before it is handed out again and
+ dropped if the server doesn't answer anymore, one which has been idle for longer than the maximum
+ idle time is closed so that the server doesn't time it out first.
+ */
+template<typename Connection>
+class ConnectionPool
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  ConnectionPool(std::function<bool(Connection)> ping,
+                 std::function<void(Connection)> close,
+                 Clock::duration keepAlive,
+                 Clock::duration maxIdleTime)
+    : m_ping(std::move(ping)),
+      m_close(std::move(close)),
+      m_keepAlive(keepAlive),
+      m_maxIdleTime(maxIdleTime)
+  {
+  }
+
+  ~ConnectionPool() { Clear(); }
+
+  ConnectionPool(const ConnectionPool&) = delete;
+  ConnectionPool& operator=(const ConnectionPool&) = delete;
+
+  /*!
+   \brief Take an idle connection for the given key out of the pool.
+   \return the connection or a default constructed Connection if there is no usable one.
+   */
+  Connection Acquire(const std::string& key)
+  {
+    while (true)
+    {
+      Idle idle;
+      std::vector<Connection> expired;
+      {
+        std::unique_lock lock(m_mutex);
+        expired = TakeExpired(Clock::now());
+
+        const auto it = m_idle.find(key);
+        if (it == m_idle.end() || it->second.empty())
+        {
+          lock.unlock();
+          CloseAll(expired);
+          return Connection{};
+        }
+
+        // the most recently used connection is the least likely one to have been dropped
+        idle = std::move(it->second.back());
+        it->second.pop_back();
+      }
+      CloseAll(expired);
+
+      if (Clock::now() - idle.since < m_keepAlive || m_ping(idle.connection))
+        return idle.connection;
+
+      m_close(idle.connection);
+    }
+  }
+
+  /*!
+   \brief Put a connection which isn't used anymore back into the pool.
+
+   The connection is closed instead if there are already maxIdle idle connections for the key.
+   */
+  void Release(const std::string& key, Connection connection, size_t maxIdle)
+  {
+    std::vector<Connection> expired;
+    {
+      std::unique_lock lock(m_mutex);
+      const auto now = Clock::now();
+      expired = TakeExpired(now);
+
+      std::vector<Idle>& idle = m_idle[key];
+      if (idle.size() < maxIdle)
+      {
+        idle.push_back({connection, now});
+        connection = Connection{};
+      }
+    }
+    CloseAll(expired);
+
+    if (connection != Connection{})
+      m_close(connection);
+  }
+
+  /*!
+   \brief Close all idle connections.
+   */
+  void Clear()
+  {
+    std::vector<Connection> connections;
+    {
+      std::unique_lock lock(m_mutex);
+      for (const auto& [key, idle] : m_idle)
+      {
+        for (const Idle& entry : idle)
+          connections.push_back(entry.connection);
+      }
+      m_idle.clear();
+    }
+    CloseAll(connections);
+  }
+
+  size_t GetIdleCount(const std::string& key) const
+  {
+    std::unique_lock lock(m_mutex);
+    const auto it = m_idle.find(key);
+    return it != m_idle.end() ? it->second.size() : 0;
+  }
+
+private:
+  struct Idle
+  {
+    Connection connection{};
+    Clock::time_point since;
+  };
+
+  std::vector<Connection> TakeExpired(Clock::time_point now)
+  {
+    std::vector<Connection> expired;
+    for (auto it = m_idle.begin(); it != m_idle.end();)
+    {
+      std::vector<Idle>& idle = it->second;
+      // the connections are ordered by the time they have been released
+      auto end = idle.begin();
+      while (end != idle.end() && now - end->since >= m_maxIdleTime)
+        ++end;
+      for (auto entry = idle.begin(); entry != end; ++entry)
+        expired.push_back(entry->connection);
+      idle.erase(idle.begin(), end);
+
+      if (idle.empty())
+        it = m_idle.erase(it);
+      else
+        ++it;
+    }
+    return expired;
+  }
+
+  void CloseAll(const std::vector<Connection>& connections)
+  {
+    for (const Connection& connection : connections)
+      m_close(connection);
+  }
+
+  const std::function<bool(Connection)> m_ping;
+  const std::function<void(Connection)> m_close;
+  const Clock::duration m_keepAlive;
+  const Clock::duration m_maxIdleTime;
+
+  mutable std::mutex m_mutex;
+  std::map<std::string, std::vector<Idle>, std::less<>> m_idle;
+};
+} // namespace dbiplus
@@ -10,6 +10,7 @@
 
 #include "DatabaseManager.h"
 #include "DbUrl.h"
+#include "FullTextQuery.h"
 #include "ServiceBroker.h"
 #include "filesystem/SpecialProtocol.h"
 #if defined(HAS_MYSQL) || defined(HAS_MARIADB)
@@ -149,6 +150,18 @@ bool CDatabase::ExistsSubQuery::BuildSQL(std::string& strSQL) const
   return true;
 }
 
+CDatabase::PrimaryReads::PrimaryReads(CDatabase& database) : m_db(database.m_pDB.get())
+{
+  if (m_db)
+    m_db->pin_reads();
+}
+
+CDatabase::PrimaryReads::~PrimaryReads()
+{
+  if (m_db)
+    m_db->unpin_reads();
+}
+
 CDatabase::DatasetLayout::DatasetLayout(size_t totalfields)
 {
   m_fields.resize(totalfields, DatasetFieldInfo(false, false, -1));
@@ -361,6 +374,111 @@ bool CDatabase::DeleteValues(const std::string& strTable, const Filter& filter /
   return ExecuteQuery(strQuery);
 }
 
+int64_t CDatabase::GetJournalCursor() const
+{
+  int64_t cursor = 0;
+  try
+  {
+    if (!m_pDB || !m_pDS)
+      return cursor;
+
+    if (m_pDS->query("SELECT MAX(change_id) FROM changelog") && !m_pDS->eof())
+      cursor = m_pDS->fv(0).get_asInt64();
+    m_pDS->close();
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "failed");
+  }
+  return cursor;
+}
+
+bool CDatabase::GetJournalChanges(int64_t cursor,
+                                  unsigned int limit,
+                                  std::vector<JournalChange>& changes,
+                                  int64_t& next,
+                                  bool& more)
+{
+  changes.clear();
+  next = cursor;
+  more = false;
+
+  try
+  {
+    if (!m_pDB || !m_pDS || cursor <= 0)
+      return false;
+
+    // the cursor has to be within the journal, otherwise changes were lost
+    if (!m_pDS->query("SELECT MIN(change_id), MAX(change_id) FROM changelog") || m_pDS->eof())
+      return false;
+    const int64_t first = m_pDS->fv(0).get_asInt64();
+    const int64_t last = m_pDS->fv(1).get_asInt64();
+    m_pDS->close();
+    if (cursor > last || cursor < first - 1)
+      return false;
+
+    // one more to know whether there are more changes
+    m_pDS->query(StringUtils::Format("SELECT change_id, media_type, media_id, action FROM changelog "
+                                     "WHERE change_id > {} ORDER BY change_id LIMIT {}",
+                                     cursor, limit + 1));
+
+    std::map<std::pair<std::string, int>, size_t> indices;
+    unsigned int count = 0;
+    while (!m_pDS->eof())
+    {
+      if (count++ == limit)
+      {
+        more = true;
+        break;
+      }
+
+      next = m_pDS->fv(0).get_asInt64();
+      JournalChange change;
+      change.mediaType = m_pDS->fv(1).get_asString();
+      if (change.mediaType.empty())
+      {
+        // the entry marking the start of the journal
+        m_pDS->next();
+        continue;
+      }
+      change.id = m_pDS->fv(2).get_asInt();
+      const std::string action = m_pDS->fv(3).get_asString();
+      if (action == "add")
+        change.action = JournalChange::Action::ADDED;
+      else if (action == "remove")
+        change.action = JournalChange::Action::REMOVED;
+      else
+        change.action = JournalChange::Action::UPDATED;
+
+      const auto [it, inserted] =
+          indices.try_emplace(std::make_pair(change.mediaType, change.id), changes.size());
+      if (inserted)
+        changes.emplace_back(std::move(change));
+      else
+      {
+        // an update doesn't change what the client has to do for an added item
+        JournalChange& merged = changes[it->second];
+        if (change.action != JournalChange::Action::UPDATED ||
+            merged.action == JournalChange::Action::REMOVED)
+          merged.action = change.action;
+      }
+
+      m_pDS->next();
+    }
+    m_pDS->close();
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "failed for cursor {}", cursor);
+    changes.clear();
+    next = cursor;
+    more = false;
+    return false;
+  }
+
+  return true;
+}
+
 bool CDatabase::BeginMultipleExecute()
 {
   m_multipleExecute = true;
@@ -371,14 +489,20 @@ bool CDatabase::BeginMultipleExecute()
 bool CDatabase::CommitMultipleExecute()
 {
   m_multipleExecute = false;
+  if (nullptr == m_pDB || nullptr == m_pDS)
+    return false;
+
   BeginTransaction();
-  for (const auto& i : m_multipleQueries)
+  try
   {
-    if (!ExecuteQuery(i))
-    {
-      RollbackTransaction();
-      return false;
-    }
+    // the queries are independent of each other, so the database may send them all at once
+    m_pDS->exec_batch(m_multipleQueries);
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "Failed to execute {} queries", m_multipleQueries.size());
+    RollbackTransaction();
+    return false;
   }
   m_multipleQueries.clear();
   return CommitTransaction();
@@ -600,7 +724,11 @@ CDatabase::ConnectionState CDatabase::Connect(const std::string& dbName,
 #if defined(HAS_MYSQL) || defined(HAS_MARIADB)
   else if (dbSettings.type == "mysql")
   {
-    m_pDB = std::make_unique<MysqlDatabase>();
+    auto mysql = std::make_unique<MysqlDatabase>();
+    mysql->setPoolSize(dbSettings.poolsize);
+    mysql->setReplica(dbSettings.replicahost,
+                      dbSettings.replicaport.empty() ? dbSettings.port : dbSettings.replicaport);
+    m_pDB = std::move(mysql);
   }
 #endif
   else
@@ -629,6 +757,8 @@ CDatabase::ConnectionState CDatabase::Connect(const std::string& dbName,
                    dbSettings.capath.c_str(), dbSettings.ciphers.c_str(), dbSettings.connecttimeout,
                    dbSettings.compression);
 
+  m_fullTextIndexes.clear();
+
   // create the datasets
   m_pDS.reset(m_pDB->CreateDataset());
   m_pDS2.reset(m_pDB->CreateDataset());
@@ -850,6 +980,158 @@ bool CDatabase::BuildSQL(std::string_view strQuery, const Filter& filter, std::s
   return true;
 }
 
+void CDatabase::CreateJournalTable()
+{
+  m_pDS->exec("CREATE TABLE changelog (change_id INTEGER PRIMARY KEY, media_type TEXT, "
+              "media_id INTEGER, action TEXT)");
+  // the first cursor, clients without one have to sync everything
+  m_pDS->exec("INSERT INTO changelog (media_type, media_id, action) VALUES ('', 0, 'start')");
+}
+
+void CDatabase::CreateJournalTriggers(const JournaledTable& table)
+{
+  const auto record = [&table](const char* row, const char* action)
+  {
+    return StringUtils::Format("INSERT INTO changelog (media_type, media_id, action) "
+                               "VALUES ('{}', {}.{}, '{}');",
+                               table.mediaType, row, table.key, action);
+  };
+
+  m_pDS->exec(StringUtils::Format(
+      "CREATE TRIGGER tgrJournalInsert_{0} AFTER INSERT ON {0} FOR EACH ROW BEGIN {1} END",
+      table.table, record("NEW", "add")));
+  m_pDS->exec(StringUtils::Format(
+      "CREATE TRIGGER tgrJournalUpdate_{0} AFTER UPDATE ON {0} FOR EACH ROW BEGIN {1} END",
+      table.table, record("NEW", "update")));
+  m_pDS->exec(StringUtils::Format(
+      "CREATE TRIGGER tgrJournalDelete_{0} AFTER DELETE ON {0} FOR EACH ROW BEGIN {1} END",
+      table.table, record("OLD", "remove")));
+}
+
+bool CDatabase::PruneJournal(unsigned int keep /* = 100000 */)
+{
+  // the newest entry is always kept so that change ids are never reused
+  return ExecuteQuery(
+      PrepareSQL("DELETE FROM changelog WHERE change_id <= "
+                 "(SELECT last FROM (SELECT MAX(change_id) - %u AS last FROM changelog) AS journal)",
+                 std::max(keep, 1u)));
+}
+
+bool CDatabase::CreateFullTextIndex(const FullTextIndex& index)
+{
+  m_fullTextIndexes.erase(index.name);
+
+  const std::string columns = StringUtils::Join(index.columns, ", ");
+  try
+  {
+    if (m_sqlite)
+    {
+      // the FTS5 table keeps its own copy of the text so that rows can be removed by key alone,
+      // inserts clear the key first as REPLACE doesn't fire delete triggers
+      std::vector<std::string> newValues;
+      for (const auto& column : index.columns)
+        newValues.emplace_back("NEW." + column);
+      const std::string insert = StringUtils::Format(
+          "DELETE FROM {0} WHERE rowid = NEW.{1}; "
+          "INSERT INTO {0} (rowid, {2}) VALUES (NEW.{1}, {3});",
+          index.name, index.key, columns, StringUtils::Join(newValues, ", "));
+      const std::string remove =
+          StringUtils::Format("DELETE FROM {} WHERE rowid = OLD.{};", index.name, index.key);
+
+      // virtual tables aren't dropped together with the other analytics
+      m_pDS->exec(StringUtils::Format("DROP TABLE IF EXISTS {}", index.name));
+      m_pDS->exec(
+          StringUtils::Format("CREATE VIRTUAL TABLE {} USING fts5({})", index.name, columns));
+      m_pDS->exec(StringUtils::Format(
+          "CREATE TRIGGER tgrInsert_{0} AFTER INSERT ON {1} FOR EACH ROW BEGIN {2} END",
+          index.name, index.table, insert));
+      m_pDS->exec(StringUtils::Format(
+          "CREATE TRIGGER tgrDelete_{0} AFTER DELETE ON {1} FOR EACH ROW BEGIN {2} END",
+          index.name, index.table, remove));
+      m_pDS->exec(StringUtils::Format(
+          "CREATE TRIGGER tgrUpdate_{0} AFTER UPDATE OF {1} ON {2} FOR EACH ROW BEGIN {3} {4} END",
+          index.name, columns, index.table, remove, insert));
+      m_pDS->exec(StringUtils::Format("INSERT INTO {0} (rowid, {1}) SELECT {2}, {1} FROM {3}",
+                                      index.name, columns, index.key, index.table));
+    }
+    else
+    {
+      m_pDS->exec(StringUtils::Format("CREATE FULLTEXT INDEX {} ON {} ({})", index.name,
+                                      index.table, columns));
+    }
+  }
+  catch (...)
+  {
+    CLog::Log(LOGWARNING, "{} - full text index {} is not available", __FUNCTION__, index.name);
+    if (m_sqlite)
+      ExecuteQuery(StringUtils::Format("DROP TABLE IF EXISTS {}", index.name));
+    return false;
+  }
+
+  return true;
+}
+
+bool CDatabase::HasFullTextIndex(const FullTextIndex& index) const
+{
+  const auto it = m_fullTextIndexes.find(index.name);
+  if (it != m_fullTextIndexes.end())
+    return it->second;
+
+  std::string query;
+  if (m_sqlite)
+    query = PrepareSQL("SELECT COUNT(1) FROM sqlite_master WHERE type = 'table' AND name = '%s'",
+                       index.name.c_str());
+  else
+    query = PrepareSQL("SELECT COUNT(1) FROM information_schema.statistics "
+                       "WHERE table_schema = DATABASE() AND table_name = '%s' "
+                       "AND index_name = '%s'",
+                       index.table.c_str(), index.name.c_str());
+
+  const bool exists = GetSingleValueInt(query) > 0;
+  m_fullTextIndexes.emplace(index.name, exists);
+  return exists;
+}
+
+bool CDatabase::AppendFullTextFilter(Filter& filter,
+                                     const FullTextIndex& index,
+                                     const std::string& keyField,
+                                     const CFullTextQuery& query,
+                                     const std::vector<std::string>& columns /* = {} */) const
+{
+  if (query.IsEmpty() || !query.IsSelective() || !HasFullTextIndex(index))
+    return false;
+
+  if (m_sqlite)
+  {
+    filter.AppendJoin(PrepareSQL("JOIN (SELECT rowid AS ftsKey, rank AS ftsRank FROM %s "
+                                 "WHERE %s MATCH '%s') AS %s_match "
+                                 "ON %s_match.ftsKey = %s",
+                                 index.name.c_str(), index.name.c_str(),
+                                 query.ToFTS5(columns).c_str(), index.name.c_str(),
+                                 index.name.c_str(), keyField.c_str()));
+  }
+  else
+  {
+    // MATCH() has to name exactly the columns of the FULLTEXT index
+    const std::string match = query.ToMySQL();
+    if (match.empty() || (!columns.empty() && columns != index.columns))
+      return false;
+
+    const std::string indexColumns = StringUtils::Join(index.columns, ", ");
+    filter.AppendJoin(PrepareSQL(
+        "JOIN (SELECT %s AS ftsKey, -MATCH (%s) AGAINST ('%s' IN BOOLEAN MODE) AS ftsRank "
+        "FROM %s WHERE MATCH (%s) AGAINST ('%s' IN BOOLEAN MODE)) AS %s_match "
+        "ON %s_match.ftsKey = %s",
+        index.key.c_str(), indexColumns.c_str(), match.c_str(), index.table.c_str(),
+        indexColumns.c_str(), match.c_str(), index.name.c_str(), index.name.c_str(),
+        keyField.c_str()));
+  }
+
+  // lower ranks are better matches
+  filter.AppendOrder(index.name + "_match.ftsRank");
+  return true;
+}
+
 bool CDatabase::BuildSQL(const std::string& strBaseDir,
                          const std::string& strQuery,
                          Filter& filter,
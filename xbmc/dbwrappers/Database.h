@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include <cstdint>
+#include <map>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -21,6 +23,7 @@ class Dataset;
 
 class DatabaseSettings;
 class CDbUrl;
+class CFullTextQuery;
 class CProfileManager;
 struct SortDescription;
 
@@ -96,6 +99,62 @@ public:
     std::string where;
   };
 
+  /*!
+   \brief Sends the reads of the database to the primary server (rather than a read-only replica)
+   while in scope. Used for lookups which decide what is written, like whether a row is inserted.
+   */
+  class PrimaryReads
+  {
+  public:
+    explicit PrimaryReads(CDatabase& database);
+    ~PrimaryReads();
+
+    PrimaryReads(const PrimaryReads&) = delete;
+    PrimaryReads& operator=(const PrimaryReads&) = delete;
+
+  private:
+    dbiplus::Database* m_db;
+  };
+
+  /*!
+   \brief Definition of a full text index on the text columns of a table.
+   */
+  struct FullTextIndex
+  {
+    std::string name; ///< name of the FTS5 table or FULLTEXT index
+    std::string table;
+    std::string key; ///< integer primary key of the table
+    std::vector<std::string> columns;
+  };
+
+  /*!
+   \brief Definition of a table whose inserts, updates and deletes are recorded in the change
+   journal.
+   */
+  struct JournaledTable
+  {
+    std::string table;
+    std::string key; ///< integer primary key of the table
+    std::string mediaType; ///< the media type recorded for the rows of the table
+  };
+
+  /*!
+   \brief The change of an item recorded in the change journal.
+   */
+  struct JournalChange
+  {
+    enum class Action
+    {
+      ADDED,
+      UPDATED,
+      REMOVED,
+    };
+
+    std::string mediaType;
+    int id;
+    Action action;
+  };
+
   CDatabase();
   virtual ~CDatabase(void);
   bool IsOpen() const;
@@ -165,6 +224,32 @@ public:
    */
   bool DeleteValues(const std::string& strTable, const Filter& filter = Filter());
 
+  /*! \brief Get the current position of the change journal.
+   Clients syncing the library get the cursor before fetching everything and then only ask for
+   the changes since.
+   \return the cursor, 0 if nothing has been recorded yet.
+   */
+  int64_t GetJournalCursor() const;
+
+  /*! \brief Get the changes recorded in the change journal after the given cursor.
+   Several changes of the same item are merged into one, so an item which was added and then
+   updated is reported as added.
+   \param cursor the cursor returned by the previous call or GetJournalCursor(), 0 if the client
+   has none yet.
+   \param limit the maximum number of journal entries to read.
+   \param changes the changes, in the order of their first recorded change.
+   \param next the cursor to pass to the next call.
+   \param more whether there are more changes after the returned ones.
+   \return false if the client has no cursor, the journal doesn't reach back to it (it has been
+   pruned or the database was replaced) or on error, in which case the client has to sync
+   everything again.
+   */
+  bool GetJournalChanges(int64_t cursor,
+                         unsigned int limit,
+                         std::vector<JournalChange>& changes,
+                         int64_t& next,
+                         bool& more);
+
   /*!
    * @brief Execute a query that does not return any result.
    *        Note that if BeginMultipleExecute() has been called, the
@@ -306,6 +391,48 @@ protected:
 
   bool BuildSQL(std::string_view strQuery, const Filter& filter, std::string& strSQL) const;
 
+  /*! \brief Create a full text index, to be called from CreateAnalytics().
+   SQLite gets an FTS5 table kept up to date by triggers, MySQL/MariaDB a FULLTEXT index.
+   \param index the index to create.
+   \return false if the database doesn't support full text search.
+   */
+  bool CreateFullTextIndex(const FullTextIndex& index);
+
+  /*! \brief Check whether a full text index was created for a table.
+   */
+  bool HasFullTextIndex(const FullTextIndex& index) const;
+
+  /*! \brief Restrict a query to the rows matching a search, best matches first.
+   \param filter the filter to add the join, condition and order to.
+   \param index the full text index to search.
+   \param keyField the (qualified) field of the query holding the key of the indexed table.
+   \param query the search.
+   \param columns only search these columns of the index, all columns if empty.
+   \return false if the index can't be used or the search has very short prefixes, callers should
+   fall back to LIKE.
+   */
+  bool AppendFullTextFilter(Filter& filter,
+                            const FullTextIndex& index,
+                            const std::string& keyField,
+                            const CFullTextQuery& query,
+                            const std::vector<std::string>& columns = {}) const;
+
+  /*! \brief Create the table of the change journal, to be called from CreateTables() and
+   UpdateTables().
+   */
+  void CreateJournalTable();
+
+  /*! \brief Create the triggers recording the changes of a table in the change journal, to be
+   called from CreateAnalytics().
+   */
+  void CreateJournalTriggers(const JournaledTable& table);
+
+  /*! \brief Drop the oldest entries of the change journal.
+   Clients whose cursor is older than the remaining entries have to sync everything again.
+   \param keep the number of entries to keep.
+   */
+  bool PruneJournal(unsigned int keep = 100000);
+
   bool m_sqlite{true}; ///< \brief whether we use sqlite (defaults to true)
 
   std::unique_ptr<dbiplus::Database> m_pDB;
@@ -327,4 +454,6 @@ private:
 
   bool m_multipleExecute{false};
   std::vector<std::string> m_multipleQueries;
+
+  mutable std::map<std::string, bool, std::less<>> m_fullTextIndexes;
 };
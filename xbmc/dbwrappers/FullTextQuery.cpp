@@ -0,0 +1,127 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "FullTextQuery.h"
+
+#include "utils/StringUtils.h"
+
+#include <algorithm>
+#include <cctype>
+
+namespace
+{
+bool IsSpace(char c)
+{
+  return std::isspace(static_cast<unsigned char>(c)) != 0;
+}
+
+// characters MySQL treats as (part of) a word, everything else separates words
+bool IsMySQLWordChar(char c)
+{
+  const auto uc = static_cast<unsigned char>(c);
+  return uc >= 0x80 || std::isalnum(uc) || c == '_' || c == '\'';
+}
+} // unnamed namespace
+
+CFullTextQuery::CFullTextQuery(const std::string& search, bool matchAll /* = true */)
+  : m_matchAll(matchAll)
+{
+  size_t pos = 0;
+  while (pos < search.size())
+  {
+    if (IsSpace(search[pos]))
+    {
+      ++pos;
+      continue;
+    }
+
+    Term term;
+    if (search[pos] == '"')
+    {
+      const size_t end = search.find('"', pos + 1);
+      term.text = search.substr(pos + 1, end == std::string::npos ? end : end - pos - 1);
+      term.phrase = true;
+      pos = end == std::string::npos ? search.size() : end + 1;
+      if (pos < search.size() && search[pos] == '*')
+      {
+        term.prefix = true;
+        ++pos;
+      }
+    }
+    else
+    {
+      size_t end = pos;
+      while (end < search.size() && !IsSpace(search[end]) && search[end] != '"')
+        ++end;
+      term.text = search.substr(pos, end - pos);
+      term.prefix = true;
+      pos = end;
+    }
+
+    StringUtils::Trim(term.text, " \t\r\n*");
+    if (!term.text.empty())
+      m_terms.emplace_back(std::move(term));
+  }
+}
+
+bool CFullTextQuery::IsSelective() const
+{
+  return std::none_of(m_terms.begin(), m_terms.end(),
+                      [](const Term& term)
+                      {
+                        // count characters, not the continuation bytes of UTF-8 sequences
+                        const auto length =
+                            std::count_if(term.text.begin(), term.text.end(), [](char c)
+                                          { return (static_cast<unsigned char>(c) & 0xC0) != 0x80; });
+                        return term.prefix && static_cast<size_t>(length) < MIN_PREFIX_LENGTH;
+                      });
+}
+
+std::string CFullTextQuery::ToFTS5(const std::vector<std::string>& columns /* = {} */) const
+{
+  // every term is quoted so that FTS5 operators and syntax characters are taken literally
+  std::vector<std::string> terms;
+  terms.reserve(m_terms.size());
+  for (const auto& term : m_terms)
+  {
+    std::string text = term.text;
+    StringUtils::Replace(text, "\"", "\"\"");
+    terms.emplace_back("\"" + text + "\"" + (term.prefix ? "*" : ""));
+  }
+
+  std::string query = StringUtils::Join(terms, m_matchAll ? " AND " : " OR ");
+  if (!columns.empty() && !query.empty())
+    query = "{" + StringUtils::Join(columns, " ") + "} : (" + query + ")";
+
+  return query;
+}
+
+std::string CFullTextQuery::ToMySQL() const
+{
+  std::vector<std::string> terms;
+  terms.reserve(m_terms.size());
+  for (const auto& term : m_terms)
+  {
+    std::string text = term.text;
+    std::replace_if(
+        text.begin(), text.end(), [](char c) { return !IsMySQLWordChar(c); }, ' ');
+    StringUtils::Trim(text);
+    if (text.empty())
+      continue;
+
+    // MySQL only supports prefixes of single words
+    std::string match = m_matchAll ? "+" : "";
+    if (text.find(' ') != std::string::npos || (term.phrase && !term.prefix))
+      match += "\"" + text + "\"";
+    else
+      match += text + (term.prefix ? "*" : "");
+    terms.emplace_back(std::move(match));
+  }
+
+  return StringUtils::Join(terms, " ");
+}
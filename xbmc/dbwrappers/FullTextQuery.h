@@ -0,0 +1,62 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+/*!
+ \brief Search as entered by the user, converted to the full text query syntax of the database
+ backends.
+
+ The search is split into words and "quoted phrases". Words match any word starting with them
+ (search as you type), phrases match exactly unless they are followed by a '*'.
+ */
+class CFullTextQuery
+{
+public:
+  /*!
+   \param search the search as entered by the user.
+   \param matchAll whether all words and phrases have to match or any of them.
+   */
+  explicit CFullTextQuery(const std::string& search, bool matchAll = true);
+
+  bool IsEmpty() const { return m_terms.empty(); }
+
+  /*!
+   \brief Check whether all prefix terms are long enough to be looked up in an index.
+   Very short prefixes expand to most of the indexed words, MySQL doesn't index short words at all.
+   */
+  bool IsSelective() const;
+
+  /*!
+   \brief Get the query for the MATCH operator of an SQLite FTS5 table.
+   \param columns restrict the query to these columns of the table, all columns if empty.
+   */
+  std::string ToFTS5(const std::vector<std::string>& columns = {}) const;
+
+  /*!
+   \brief Get the query for MATCH ... AGAINST (... IN BOOLEAN MODE) of a MySQL/MariaDB FULLTEXT
+   index.
+   */
+  std::string ToMySQL() const;
+
+private:
+  static constexpr size_t MIN_PREFIX_LENGTH = 3;
+
+  struct Term
+  {
+    std::string text;
+    bool phrase = false;
+    bool prefix = false;
+  };
+
+  std::vector<Term> m_terms;
+  bool m_matchAll;
+};
@@ -197,6 +197,12 @@ void Dataset::refresh()
     open();
 }
 
+void Dataset::exec_batch(const std::vector<std::string>& sql)
+{
+  for (const std::string& query : sql)
+    exec(query);
+}
+
 void Dataset::first()
 {
   if (ds_state == dsSelect)
@@ -20,6 +20,7 @@
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <vector>
 
 namespace dbiplus
 {
@@ -175,6 +176,11 @@ public:
   virtual std::string vprepare(const char* format, va_list args) = 0;
 
   virtual bool in_transaction() { return false; }
+
+  /* virtual methods for read routing, reads go to the primary server while pinned */
+
+  virtual void pin_reads() {}
+  virtual void unpin_reads() {}
 };
 
 /******************* Class Dataset definition *********************
@@ -309,6 +315,8 @@ public:
   /* func. executes a query without results to return */
   virtual int exec(const std::string& sql) = 0;
   virtual int exec() = 0;
+  /* func. executes several queries without results, the database may send them together */
+  virtual void exec_batch(const std::vector<std::string>& sql);
   virtual const void* getExecRes() = 0;
   /* as open, but with our query exec Sql */
   virtual bool query(const std::string& sql) = 0;
@@ -8,6 +8,7 @@
 
 #include "mysqldataset.h"
 
+#include "ConnectionPool.h"
 #include "ServiceBroker.h"
 #include "Util.h"
 #include "network/DNSNameCache.h"
@@ -17,10 +18,12 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cctype>
 #include <chrono>
 #include <cstdlib>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #ifdef HAS_MYSQL
@@ -37,6 +40,33 @@ namespace
 {
 constexpr int MYSQL_OK = 0;
 constexpr int ER_BAD_DB_ERROR = 1049;
+
+// idle pooled connections are pinged before reuse after this time and closed after the max idle
+// time, which is well below the default wait_timeout of the server
+constexpr auto POOL_KEEPALIVE = std::chrono::seconds(30);
+constexpr auto POOL_MAX_IDLE_TIME = std::chrono::minutes(5);
+
+// reads of other database objects go to the primary for a while after a write so that they are
+// likely to see it even if the replica lags, the writing object reads from the primary anyway
+constexpr auto REPLICA_READ_AFTER_WRITE_DELAY = std::chrono::seconds(5);
+// time to wait before trying to use the replica again after it failed
+constexpr auto REPLICA_RETRY_INTERVAL = std::chrono::minutes(1);
+
+// batches of fewer statements aren't worth the round trips to switch multi-statements on and off
+constexpr size_t MIN_BATCH_STATEMENTS = 4;
+// stay well below the default max_allowed_packet of the server
+constexpr size_t MAX_BATCH_SIZE = 1024 * 1024;
+
+dbiplus::ConnectionPool<MYSQL*>& GetConnectionPool()
+{
+  static dbiplus::ConnectionPool<MYSQL*> pool([](MYSQL* conn) { return mysql_ping(conn) == 0; },
+                                              [](MYSQL* conn) { mysql_close(conn); },
+                                              POOL_KEEPALIVE, POOL_MAX_IDLE_TIME);
+  return pool;
+}
+
+// time of the last write to the primary by any database object
+std::atomic<std::chrono::steady_clock::rep> lastWrite{0};
 } // unnamed namespace
 
 namespace dbiplus
@@ -112,21 +142,21 @@ const char* MysqlDatabase::getErrorMsg()
   return error.c_str();
 }
 
-void MysqlDatabase::configure_connection()
+void MysqlDatabase::configure_connection(MYSQL* handle)
 {
   // MySQL 5.7.5+: See #8393
   std::string sqlcmd{
       "SET SESSION sql_mode = (SELECT REPLACE(@@SESSION.sql_mode,'ONLY_FULL_GROUP_BY',''))"};
-  int ret = mysql_real_query(conn, sqlcmd.c_str(), sqlcmd.size());
+  int ret = mysql_real_query(handle, sqlcmd.c_str(), sqlcmd.size());
   if (ret != MYSQL_OK)
     throw DbErrors("Can't disable sql_mode ONLY_FULL_GROUP_BY: '%s' (%d)", db.c_str(), ret);
 
   // MySQL 5.7.6+: See #8393. Non-fatal if error, as not supported by MySQL 5.0.x
   sqlcmd = "SELECT @@SESSION.optimizer_switch";
-  ret = mysql_real_query(conn, sqlcmd.c_str(), sqlcmd.size());
+  ret = mysql_real_query(handle, sqlcmd.c_str(), sqlcmd.size());
   if (ret == MYSQL_OK)
   {
-    MYSQL_RES* res = mysql_store_result(conn);
+    MYSQL_RES* res = mysql_store_result(handle);
     if (res)
     {
       const MYSQL_ROW row = mysql_fetch_row(res);
@@ -140,7 +170,7 @@ void MysqlDatabase::configure_connection()
           if (StringUtils::Trim(itIn) == "derived_merge=on")
           {
             sqlcmd = "SET SESSION optimizer_switch = 'derived_merge=off'";
-            ret = mysql_real_query(conn, sqlcmd.c_str(), sqlcmd.size());
+            ret = mysql_real_query(handle, sqlcmd.c_str(), sqlcmd.size());
             if (ret != MYSQL_OK)
               throw DbErrors("Can't set optimizer_switch = '%s': '%s' (%d)",
                              StringUtils::Trim(itIn).c_str(), db.c_str(), ret);
@@ -175,16 +205,20 @@ int MysqlDatabase::connect(bool create_new)
   {
     disconnect();
 
-    if (!conn)
+    // reuse an idle connection of another database object, it has been configured already
+    conn = GetConnectionPool().Acquire(pool_key(host, port));
+    if (conn)
     {
-      conn = mysql_init(conn);
-      mysql_ssl_set(conn, key.empty() ? nullptr : key.c_str(),
-                    cert.empty() ? nullptr : cert.c_str(), ca.empty() ? nullptr : ca.c_str(),
-                    capath.empty() ? nullptr : capath.c_str(),
-                    ciphers.empty() ? nullptr : ciphers.c_str());
-      mysql_options(conn, MYSQL_OPT_CONNECT_TIMEOUT, &connect_timeout);
+      if (mysql_select_db(conn, db.c_str()) == MYSQL_OK)
+      {
+        active = true;
+        return DB_CONNECTION_OK;
+      }
+      mysql_close(conn);
     }
 
+    conn = init_connection();
+
     if (!CWakeOnAccess::GetInstance().WakeUpHost(host, "MySQL : " + db))
       return DB_CONNECTION_NONE;
 
@@ -229,7 +263,7 @@ int MysqlDatabase::connect(bool create_new)
                   mysql_error(conn));
       }
 
-      configure_connection();
+      configure_connection(conn);
 
       // check existence
       if (exists())
@@ -282,15 +316,104 @@ int MysqlDatabase::connect(bool create_new)
 
 void MysqlDatabase::disconnect()
 {
+  drop_replica();
+
   if (conn)
   {
-    mysql_close(conn);
+    // a connection which is broken or still has state of this object can't be shared
+    if (active && !_in_transaction && !_pinned)
+      release_connection(conn, host, port);
+    else
+      mysql_close(conn);
     conn = nullptr;
   }
 
+  _pinned = false;
+  _written = false;
   active = false;
 }
 
+std::string MysqlDatabase::pool_key(const std::string& server, const std::string& serverPort) const
+{
+  return StringUtils::Format("{}:{}|{}|{}|{}|{}|{}|{}|{}|{}", server, serverPort, login, passwd, key,
+                             cert, ca, capath, ciphers, compression);
+}
+
+MYSQL* MysqlDatabase::init_connection()
+{
+  MYSQL* handle = mysql_init(nullptr);
+  mysql_ssl_set(handle, key.empty() ? nullptr : key.c_str(), cert.empty() ? nullptr : cert.c_str(),
+                ca.empty() ? nullptr : ca.c_str(), capath.empty() ? nullptr : capath.c_str(),
+                ciphers.empty() ? nullptr : ciphers.c_str());
+  mysql_options(handle, MYSQL_OPT_CONNECT_TIMEOUT, &connect_timeout);
+  return handle;
+}
+
+void MysqlDatabase::release_connection(MYSQL* handle,
+                                       const std::string& server,
+                                       const std::string& serverPort)
+{
+  GetConnectionPool().Release(pool_key(server, serverPort), handle, pool_size);
+}
+
+bool MysqlDatabase::use_replica() const
+{
+  if (replica_host.empty() || _in_transaction || _pinned || _written || _primary_reads > 0)
+    return false;
+
+  const auto now = std::chrono::steady_clock::now();
+  if (now < replica_retry)
+    return false;
+
+  const std::chrono::steady_clock::time_point written{
+      std::chrono::steady_clock::duration(lastWrite.load(std::memory_order_relaxed))};
+  return now - written >= REPLICA_READ_AFTER_WRITE_DELAY;
+}
+
+MYSQL* MysqlDatabase::connect_replica()
+{
+  MYSQL* handle = GetConnectionPool().Acquire(pool_key(replica_host, replica_port));
+  if (handle)
+  {
+    if (mysql_select_db(handle, db.c_str()) == MYSQL_OK)
+      return handle;
+    mysql_close(handle);
+  }
+
+  handle = init_connection();
+  if (mysql_real_connect(handle, replica_host.c_str(), login.c_str(), passwd.c_str(), db.c_str(),
+                         std::atoi(replica_port.c_str()), nullptr,
+                         compression ? CLIENT_COMPRESS : 0) != nullptr &&
+      mysql_set_character_set(handle, "utf8") == MYSQL_OK)
+  {
+    try
+    {
+      configure_connection(handle);
+      CLog::Log(LOGINFO, "MYSQL: Connected to replica {}:{} for {}", replica_host, replica_port,
+                db);
+      return handle;
+    }
+    catch (...)
+    {
+    }
+  }
+
+  CLog::Log(LOGWARNING, "MYSQL: Unable to connect to replica {}:{} for {} [{}]({})", replica_host,
+            replica_port, db, mysql_errno(handle), mysql_error(handle));
+  mysql_close(handle);
+  replica_retry = std::chrono::steady_clock::now() + REPLICA_RETRY_INTERVAL;
+  return nullptr;
+}
+
+void MysqlDatabase::drop_replica()
+{
+  if (replica_conn)
+  {
+    release_connection(replica_conn, replica_host, replica_port);
+    replica_conn = nullptr;
+  }
+}
+
 int MysqlDatabase::create()
 {
   return connect(true);
@@ -525,6 +648,106 @@ int MysqlDatabase::query_with_reconnect(const char* query)
   return result;
 }
 
+int MysqlDatabase::query_for_read(const char* query, MYSQL*& handle)
+{
+  if (use_replica() && (replica_conn || (replica_conn = connect_replica())))
+  {
+    if (mysql_real_query(replica_conn, query, strlen(query)) == MYSQL_OK)
+    {
+      handle = replica_conn;
+      return MYSQL_OK;
+    }
+
+    const unsigned int err = mysql_errno(replica_conn);
+    CLog::Log(LOGWARNING, "MYSQL: Query failed on replica {}:{}, using primary [{}]({})",
+              replica_host, replica_port, err, mysql_error(replica_conn));
+    if (err == CR_SERVER_GONE_ERROR || err == CR_SERVER_LOST)
+    {
+      mysql_close(replica_conn);
+      replica_conn = nullptr;
+      replica_retry = std::chrono::steady_clock::now() + REPLICA_RETRY_INTERVAL;
+    }
+  }
+
+  const int result = query_with_reconnect(query);
+  handle = conn;
+  return result;
+}
+
+int MysqlDatabase::query_batch(const std::vector<std::string>& queries)
+{
+  note_write(queries.empty() ? std::string() : queries.front());
+
+  // multi-statements are only allowed while the batch is sent, switching them on also makes sure
+  // that the server is still there before anything is executed
+  if (mysql_set_server_option(conn, MYSQL_OPTION_MULTI_STATEMENTS_ON) != MYSQL_OK)
+  {
+    const int err = mysql_errno(conn);
+    if (err != CR_SERVER_GONE_ERROR && err != CR_SERVER_LOST)
+      return err;
+
+    CLog::Log(LOGINFO, "MYSQL server has gone. Will try to reconnect.");
+    active = false;
+    if (connect(true) != DB_CONNECTION_OK ||
+        mysql_set_server_option(conn, MYSQL_OPTION_MULTI_STATEMENTS_ON) != MYSQL_OK)
+      return mysql_errno(conn);
+  }
+
+  int result = MYSQL_OK;
+  std::string batch;
+  for (auto it = queries.begin(); it != queries.end() && result == MYSQL_OK;)
+  {
+    batch.clear();
+    do
+    {
+      std::string_view query = *it;
+      while (!query.empty() && (std::isspace(static_cast<unsigned char>(query.back())) ||
+                                query.back() == ';'))
+        query.remove_suffix(1);
+
+      if (!batch.empty())
+        batch += ";\n";
+      batch += query;
+      ++it;
+    } while (it != queries.end() && batch.size() + it->size() < MAX_BATCH_SIZE);
+
+    // the statements stop at the first one failing, which is reported as result of that one
+    if (mysql_real_query(conn, batch.c_str(), batch.size()) != MYSQL_OK)
+      result = mysql_errno(conn);
+    else
+    {
+      int status;
+      do
+      {
+        MYSQL_RES* res = mysql_store_result(conn);
+        if (res)
+          mysql_free_result(res);
+      } while ((status = mysql_next_result(conn)) == 0);
+
+      if (status > 0)
+        result = mysql_errno(conn);
+    }
+  }
+
+  mysql_set_server_option(conn, MYSQL_OPTION_MULTI_STATEMENTS_OFF);
+  return result;
+}
+
+void MysqlDatabase::note_write(const std::string& query)
+{
+  // the replica may not have applied the write yet, read it back from the primary
+  _written = true;
+  lastWrite.store(std::chrono::steady_clock::now().time_since_epoch().count(),
+                  std::memory_order_relaxed);
+
+  // temporary tables only exist in the session which created them
+  if (!_pinned && StringUtils::Contains(query, "TEMPORARY TABLE"))
+  {
+    _pinned = true;
+    drop_replica();
+  }
+}
+
 long MysqlDatabase::nextid(const char* sname)
 {
   CLog::LogFC(LOGDEBUG, LOGDATABASE, "nextid for {}", sname);
@@ -1694,6 +1917,7 @@ void MysqlDataset::make_query(StringList& _sql)
     {
       query = i;
       Dataset::parse_sql(query);
+      static_cast<MysqlDatabase*>(db)->note_write(query);
       if ((static_cast<MysqlDatabase*>(db)->query_with_reconnect(query.c_str())) != MYSQL_OK)
       {
         throw DbErrors(db->getErrorMsg());
@@ -1795,14 +2019,10 @@ bool MysqlDataset::dropIndex(const char* table, const char* index)
   return true;
 }
 
-int MysqlDataset::exec(const std::string& sql)
+std::string MysqlDataset::prepare_exec(const std::string& sql) const
 {
-  if (!handle())
-    throw DbErrors("No Database Connection");
   std::string qry = sql;
 
-  exec_res.clear();
-
   // enforce the "auto_increment" keyword to be appended to "integer primary key"
   size_t loc;
 
@@ -1830,10 +2050,23 @@ int MysqlDataset::exec(const std::string& sql)
       qry += " CHARACTER SET utf8 COLLATE utf8_general_ci";
   }
 
+  return qry;
+}
+
+int MysqlDataset::exec(const std::string& sql)
+{
+  if (!handle())
+    throw DbErrors("No Database Connection");
+
+  exec_res.clear();
+
+  const std::string qry = prepare_exec(sql);
+  auto* mysqldb = static_cast<MysqlDatabase*>(db);
+  mysqldb->note_write(qry);
+
   const auto start = std::chrono::steady_clock::now();
 
-  const int res =
-      db->setErr(static_cast<MysqlDatabase*>(db)->query_with_reconnect(qry.c_str()), qry.c_str());
+  const int res = db->setErr(mysqldb->query_with_reconnect(qry.c_str()), qry.c_str());
 
   const auto end = std::chrono::steady_clock::now();
   const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
@@ -1851,6 +2084,39 @@ int MysqlDataset::exec(const std::string& sql)
   }
 }
 
+void MysqlDataset::exec_batch(const std::vector<std::string>& sql)
+{
+  if (!handle())
+    throw DbErrors("No Database Connection");
+
+  if (sql.size() < MIN_BATCH_STATEMENTS)
+  {
+    Dataset::exec_batch(sql);
+    return;
+  }
+
+  exec_res.clear();
+
+  std::vector<std::string> queries;
+  queries.reserve(sql.size());
+  for (const std::string& query : sql)
+    queries.emplace_back(prepare_exec(query));
+
+  const auto start = std::chrono::steady_clock::now();
+
+  const int res = db->setErr(static_cast<MysqlDatabase*>(db)->query_batch(queries),
+                             queries.front().c_str());
+
+  const auto end = std::chrono::steady_clock::now();
+  const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+
+  CLog::LogFC(LOGDEBUG, LOGDATABASE, "{} ms for batch of {} queries starting with: {}",
+              duration.count(), queries.size(), queries.front());
+
+  if (res != MYSQL_OK)
+    throw DbErrors(db->getErrorMsg());
+}
+
 int MysqlDataset::exec()
 {
   return exec(sql);
@@ -1879,13 +2145,13 @@ bool MysqlDataset::query(const std::string& query)
     qry = qry.insert(loc + 3, "signed ");
 
   MYSQL_RES* stmt = nullptr;
+  MYSQL* conn = nullptr;
 
   if (static_cast<MysqlDatabase*>(db)->setErr(
-          static_cast<MysqlDatabase*>(db)->query_with_reconnect(qry.c_str()), qry.c_str()) !=
+          static_cast<MysqlDatabase*>(db)->query_for_read(qry.c_str(), conn), qry.c_str()) !=
       MYSQL_OK)
     throw DbErrors(db->getErrorMsg());
 
-  MYSQL* conn = handle();
   stmt = mysql_store_result(conn);
   if (!stmt)
     throw DbErrors("Missing result set!");
@@ -10,7 +10,9 @@
 
 #include "dataset.h"
 
+#include <chrono>
 #include <string>
+#include <vector>
 
 #ifdef HAS_MYSQL
 #include <mysql/mysql.h>
@@ -30,9 +32,22 @@ class MysqlDatabase : public Database
 protected:
   /* connect descriptor */
   MYSQL* conn{nullptr};
+  /* connect descriptor of the read-only replica, if any */
+  MYSQL* replica_conn{nullptr};
   bool _in_transaction{false};
+  /* the session of conn has state of its own (temporary tables) and must not be shared */
+  bool _pinned{false};
+  /* conn has written, so reads stay on it until it is released to see those writes */
+  bool _written{false};
+  /* number of scopes which need reads from the primary */
+  unsigned int _primary_reads{0};
   int last_err;
 
+  std::string replica_host;
+  std::string replica_port;
+  std::chrono::steady_clock::time_point replica_retry;
+  unsigned int pool_size{0};
+
 public:
   /* default constructor */
   MysqlDatabase();
@@ -43,6 +58,14 @@ public:
 
   /* func. returns connection handle with MySQL-server */
   MYSQL* getHandle() { return conn; }
+  /* sets the number of idle connections kept for reuse, 0 disables pooling */
+  void setPoolSize(unsigned int size) { pool_size = size; }
+  /* sets a read-only replica SELECTs are sent to, an empty host disables it */
+  void setReplica(const std::string& newHost, const std::string& newPort)
+  {
+    replica_host = newHost;
+    replica_port = newPort;
+  }
   /* func. returns current status about MySQL-server connection */
   int status() override;
   int setErr(int err_code, const char* qry) override;
@@ -78,10 +101,29 @@ public:
   std::string vprepare(const char* format, va_list args) override;
 
   bool in_transaction() override { return _in_transaction; }
+  void pin_reads() override { ++_primary_reads; }
+  void unpin_reads() override
+  {
+    if (_primary_reads > 0)
+      --_primary_reads;
+  }
   int query_with_reconnect(const char* query);
-  void configure_connection();
+  /* func. runs a SELECT, on the replica if possible, handle is set to the connection used */
+  int query_for_read(const char* query, MYSQL*& handle);
+  /* func. sends the queries to the server in as few multi-statement round trips as possible */
+  int query_batch(const std::vector<std::string>& queries);
+  /* func. remembers that the query changed the database, so that reads go to the primary */
+  void note_write(const std::string& query);
+  void configure_connection(MYSQL* handle);
 
 private:
+  std::string pool_key(const std::string& server, const std::string& serverPort) const;
+  MYSQL* init_connection();
+  void release_connection(MYSQL* handle, const std::string& server, const std::string& serverPort);
+  bool use_replica() const;
+  MYSQL* connect_replica();
+  void drop_replica();
+
   char et_getdigit(double* val, int* cnt) const;
   std::string mysql_vmprintf(const char* zFormat, va_list ap);
 };
@@ -97,6 +139,9 @@ class MysqlDataset : public Dataset
 protected:
   MYSQL* handle();
 
+  /* Adapts a statement written for SQLite to MySQL */
+  std::string prepare_exec(const std::string& sql) const;
+
   /* Makes direct queries to database */
   virtual void make_query(StringList& _sql);
   /* Makes direct inserts into database */
@@ -129,6 +174,7 @@ or insert() operations default = false) */
   /* func. executes a query without results to return */
   int exec() override;
   int exec(const std::string& sql) override;
+  void exec_batch(const std::vector<std::string>& sql) override;
   const void* getExecRes() override;
   /* as open, but with our query exec Sql */
   bool query(const std::string& query) override;
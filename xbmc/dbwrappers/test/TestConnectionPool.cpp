@@ -0,0 +1,112 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "dbwrappers/ConnectionPool.h"
+
+#include <chrono>
+#include <set>
+
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+class TestConnectionPool : public testing::Test
+{
+protected:
+  dbiplus::ConnectionPool<int> CreatePool(std::chrono::seconds keepAlive,
+                                          std::chrono::seconds maxIdleTime)
+  {
+    return {[this](int connection)
+            {
+              ++m_pings;
+              return !m_dead.contains(connection);
+            },
+            [this](int connection) { m_closed.insert(connection); }, keepAlive, maxIdleTime};
+  }
+
+  int m_pings = 0;
+  std::set<int> m_dead;
+  std::set<int> m_closed;
+};
+} // unnamed namespace
+
+TEST_F(TestConnectionPool, Reuse)
+{
+  auto pool = CreatePool(60s, 600s);
+  EXPECT_EQ(0, pool.Acquire("a"));
+
+  pool.Release("a", 1, 2);
+  pool.Release("a", 2, 2);
+  pool.Release("b", 3, 2);
+  EXPECT_EQ(2u, pool.GetIdleCount("a"));
+
+  // the most recently released connection is handed out first, without a ping
+  EXPECT_EQ(2, pool.Acquire("a"));
+  EXPECT_EQ(1, pool.Acquire("a"));
+  EXPECT_EQ(0, pool.Acquire("a"));
+  EXPECT_EQ(3, pool.Acquire("b"));
+  EXPECT_EQ(0, m_pings);
+  EXPECT_TRUE(m_closed.empty());
+}
+
+TEST_F(TestConnectionPool, MaxIdle)
+{
+  auto pool = CreatePool(60s, 600s);
+  pool.Release("a", 1, 1);
+  pool.Release("a", 2, 1);
+  EXPECT_EQ(1u, pool.GetIdleCount("a"));
+  EXPECT_EQ(std::set<int>{2}, m_closed);
+
+  // pooling disabled
+  pool.Release("b", 3, 0);
+  EXPECT_EQ(0u, pool.GetIdleCount("b"));
+  EXPECT_TRUE(m_closed.contains(3));
+}
+
+TEST_F(TestConnectionPool, KeepAlive)
+{
+  auto pool = CreatePool(0s, 600s);
+  pool.Release("a", 1, 2);
+  pool.Release("a", 2, 2);
+  m_dead.insert(2);
+
+  // the dead connection is dropped and the next one is tried
+  EXPECT_EQ(1, pool.Acquire("a"));
+  EXPECT_EQ(2, m_pings);
+  EXPECT_EQ(std::set<int>{2}, m_closed);
+}
+
+TEST_F(TestConnectionPool, Expiry)
+{
+  auto pool = CreatePool(0s, 0s);
+  pool.Release("a", 1, 2);
+  pool.Release("b", 2, 2);
+
+  EXPECT_EQ(0, pool.Acquire("a"));
+  EXPECT_EQ(0, m_pings);
+  EXPECT_EQ((std::set<int>{1, 2}), m_closed);
+  EXPECT_EQ(0u, pool.GetIdleCount("b"));
+}
+
+TEST_F(TestConnectionPool, Clear)
+{
+  {
+    auto pool = CreatePool(60s, 600s);
+    pool.Release("a", 1, 2);
+    pool.Release("b", 2, 2);
+    pool.Clear();
+    EXPECT_EQ((std::set<int>{1, 2}), m_closed);
+
+    pool.Release("a", 3, 2);
+  }
+
+  // the pool closes the idle connections when it is destroyed
+  EXPECT_TRUE(m_closed.contains(3));
+}
@@ -0,0 +1,67 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "dbwrappers/FullTextQuery.h"
+
+#include <gtest/gtest.h>
+
+TEST(TestFullTextQuery, Empty)
+{
+  EXPECT_TRUE(CFullTextQuery("").IsEmpty());
+  EXPECT_TRUE(CFullTextQuery("  \"\" * ").IsEmpty());
+  EXPECT_FALSE(CFullTextQuery("a").IsEmpty());
+}
+
+TEST(TestFullTextQuery, Selective)
+{
+  EXPECT_TRUE(CFullTextQuery("dark side").IsSelective());
+  EXPECT_FALSE(CFullTextQuery("dark s").IsSelective());
+  EXPECT_FALSE(CFullTextQuery("\"da\"*").IsSelective());
+  // short phrases don't expand
+  EXPECT_TRUE(CFullTextQuery("\"a\" side").IsSelective());
+  // characters are counted, not bytes
+  EXPECT_FALSE(CFullTextQuery("\xc3\xa9\xc3\xa9").IsSelective());
+  EXPECT_TRUE(CFullTextQuery("\xc3\xa9\xc3\xa9\xc3\xa9").IsSelective());
+}
+
+TEST(TestFullTextQuery, Words)
+{
+  const CFullTextQuery query("  dark  side* ");
+  EXPECT_EQ("\"dark\"* AND \"side\"*", query.ToFTS5());
+  EXPECT_EQ("+dark* +side*", query.ToMySQL());
+}
+
+TEST(TestFullTextQuery, Phrases)
+{
+  const CFullTextQuery query("\"the wall\" pink \"floyd\"*");
+  EXPECT_EQ("\"the wall\" AND \"pink\"* AND \"floyd\"*", query.ToFTS5());
+  EXPECT_EQ("+\"the wall\" +pink* +floyd*", query.ToMySQL());
+
+  // unterminated phrases run to the end of the search
+  EXPECT_EQ("\"a\"* AND \"b c\"", CFullTextQuery("a\"b c").ToFTS5());
+}
+
+TEST(TestFullTextQuery, MatchAny)
+{
+  const CFullTextQuery query("news \"late show\"", false);
+  EXPECT_EQ("\"news\"* OR \"late show\"", query.ToFTS5());
+  EXPECT_EQ("news* \"late show\"", query.ToMySQL());
+}
+
+TEST(TestFullTextQuery, Columns)
+{
+  EXPECT_EQ("{sTitle sPlot} : (\"news\"*)", CFullTextQuery("news").ToFTS5({"sTitle", "sPlot"}));
+}
+
+TEST(TestFullTextQuery, Syntax)
+{
+  // operators are taken literally
+  EXPECT_EQ("\"AND\"* AND \"-x\"* AND \"NEAR(a\"*", CFullTextQuery("AND -x NEAR(a").ToFTS5());
+  EXPECT_EQ("+x* +\"AC DC\" +it's*", CFullTextQuery("-x+ AC/DC it's").ToMySQL());
+  EXPECT_EQ("", CFullTextQuery("+-<>").ToMySQL());
+}
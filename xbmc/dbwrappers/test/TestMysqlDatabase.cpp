@@ -0,0 +1,121 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "dbwrappers/mysqldataset.h"
+
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace dbiplus;
+
+namespace
+{
+/*!
+ \brief Runs against the MySQL or MariaDB server given by KODI_TEST_MYSQL_HOST, e.g. a local
+ mysqld started for the test, with the credentials from KODI_TEST_MYSQL_USER and
+ KODI_TEST_MYSQL_PASS. The tests are skipped if no server is given.
+ */
+class TestMysqlDatabase : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    const char* host = std::getenv("KODI_TEST_MYSQL_HOST");
+    if (!host)
+      GTEST_SKIP() << "KODI_TEST_MYSQL_HOST not set";
+
+    m_host = host;
+    if (const char* port = std::getenv("KODI_TEST_MYSQL_PORT"))
+      m_port = port;
+    if (const char* user = std::getenv("KODI_TEST_MYSQL_USER"))
+      m_user = user;
+    if (const char* pass = std::getenv("KODI_TEST_MYSQL_PASS"))
+      m_pass = pass;
+  }
+
+  void TearDown() override
+  {
+    if (m_host.empty())
+      return;
+
+    auto database = Connect();
+    if (database)
+      database->drop();
+  }
+
+  std::unique_ptr<MysqlDatabase> Connect()
+  {
+    auto database = std::make_unique<MysqlDatabase>();
+    database->setHostName(m_host.c_str());
+    database->setPort(m_port.c_str());
+    database->setLogin(m_user.c_str());
+    database->setPasswd(m_pass.c_str());
+    database->setDatabase("kodi_test_mysqldatabase");
+    database->setConfig("", "", "", "", "", 5, false);
+    database->setPoolSize(2);
+    if (database->connect(true) != DB_CONNECTION_OK)
+      return {};
+    return database;
+  }
+
+  static int GetInt(Dataset& dataset, const std::string& sql)
+  {
+    dataset.query(sql);
+    return dataset.eof() ? -1 : dataset.fv(0).get_asInt();
+  }
+
+  std::string m_host;
+  std::string m_port{"3306"};
+  std::string m_user{"root"};
+  std::string m_pass;
+};
+} // unnamed namespace
+
+TEST_F(TestMysqlDatabase, PooledConnection)
+{
+  int connectionId;
+  {
+    auto database = Connect();
+    ASSERT_TRUE(database);
+    std::unique_ptr<Dataset> dataset(database->CreateDataset());
+    connectionId = GetInt(*dataset, "SELECT CONNECTION_ID()");
+  }
+
+  // the second database object gets the connection of the first one
+  auto database = Connect();
+  ASSERT_TRUE(database);
+  std::unique_ptr<Dataset> dataset(database->CreateDataset());
+  EXPECT_EQ(connectionId, GetInt(*dataset, "SELECT CONNECTION_ID()"));
+}
+
+TEST_F(TestMysqlDatabase, Batch)
+{
+  auto database = Connect();
+  ASSERT_TRUE(database);
+  std::unique_ptr<Dataset> dataset(database->CreateDataset());
+  dataset->exec("CREATE TABLE batch (id integer primary key, value text)");
+
+  std::vector<std::string> queries;
+  for (int i = 0; i < 100; ++i)
+    queries.emplace_back(database->prepare("INSERT INTO batch (value) VALUES ('%s;')", "a'b"));
+  dataset->exec_batch(queries);
+  EXPECT_EQ(100, GetInt(*dataset, "SELECT COUNT(*) FROM batch WHERE value = 'a''b;'"));
+
+  // the statements after a failing one are not executed
+  queries = {"DELETE FROM batch WHERE id <= 10", "DELETE FROM missing", "DELETE FROM batch",
+             "DELETE FROM batch"};
+  EXPECT_THROW(dataset->exec_batch(queries), DbErrors);
+  EXPECT_EQ(90, GetInt(*dataset, "SELECT COUNT(*) FROM batch"));
+
+  // multi-statements are switched off again
+  EXPECT_THROW(dataset->exec("DELETE FROM batch; DELETE FROM batch"), DbErrors);
+}
@@ -171,9 +171,28 @@ bool CDirectory::GetDirectory(const CURL& url,
     if (!pDirectory)
       return false;
 
+    const bool hideHidden = !CServiceBroker::GetSettingsComponent()->GetSettings()->GetBool(
+                                CSettings::SETTING_FILELISTS_SHOWHIDDEN) &&
+                            !(hints.flags & DIR_FLAG_GET_HIDDEN);
+
     // check our cache for this path
-    if (g_directoryCache.GetDirectory(realURL.Get(), items, (hints.flags & DIR_FLAG_READ_CACHE) == DIR_FLAG_READ_CACHE))
+    const std::shared_ptr<const CFileItemList> cachedItems = g_directoryCache.GetDirectorySnapshot(
+        realURL.Get(), (hints.flags & DIR_FLAG_READ_CACHE) == DIR_FLAG_READ_CACHE);
+    if (cachedItems)
+    {
+      // the snapshot is shared, so copy only the items which pass the filters below
+      pDirectory->SetMask(hints.mask);
+      items.Copy(*cachedItems, false);
+      for (const auto& item : *cachedItems)
+      {
+        if (!item->IsFolder() && !pDirectory->AllowAll() && !pDirectory->IsAllowed(item->GetURL()))
+          continue;
+        if (hideHidden && item->GetProperty("file:hidden").asBoolean())
+          continue;
+        items.Add(std::make_shared<CFileItem>(*item));
+      }
       items.SetURL(url);
+    }
     else
     {
       // need to clear the cache (in case the directory fetch fails)
@@ -186,6 +205,36 @@ bool CDirectory::GetDirectory(const CURL& url,
       bool result = false;
       CURL authUrl = realURL;
 
+      if (hints.itemsCallback)
+      {
+        const bool substitute = url.Get() != realURL.Get();
+        pDirectory->SetItemsCallback(
+            [&](const CFileItemList& batch)
+            {
+              // the batch shares its items with the listing, so work on copies
+              CFileItemList filtered(url.Get());
+              const bool hide = HideCredentials(realURL, authUrl);
+              for (const auto& item : batch)
+              {
+                if (!item->IsFolder() && !pDirectory->AllowAll() &&
+                    !pDirectory->IsAllowed(item->GetURL()))
+                  continue;
+                if (hideHidden && item->GetProperty("file:hidden").asBoolean())
+                  continue;
+
+                auto copy = std::make_shared<CFileItem>(*item);
+                if (hide)
+                  copy->SetPath(GetPathWithoutCredentials(copy->GetURL()));
+                if (substitute)
+                  copy->SetPath(URIUtils::SubstitutePath(copy->GetPath(), true));
+                filtered.Add(copy);
+              }
+              return filtered.IsEmpty() || hints.itemsCallback(filtered);
+            });
+        // needed by IsAllowed() in the callback, the final listing is filtered again below
+        pDirectory->SetMask(hints.mask);
+      }
+
       while (!result)
       {
         const std::string pathToUrl(url.Get());
@@ -210,45 +259,21 @@ bool CDirectory::GetDirectory(const CURL& url,
             continue;
           }
 
+          pDirectory->SetItemsCallback(nullptr);
           CLog::Log(LOGERROR, "{} - Error getting {}", __FUNCTION__, url.GetRedacted());
           return false;
         }
       }
 
+      pDirectory->SetItemsCallback(nullptr);
+
       // hide credentials if necessary
-      if (CPasswordManager::GetInstance().IsURLSupported(realURL))
+      if (HideCredentials(realURL, authUrl))
       {
-        bool hide = false;
-        // for explicitly credentials
-        if (!realURL.GetUserName().empty())
+        for (int i = 0; i < items.Size(); ++i)
         {
-          // credentials was changed i.e. were stored in the password
-          // manager, in this case we can hide them from an item URL,
-          // otherwise we have to keep credentials in an item URL
-          if ( realURL.GetUserName() != authUrl.GetUserName()
-            || realURL.GetPassWord() != authUrl.GetPassWord()
-            || realURL.GetDomain() != authUrl.GetDomain())
-          {
-            hide = true;
-          }
-        }
-        else
-        {
-          // hide credentials in any other cases
-          hide = true;
-        }
-
-        if (hide)
-        {
-          for (int i = 0; i < items.Size(); ++i)
-          {
-            CFileItemPtr item = items[i];
-            CURL itemUrl = item->GetURL();
-            itemUrl.SetDomain("");
-            itemUrl.SetUserName("");
-            itemUrl.SetPassword("");
-            item->SetPath(itemUrl.Get());
-          }
+          CFileItemPtr item = items[i];
+          item->SetPath(GetPathWithoutCredentials(item->GetURL()));
         }
       }
 
@@ -273,7 +298,7 @@ bool CDirectory::GetDirectory(const CURL& url,
     }
     // filter hidden files
     //! @todo we shouldn't be checking the gui setting here, callers should use getHidden instead
-    if (!CServiceBroker::GetSettingsComponent()->GetSettings()->GetBool(CSettings::SETTING_FILELISTS_SHOWHIDDEN) && !(hints.flags & DIR_FLAG_GET_HIDDEN))
+    if (hideHidden)
     {
       for (int i = 0; i < items.Size(); ++i)
       {
@@ -311,6 +336,31 @@ bool CDirectory::GetDirectory(const CURL& url,
   return false;
 }
 
+bool CDirectory::HideCredentials(const CURL& realURL, const CURL& authUrl)
+{
+  if (!CPasswordManager::GetInstance().IsURLSupported(realURL))
+    return false;
+
+  // hide credentials in any case if they weren't given explicitly
+  if (realURL.GetUserName().empty())
+    return true;
+
+  // credentials was changed i.e. were stored in the password
+  // manager, in this case we can hide them from an item URL,
+  // otherwise we have to keep credentials in an item URL
+  return realURL.GetUserName() != authUrl.GetUserName() ||
+         realURL.GetPassWord() != authUrl.GetPassWord() ||
+         realURL.GetDomain() != authUrl.GetDomain();
+}
+
+std::string CDirectory::GetPathWithoutCredentials(CURL url)
+{
+  url.SetDomain("");
+  url.SetUserName("");
+  url.SetPassword("");
+  return url.Get();
+}
+
 bool CDirectory::EnumerateDirectory(
     const std::string& path,
     const DirectoryEnumerationCallback& callback,
@@ -33,6 +33,9 @@ public:
   public:
     std::string mask;
     int flags = DIR_FLAG_DEFAULTS;
+    /*! Receives filtered batches of items while a (slow) directory is still being listed.
+     Batches are only reported for directories that support it and not for cached listings. */
+    IDirectory::ItemsCallback itemsCallback;
   };
 
   static bool GetDirectory(const CURL& url
@@ -102,5 +105,9 @@ public:
   */
   static void FilterFileDirectories(CFileItemList &items, const std::string &mask,
                                     bool expandImages=false);
+
+private:
+  static bool HideCredentials(const CURL& realURL, const CURL& authUrl);
+  static std::string GetPathWithoutCredentials(CURL url);
 };
 }
@@ -12,52 +12,48 @@
 #include "FileItem.h"
 #include "FileItemList.h"
 #include "URL.h"
-#include "utils/StringUtils.h"
+#include "music/tags/MusicInfoTag.h"
+#include "pictures/PictureInfoTag.h"
 #include "utils/URIUtils.h"
 #include "utils/log.h"
+#include "video/VideoInfoTag.h"
 
-#include <algorithm>
-#include <climits>
+#include <iterator>
 #include <mutex>
-
-// Maximum number of directories to keep in our cache
-#define MAX_CACHED_DIRS 50
+#include <utility>
 
 using namespace XFILE;
 
-CDirectoryCache::CDir::CDir(CacheType cacheType) : m_Items(std::make_unique<CFileItemList>())
+CDirectoryCache::CDir::CDir(std::shared_ptr<CFileItemList> items, CacheType cacheType)
+  : m_Items(std::move(items)), m_cacheType(cacheType), m_size(0)
 {
-  m_cacheType = cacheType;
-  m_lastAccess = 0;
-  m_Items->SetIgnoreURLOptions(true);
-  m_Items->SetFastLookup(true);
 }
 
 CDirectoryCache::CDir::~CDir() = default;
 
-void CDirectoryCache::CDir::SetLastAccess(unsigned int &accessCounter)
+CDirectoryCache::CDirectoryCache(size_t budget /* = DEFAULT_BUDGET */) : m_budget(budget)
 {
-  m_lastAccess = accessCounter++;
-}
-
-CDirectoryCache::CDirectoryCache(void)
-{
-  m_accessCounter = 0;
-#ifdef _DEBUG
-  m_cacheHits = 0;
-  m_cacheMisses = 0;
-#endif
 }
 
 CDirectoryCache::~CDirectoryCache(void) = default;
 
 bool CDirectoryCache::GetDirectory(const std::string& strPath, CFileItemList &items, bool retrieveAll)
 {
-  std::unique_lock lock(m_cs);
+  // copy outside of the lock, the snapshot can't change underneath us
+  std::shared_ptr<const CFileItemList> snapshot = GetDirectorySnapshot(strPath, retrieveAll);
+  if (!snapshot)
+    return false;
 
-  // Get rid of any URL options, else the compare may be wrong
-  std::string storedPath = CURL(strPath).GetWithoutOptions();
-  URIUtils::RemoveSlashAtEnd(storedPath);
+  items.Copy(*snapshot);
+  return true;
+}
+
+std::shared_ptr<const CFileItemList> CDirectoryCache::GetDirectorySnapshot(
+    const std::string& strPath, bool retrieveAll /* = false */)
+{
+  const std::string storedPath = GetStoredPath(strPath);
+
+  std::unique_lock lock(m_cs);
 
   auto i = m_cache.find(storedPath);
   if (i != m_cache.end())
@@ -65,15 +61,13 @@ bool CDirectoryCache::GetDirectory(const std::string& strPath, CFileItemList &it
     CDir& dir = i->second;
     if (dir.m_cacheType == CacheType::ALWAYS || (dir.m_cacheType == CacheType::ONCE && retrieveAll))
     {
-      items.Copy(*dir.m_Items);
-      dir.SetLastAccess(m_accessCounter);
-#ifdef _DEBUG
-      m_cacheHits+=items.Size();
-#endif
-      return true;
+      Touch(dir);
+      m_cacheHits++;
+      return dir.m_Items;
     }
   }
-  return false;
+  m_cacheMisses++;
+  return {};
 }
 
 void CDirectoryCache::SetDirectory(const std::string& strPath,
@@ -94,20 +88,31 @@ void CDirectoryCache::SetDirectory(const std::string& strPath,
   // IDEALLY, any further processing on the item would actually create a new item
   // instead of altering it, but we can't really enforce that in an easy way, so
   // this is the best solution for now.
-  std::unique_lock lock(m_cs);
+  // Once cached, the copy is never modified again so that it can be handed out
+  // as a shared snapshot.
+  auto cachedItems = std::make_shared<CFileItemList>();
+  cachedItems->SetIgnoreURLOptions(true);
+  cachedItems->SetFastLookup(true);
+  cachedItems->Copy(items);
 
-  // Get rid of any URL options, else the compare may be wrong
-  std::string storedPath = CURL(strPath).GetWithoutOptions();
-  URIUtils::RemoveSlashAtEnd(storedPath);
+  const std::string storedPath = GetStoredPath(strPath);
 
-  ClearDirectory(storedPath);
+  CDir dir(std::move(cachedItems), cacheType);
+  if (cacheType != CacheType::ALWAYS)
+    dir.m_size = EstimateSize(*dir.m_Items);
 
-  CheckIfFull();
+  std::unique_lock lock(m_cs);
 
-  CDir dir(cacheType);
-  dir.m_Items->Copy(items);
-  dir.SetLastAccess(m_accessCounter);
+  auto existing = m_cache.find(storedPath);
+  if (existing != m_cache.end())
+    Erase(existing);
+
+  m_lru.push_front(storedPath);
+  dir.m_lruPosition = m_lru.begin();
+  m_size += dir.m_size;
   m_cache.emplace(storedPath, std::move(dir));
+
+  CheckIfFull();
 }
 
 void CDirectoryCache::ClearFile(const std::string& strFile)
@@ -121,13 +126,13 @@ void CDirectoryCache::ClearFile(const std::string& strFile)
 
 void CDirectoryCache::ClearDirectory(const std::string& strPath)
 {
-  std::unique_lock lock(m_cs);
+  const std::string storedPath = GetStoredPath(strPath);
 
-  // Get rid of any URL options, else the compare may be wrong
-  std::string storedPath = CURL(strPath).GetWithoutOptions();
-  URIUtils::RemoveSlashAtEnd(storedPath);
+  std::unique_lock lock(m_cs);
 
-  m_cache.erase(storedPath);
+  auto i = m_cache.find(storedPath);
+  if (i != m_cache.end())
+    Erase(i);
 }
 
 void CDirectoryCache::ClearSubPaths(const std::string& strPath)
@@ -141,7 +146,7 @@ void CDirectoryCache::ClearSubPaths(const std::string& strPath)
   while (i != m_cache.end())
   {
     if (URIUtils::PathHasParent(i->first, storedPath))
-      m_cache.erase(i++);
+      Erase(i++);
     else
       i++;
   }
@@ -149,25 +154,43 @@ void CDirectoryCache::ClearSubPaths(const std::string& strPath)
 
 void CDirectoryCache::AddFile(const std::string& strFile)
 {
-  std::unique_lock lock(m_cs);
-
   // Get rid of any URL options, else the compare may be wrong
   std::string strPath = URIUtils::GetDirectory(CURL(strFile).GetWithoutOptions());
   URIUtils::RemoveSlashAtEnd(strPath);
 
+  std::unique_lock lock(m_cs);
+
   auto i = m_cache.find(strPath);
   if (i != m_cache.end())
   {
     CDir& dir = i->second;
-    CFileItemPtr item(new CFileItem(strFile, false));
-    dir.m_Items->Add(item);
-    dir.SetLastAccess(m_accessCounter);
+
+    // snapshots may be in use elsewhere, so copy on write. Once copied the list is
+    // ours alone and further files (e.g. a batch of copied files) are added in place.
+    if (dir.m_Items.use_count() > 1)
+    {
+      auto items = std::make_shared<CFileItemList>();
+      items->SetIgnoreURLOptions(true);
+      items->SetFastLookup(true);
+      items->Copy(*dir.m_Items, false);
+      items->Append(*dir.m_Items);
+      dir.m_Items = std::move(items);
+    }
+
+    auto item = std::make_shared<CFileItem>(strFile, false);
+    if (dir.m_cacheType != CacheType::ALWAYS)
+    {
+      const size_t size = EstimateSize(*item);
+      dir.m_size += size;
+      m_size += size;
+    }
+    dir.m_Items->Add(std::move(item));
+    Touch(dir);
   }
 }
 
 bool CDirectoryCache::FileExists(const std::string& strFile, bool& bInCache)
 {
-  std::unique_lock lock(m_cs);
   bInCache = false;
 
   // Get rid of any URL options, else the compare may be wrong
@@ -176,21 +199,25 @@ bool CDirectoryCache::FileExists(const std::string& strFile, bool& bInCache)
   std::string storedPath = URIUtils::GetDirectory(strPath);
   URIUtils::RemoveSlashAtEnd(storedPath);
 
-  auto i = m_cache.find(storedPath);
-  if (i != m_cache.end())
+  std::shared_ptr<const CFileItemList> items;
   {
-    bInCache = true;
+    std::unique_lock lock(m_cs);
+
+    auto i = m_cache.find(storedPath);
+    if (i == m_cache.end())
+    {
+      m_cacheMisses++;
+      return false;
+    }
+
     CDir& dir = i->second;
-    dir.SetLastAccess(m_accessCounter);
-#ifdef _DEBUG
+    Touch(dir);
     m_cacheHits++;
-#endif
-    return (URIUtils::PathEquals(strPath, storedPath) || dir.m_Items->Contains(strFile));
+    items = dir.m_Items;
   }
-#ifdef _DEBUG
-  m_cacheMisses++;
-#endif
-  return false;
+
+  bInCache = true;
+  return (URIUtils::PathEquals(strPath, storedPath) || items->Contains(strFile));
 }
 
 void CDirectoryCache::Clear()
@@ -198,6 +225,8 @@ void CDirectoryCache::Clear()
   // this routine clears everything
   std::unique_lock lock(m_cs);
   m_cache.clear();
+  m_lru.clear();
+  m_size = 0;
 }
 
 void CDirectoryCache::InitCache(const std::set<std::string>& dirs)
@@ -216,7 +245,7 @@ void CDirectoryCache::ClearCache(std::set<std::string>& dirs)
   while (i != m_cache.end())
   {
     if (dirs.contains(i->first))
-      m_cache.erase(i++);
+      Erase(i++);
     else
       i++;
   }
@@ -226,42 +255,92 @@ void CDirectoryCache::CheckIfFull()
 {
   std::unique_lock lock(m_cs);
 
-  // find the last accessed folder, and remove if the number of cached folders is too many
-  auto lastAccessed = m_cache.end();
-  unsigned int numCached = 0;
-  for (auto i = m_cache.begin(); i != m_cache.end(); i++)
+  // evict the least recently used folders until we're within budget, but
+  // ensure dirs that are always cached aren't cleared
+  auto lru = m_lru.end();
+  while (m_size > m_budget && lru != m_lru.begin())
   {
-    // ensure dirs that are always cached aren't cleared
-    if (i->second.m_cacheType != CacheType::ALWAYS)
+    auto candidate = std::prev(lru);
+    // never evict the folder which was just added
+    if (candidate == m_lru.begin())
+      break;
+
+    auto i = m_cache.find(*candidate);
+    if (i->second.m_cacheType == CacheType::ALWAYS)
     {
-      if (lastAccessed == m_cache.end() ||
-          i->second.GetLastAccess() < lastAccessed->second.GetLastAccess())
-        lastAccessed = i;
-      numCached++;
+      lru = candidate;
+      continue;
     }
+
+    Erase(i);
+    m_evictions++;
   }
-  if (lastAccessed != m_cache.end() && numCached >= MAX_CACHED_DIRS)
-    m_cache.erase(lastAccessed);
 }
 
-#ifdef _DEBUG
-void CDirectoryCache::PrintStats() const
+std::string CDirectoryCache::GetStoredPath(const std::string& strPath)
+{
+  // Get rid of any URL options, else the compare may be wrong
+  std::string storedPath = CURL(strPath).GetWithoutOptions();
+  URIUtils::RemoveSlashAtEnd(storedPath);
+  return storedPath;
+}
+
+size_t CDirectoryCache::EstimateSize(const CFileItemList& items)
+{
+  size_t size = sizeof(CFileItemList);
+  for (const auto& item : items)
+    size += EstimateSize(*item);
+  return size;
+}
+
+size_t CDirectoryCache::EstimateSize(const CFileItem& item)
+{
+  size_t size = sizeof(CFileItem) + item.GetPath().capacity() + item.GetDynPath().capacity() +
+                item.GetLabel().capacity() + item.GetLabel2().capacity();
+  if (item.HasVideoInfoTag())
+    size += sizeof(CVideoInfoTag);
+  if (item.HasMusicInfoTag())
+    size += sizeof(MUSIC_INFO::CMusicInfoTag);
+  if (item.HasPictureInfoTag())
+    size += sizeof(CPictureInfoTag);
+  return size;
+}
+
+void CDirectoryCache::Touch(CDir& dir)
+{
+  m_lru.splice(m_lru.begin(), m_lru, dir.m_lruPosition);
+}
+
+void CDirectoryCache::Erase(std::unordered_map<std::string, CDir>::iterator it)
+{
+  m_size -= it->second.m_size;
+  m_lru.erase(it->second.m_lruPosition);
+  m_cache.erase(it);
+}
+
+CDirectoryCache::Stats CDirectoryCache::GetStats() const
 {
   std::unique_lock lock(m_cs);
-  CLog::Log(LOGDEBUG, "{} - total of {} cache hits, and {} cache misses", __FUNCTION__, m_cacheHits,
-            m_cacheMisses);
-  // run through and find the oldest and the number of items cached
-  unsigned int oldest = UINT_MAX;
-  unsigned int numItems = 0;
-  unsigned int numDirs = 0;
-  for (auto i = m_cache.begin(); i != m_cache.end(); i++)
-  {
-    const CDir& dir = i->second;
-    oldest = std::min(oldest, dir.GetLastAccess());
-    numItems += dir.m_Items->Size();
-    numDirs++;
-  }
-  CLog::Log(LOGDEBUG, "{} - {} folders cached, with {} items total.  Oldest is {}, current is {}",
-            __FUNCTION__, numDirs, numItems, oldest, m_accessCounter);
+
+  Stats stats;
+  stats.hits = m_cacheHits;
+  stats.misses = m_cacheMisses;
+  stats.evictions = m_evictions;
+  stats.directories = m_cache.size();
+  stats.bytes = m_size;
+  stats.budget = m_budget;
+  for (const auto& it : m_cache)
+    stats.items += it.second.m_Items->Size();
+
+  return stats;
+}
+
+void CDirectoryCache::PrintStats() const
+{
+  const Stats stats = GetStats();
+  CLog::Log(LOGDEBUG,
+            "{} - {} cache hits, {} cache misses, {} evictions. {} folders cached, with {} items "
+            "total using {} of {} bytes",
+            __FUNCTION__, stats.hits, stats.misses, stats.evictions, stats.directories,
+            stats.items, stats.bytes, stats.budget);
 }
-#endif
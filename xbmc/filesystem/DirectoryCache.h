@@ -11,9 +11,11 @@
 #include "IDirectory.h"
 #include "threads/CriticalSection.h"
 
-#include <map>
+#include <list>
 #include <memory>
 #include <set>
+#include <string>
+#include <unordered_map>
 
 class CFileItem;
 
@@ -24,26 +26,44 @@ namespace XFILE
     class CDir
     {
     public:
-      explicit CDir(CacheType cacheType);
+      CDir(std::shared_ptr<CFileItemList> items, CacheType cacheType);
       CDir(CDir&& dir) = default;
       CDir& operator=(CDir&& dir) = default;
       virtual ~CDir();
 
-      void SetLastAccess(unsigned int &accessCounter);
-      unsigned int GetLastAccess() const { return m_lastAccess; }
-
-      std::unique_ptr<CFileItemList> m_Items;
+      std::shared_ptr<CFileItemList> m_Items; ///< only modified while no snapshot is handed out
       CacheType m_cacheType;
+      size_t m_size; ///< estimated memory footprint of m_Items in bytes
+      std::list<std::string>::iterator m_lruPosition;
 
     private:
       CDir(const CDir&) = delete;
       CDir& operator=(const CDir&) = delete;
-      unsigned int m_lastAccess;
     };
   public:
-    CDirectoryCache(void);
+    struct Stats
+    {
+      uint64_t hits = 0;
+      uint64_t misses = 0;
+      uint64_t evictions = 0;
+      size_t directories = 0;
+      size_t items = 0;
+      size_t bytes = 0;
+      size_t budget = 0;
+    };
+
+    /*!
+     \param budget maximum estimated memory (in bytes) used by directories which aren't always cached
+     */
+    explicit CDirectoryCache(size_t budget = DEFAULT_BUDGET);
     virtual ~CDirectoryCache(void);
     bool GetDirectory(const std::string& strPath, CFileItemList &items, bool retrieveAll = false);
+    /*!
+     \brief Get a shared, read-only snapshot of a cached directory without copying its items.
+     \return the cached items or nullptr if the directory isn't (retrievably) cached.
+     */
+    std::shared_ptr<const CFileItemList> GetDirectorySnapshot(const std::string& strPath,
+                                                              bool retrieveAll = false);
     void SetDirectory(const std::string& strPath, const CFileItemList& items, CacheType cacheType);
     void ClearDirectory(const std::string& strPath);
     void ClearFile(const std::string& strFile);
@@ -51,24 +71,33 @@ namespace XFILE
     void Clear();
     void AddFile(const std::string& strFile);
     bool FileExists(const std::string& strPath, bool& bInCache);
-#ifdef _DEBUG
+    Stats GetStats() const;
     void PrintStats() const;
-#endif
+
+    static constexpr size_t DEFAULT_BUDGET = 32 * 1024 * 1024;
+
   protected:
     void InitCache(const std::set<std::string>& dirs);
     void ClearCache(std::set<std::string>& dirs);
     void CheckIfFull();
 
-    std::map<std::string, CDir> m_cache;
+    static std::string GetStoredPath(const std::string& strPath);
+    static size_t EstimateSize(const CFileItemList& items);
+    static size_t EstimateSize(const CFileItem& item);
+    void Touch(CDir& dir);
+    void Erase(std::unordered_map<std::string, CDir>::iterator it);
+
+    std::unordered_map<std::string, CDir> m_cache;
+    std::list<std::string> m_lru; ///< most recently used paths first
 
     mutable CCriticalSection m_cs;
 
-    unsigned int m_accessCounter;
+    size_t m_budget;
+    size_t m_size = 0;
 
-#ifdef _DEBUG
-    unsigned int m_cacheHits;
-    unsigned int m_cacheMisses;
-#endif
+    uint64_t m_cacheHits = 0;
+    uint64_t m_cacheMisses = 0;
+    uint64_t m_evictions = 0;
   };
 }
 extern XFILE::CDirectoryCache g_directoryCache;
@@ -295,6 +295,13 @@ bool CHTTPDirectory::GetDirectory(const CURL& url, CFileItemList &items)
           }
         }
         items.Add(pItem);
+
+        if (!ReportItems(items))
+        {
+          http.Close();
+          items.ClearItems();
+          return false;
+        }
       }
     }
   }
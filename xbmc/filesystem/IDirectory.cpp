@@ -8,6 +8,8 @@
 
 #include "IDirectory.h"
 
+#include "FileItem.h"
+#include "FileItemList.h"
 #include "PasswordManager.h"
 #include "URL.h"
 #include "guilib/GUIKeyboardFactory.h"
@@ -116,6 +118,34 @@ void IDirectory::SetFlags(int flags)
   m_flags = flags;
 }
 
+void IDirectory::SetItemsCallback(ItemsCallback callback)
+{
+  m_itemsCallback = std::move(callback);
+  m_itemsReported = 0;
+}
+
+bool IDirectory::ReportItems(const CFileItemList& items)
+{
+  // batches are only worth the extra work for listings that take a while to arrive
+  static constexpr int ITEMS_BATCH_SIZE = 100;
+
+  if (!m_itemsCallback)
+    return true;
+
+  if (items.Size() < m_itemsReported)
+    m_itemsReported = 0;
+
+  if (items.Size() - m_itemsReported < ITEMS_BATCH_SIZE)
+    return true;
+
+  CFileItemList batch(items.GetPath());
+  for (int i = m_itemsReported; i < items.Size(); ++i)
+    batch.Add(items[i]);
+  m_itemsReported = items.Size();
+
+  return m_itemsCallback(batch);
+}
+
 bool IDirectory::ProcessRequirements()
 {
   std::string type = m_requirements["type"].asString();
@@ -10,6 +10,7 @@
 
 #include "utils/Variant.h"
 
+#include <functional>
 #include <string>
 
 class CFileItemList;
@@ -139,6 +140,13 @@ public:
   void SetMask(const std::string& strMask);
   void SetFlags(int flags);
 
+  /*! \brief Callback receiving batches of items while a directory is still being enumerated.
+   The batches are a preview only, the list returned by GetDirectory stays authoritative.
+   \return false to stop the enumeration early.
+   */
+  using ItemsCallback = std::function<bool(const CFileItemList& batch)>;
+  void SetItemsCallback(ItemsCallback callback);
+
   /*! \brief Process additional requirements before the directory fetch is performed.
    Some directory fetches may require authentication, keyboard input etc.  The IDirectory subclass
    should call GetKeyboardInput, SetErrorDialog or RequireAuthentication and then return false
@@ -187,6 +195,15 @@ protected:
    */
   void RequireAuthentication(const CURL& url);
 
+  /*! \brief Report the items added to the listing since the last call to the items callback.
+   Call this method from the GetDirectory method of slow (remote) directories while enumerating.
+   Items are passed on in batches, so it is cheap to call this for every added item.
+   \param items the listing being filled by GetDirectory.
+   \return false if the enumeration should be stopped.
+   \sa SetItemsCallback
+   */
+  bool ReportItems(const CFileItemList& items);
+
   static const CProfileManager *m_profileManager;
 
   std::string m_strFileMask;  ///< Holds the file mask specified by SetMask()
@@ -194,5 +211,8 @@ protected:
   int m_flags; ///< Directory flags - see DIR_FLAG
 
   CVariant m_requirements;
+
+  ItemsCallback m_itemsCallback;
+  int m_itemsReported = 0;
 };
 }
@@ -240,6 +240,7 @@ bool CNFSDirectory::GetDirectory(const CURL& url, CFileItemList &items)
   }
   lock.unlock();
 
+  bool cancelled = false;
   while((nfsdirent = nfs_readdir(gNfsConnection.GetNfsContext(), nfsdir)) != NULL)
   {
     struct nfsdirent tmpDirent = *nfsdirent;
@@ -301,12 +302,24 @@ bool CNFSDirectory::GetDirectory(const CURL& url, CFileItemList &items)
       }
       pItem->SetPath(path);
       items.Add(pItem);
+
+      if (!ReportItems(items))
+      {
+        cancelled = true;
+        break;
+      }
     }
   }
 
   lock.lock();
   nfs_closedir(gNfsConnection.GetNfsContext(), nfsdir);//close the dir
   lock.unlock();
+
+  if (cancelled)
+  {
+    items.ClearItems();
+    return false;
+  }
   return true;
 }
 
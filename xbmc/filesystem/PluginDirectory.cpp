@@ -10,6 +10,8 @@
 
 #include "FileItem.h"
 #include "FileItemList.h"
+#include "GUIUserMessages.h"
+#include "PluginDirectoryCache.h"
 #include "ServiceBroker.h"
 #include "SortFileItem.h"
 #include "URL.h"
@@ -18,15 +20,20 @@
 #include "addons/IAddon.h"
 #include "addons/PluginSource.h"
 #include "addons/addoninfo/AddonType.h"
+#include "guilib/GUIComponent.h"
+#include "guilib/GUIWindowManager.h"
 #include "interfaces/generic/RunningScriptObserver.h"
 #include "messaging/ApplicationMessenger.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
+#include "threads/CriticalSection.h"
+#include "utils/JobManager.h"
 #include "utils/URIUtils.h"
 #include "utils/log.h"
 #include "video/VideoInfoTag.h"
 
 #include <mutex>
+#include <set>
 
 using namespace XFILE;
 using namespace ADDON;
@@ -52,6 +59,10 @@ std::string GetOriginalPluginPath(const CFileItem& item)
 
   return std::string();
 }
+
+// stale listings currently being refreshed in the background
+CCriticalSection refreshSection;
+std::set<std::string> refreshingPaths;
 } // unnamed namespace
 
 CPluginDirectory::CPluginDirectory()
@@ -469,7 +480,22 @@ void CPluginDirectory::AddSortMethod(int handle,
 bool CPluginDirectory::GetDirectory(const CURL& url, CFileItemList& items)
 {
   const std::string pathToUrl(url.Get());
+
+  // serve listings the plugin asked us to cache without running it again
+  CFileItemList cachedItems;
+  const auto cacheState = CPluginDirectoryCache::GetDirectory(pathToUrl, cachedItems);
+  if (cacheState != CPluginDirectoryCache::State::MISSING)
+  {
+    if (cacheState == CPluginDirectoryCache::State::STALE)
+      RefreshCachedDirectory(pathToUrl);
+
+    items.Assign(cachedItems, true); // true to keep the current items
+    return true;
+  }
+
   bool success = StartScript(pathToUrl, false);
+  if (success)
+    CPluginDirectoryCache::SetDirectory(pathToUrl, *m_listItems);
 
   // append the items to the list
   items.Assign(*m_listItems, true); // true to keep the current items
@@ -477,6 +503,37 @@ bool CPluginDirectory::GetDirectory(const CURL& url, CFileItemList& items)
   return success;
 }
 
+void CPluginDirectory::RefreshCachedDirectory(const std::string& strPath)
+{
+  {
+    // a stale listing is served until the refresh is done, don't run the plugin for each request
+    std::unique_lock<CCriticalSection> lock(refreshSection);
+    if (!refreshingPaths.insert(strPath).second)
+      return;
+  }
+
+  CServiceBroker::GetJobManager()->Submit(
+      [strPath]()
+      {
+        CPluginDirectory dir;
+        const bool success = dir.StartScript(strPath, false) &&
+                             CPluginDirectoryCache::SetDirectory(strPath, *dir.m_listItems);
+
+        {
+          std::unique_lock<CCriticalSection> lock(refreshSection);
+          refreshingPaths.erase(strPath);
+        }
+
+        if (success)
+        {
+          // let an active window showing the stale listing pick up the new one
+          CGUIMessage message(GUI_MSG_NOTIFY_ALL, 0, 0, GUI_MSG_UPDATE_PATH);
+          message.SetStringParam(strPath);
+          CServiceBroker::GetGUI()->GetWindowManager().SendThreadMessage(message);
+        }
+      });
+}
+
 bool CPluginDirectory::RunScriptWithParams(const std::string& strPath, bool resume)
 {
   CURL url(strPath);
@@ -548,6 +605,14 @@ void CPluginDirectory::SetProperty(int handle, const std::string &strProperty, c
     dir->m_listItems->SetProperty(strProperty, strValue);
 }
 
+void CPluginDirectory::InvalidateCache(int handle, const std::string& tag)
+{
+  std::unique_lock lock(GetScriptsLock());
+  CPluginDirectory* dir = GetScriptFromHandle(handle);
+  if (dir && dir->GetAddon())
+    CPluginDirectoryCache::Invalidate(dir->GetAddon()->ID(), tag);
+}
+
 void CPluginDirectory::CancelDirectory()
 {
   m_cancelled = true;
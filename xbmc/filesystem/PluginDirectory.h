@@ -73,6 +73,7 @@ public:
   static void SetProperty(int handle, const std::string &strProperty, const std::string &strValue);
   static void SetResolvedUrl(int handle, bool success, const CFileItem* resultItem);
   static void SetLabel2(int handle, const std::string& ident);
+  static void InvalidateCache(int handle, const std::string& tag);
 
 protected:
   // implementations of CRunningScriptsHandler / CScriptRunner
@@ -81,6 +82,7 @@ protected:
 
 private:
   bool StartScript(const std::string& strPath, bool resume);
+  static void RefreshCachedDirectory(const std::string& strPath);
 
   std::unique_ptr<CFileItemList> m_listItems;
   std::unique_ptr<CFileItem> m_fileResult;
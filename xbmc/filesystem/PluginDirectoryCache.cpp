@@ -0,0 +1,327 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "PluginDirectoryCache.h"
+
+#include "FileItem.h"
+#include "FileItemList.h"
+#include "URL.h"
+#include "Util.h"
+#include "filesystem/Directory.h"
+#include "filesystem/File.h"
+#include "utils/Archive.h"
+#include "utils/Crc32.h"
+#include "utils/StringUtils.h"
+#include "utils/URIUtils.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+using namespace XFILE;
+
+namespace
+{
+// bump whenever the layout of the cache header changes
+constexpr int PLUGIN_CACHE_VERSION = 2;
+
+// identity of listings stored under a plugin-declared cache key
+constexpr const char* KEY_PREFIX = "key:";
+
+struct CacheHeader
+{
+  int version = PLUGIN_CACHE_VERSION;
+  long long created = 0;
+  long long ttl = 0;
+  long long stale = 0;
+  std::string url; //!< the url or key the listing belongs to, file names are only hashes of it
+  std::string key; //!< set if the listing of the url is stored under this cache key
+  std::string tag;
+  bool replaceListing = false;
+
+  void Store(CArchive& ar) const
+  {
+    ar << version;
+    ar << created;
+    ar << ttl;
+    ar << stale;
+    ar << url;
+    ar << key;
+    ar << tag;
+    ar << replaceListing;
+  }
+
+  bool Load(CArchive& ar)
+  {
+    ar >> version;
+    if (version != PLUGIN_CACHE_VERSION)
+      return false;
+
+    ar >> created;
+    ar >> ttl;
+    ar >> stale;
+    ar >> url;
+    ar >> key;
+    ar >> tag;
+    ar >> replaceListing;
+    return true;
+  }
+};
+
+/*!
+ \brief Load a cache file.
+ \param key set to the cache key if the file only points to a listing stored under a key.
+ */
+CPluginDirectoryCache::State LoadCacheFile(const std::string& cacheFile,
+                                           const std::string& identity,
+                                           CFileItemList& items,
+                                           std::string& key)
+{
+  using State = CPluginDirectoryCache::State;
+
+  CFile file;
+  if (!file.Open(cacheFile))
+    return State::MISSING;
+
+  try
+  {
+    CArchive ar(&file, CArchive::load);
+
+    CacheHeader header;
+    if (!header.Load(ar))
+    {
+      ar.Close();
+      file.Close();
+      CFile::Delete(cacheFile);
+      return State::MISSING;
+    }
+
+    // another url with the same hash owns the file
+    if (header.url != identity)
+    {
+      ar.Close();
+      file.Close();
+      return State::MISSING;
+    }
+
+    // the listing is stored under the key and ages there
+    if (!header.key.empty())
+    {
+      key = header.key;
+      ar.Close();
+      file.Close();
+      return State::FRESH;
+    }
+
+    const State state = CPluginDirectoryCache::GetState(static_cast<time_t>(header.created),
+                                                        time(nullptr), header.ttl, header.stale);
+    if (state == State::MISSING)
+    {
+      ar.Close();
+      file.Close();
+      CFile::Delete(cacheFile);
+      return State::MISSING;
+    }
+
+    ar >> items;
+    items.SetReplaceListing(header.replaceListing);
+    ar.Close();
+    file.Close();
+    return state;
+  }
+  catch (const std::out_of_range&)
+  {
+    CLog::Log(LOGERROR, "CPluginDirectoryCache: corrupt cache file {}", cacheFile);
+  }
+
+  file.Close();
+  CFile::Delete(cacheFile);
+  return State::MISSING;
+}
+
+bool StoreCacheFile(const std::string& cacheFile,
+                    const CacheHeader& header,
+                    CFileItemList* items)
+{
+  // write to a temporary file first so that readers never see a partial listing
+  const std::string tempFile = cacheFile + "." + StringUtils::CreateUUID() + ".tmp";
+
+  CFile file;
+  if (!file.OpenForWrite(tempFile, true))
+    return false;
+
+  CArchive ar(&file, CArchive::store);
+  header.Store(ar);
+  if (items)
+    ar << *items;
+  ar.Close();
+  file.Close();
+
+  if (CFile::Rename(tempFile, cacheFile))
+    return true;
+
+  // renaming over an existing file isn't supported everywhere
+  CFile::Delete(cacheFile);
+  if (CFile::Rename(tempFile, cacheFile))
+    return true;
+
+  CFile::Delete(tempFile);
+  return false;
+}
+} // unnamed namespace
+
+CPluginDirectoryCache::State CPluginDirectoryCache::GetDirectory(const std::string& strPath,
+                                                                 CFileItemList& items)
+{
+  const std::string identity = CURL(strPath).Get();
+
+  std::string key;
+  State state = LoadCacheFile(GetCacheFile(strPath, identity), identity, items, key);
+  if (!key.empty())
+  {
+    const std::string keyIdentity = KEY_PREFIX + key;
+    key.clear();
+    state = LoadCacheFile(GetCacheFile(strPath, keyIdentity), keyIdentity, items, key);
+    // keys don't point to other keys
+    if (!key.empty())
+      state = State::MISSING;
+  }
+
+  if (state == State::MISSING)
+  {
+    items.Clear();
+    return State::MISSING;
+  }
+
+  items.SetPath(strPath);
+  CLog::Log(LOGDEBUG, "CPluginDirectoryCache: loaded {} {} items for {}", items.Size(),
+            state == State::FRESH ? "fresh" : "stale", CURL::GetRedacted(strPath));
+  return state;
+}
+
+bool CPluginDirectoryCache::SetDirectory(const std::string& strPath, CFileItemList& items)
+{
+  const int64_t ttl = items.GetProperty(PROPERTY_TTL).asInteger();
+  if (ttl <= 0 || items.IsEmpty())
+    return false;
+
+  CacheHeader header;
+  header.created = static_cast<long long>(time(nullptr));
+  header.ttl = ttl;
+  header.stale = items.HasProperty(PROPERTY_STALE) ? items.GetProperty(PROPERTY_STALE).asInteger()
+                                                   : ttl;
+  header.tag = items.GetProperty(PROPERTY_TAG).asString();
+  header.replaceListing = items.GetReplaceListing();
+
+  const std::string folder = GetCacheFolder(CURL(strPath).GetHostName());
+  if (!CDirectory::Exists(folder) && !CUtil::CreateDirectoryEx(folder))
+    return false;
+
+  const std::string identity = CURL(strPath).Get();
+  const std::string key = items.GetProperty(PROPERTY_KEY).asString();
+  if (key.empty())
+  {
+    header.url = identity;
+    if (!StoreCacheFile(GetCacheFile(strPath, identity), header, &items))
+      return false;
+  }
+  else
+  {
+    // store the listing under its key and point the url to it
+    header.url = KEY_PREFIX + key;
+    if (!StoreCacheFile(GetCacheFile(strPath, header.url), header, &items))
+      return false;
+
+    header.url = identity;
+    header.key = key;
+    if (!StoreCacheFile(GetCacheFile(strPath, identity), header, nullptr))
+      return false;
+  }
+
+  CLog::Log(LOGDEBUG, "CPluginDirectoryCache: stored {} items for {} (ttl {}s, stale {}s)",
+            items.Size(), CURL::GetRedacted(strPath), header.ttl, header.stale);
+  return true;
+}
+
+void CPluginDirectoryCache::Invalidate(const std::string& addonId, const std::string& tag /* = "" */)
+{
+  if (addonId.empty())
+    return;
+
+  const std::string folder = GetCacheFolder(addonId);
+  if (tag.empty())
+  {
+    CLog::Log(LOGDEBUG, "CPluginDirectoryCache: invalidating all listings of {}", addonId);
+    CDirectory::RemoveRecursive(folder);
+    return;
+  }
+
+  CFileItemList cacheFiles;
+  if (!CDirectory::GetDirectory(folder, cacheFiles, ".fi",
+                                DIR_FLAG_NO_FILE_DIRS | DIR_FLAG_BYPASS_CACHE))
+    return;
+
+  for (const auto& cacheFile : cacheFiles)
+  {
+    CacheHeader header;
+    bool matches = false;
+    {
+      CFile file;
+      if (!file.Open(cacheFile->GetPath()))
+        continue;
+
+      try
+      {
+        CArchive ar(&file, CArchive::load);
+        // unreadable headers belong to an older version and can go as well
+        matches = !header.Load(ar) || header.tag == tag;
+        ar.Close();
+      }
+      catch (const std::out_of_range&)
+      {
+        matches = true;
+      }
+      file.Close();
+    }
+
+    if (matches)
+      CFile::Delete(cacheFile->GetPath());
+  }
+}
+
+CPluginDirectoryCache::State CPluginDirectoryCache::GetState(time_t created,
+                                                             time_t now,
+                                                             int64_t ttl,
+                                                             int64_t stale)
+{
+  // treat entries from the future (clock changes) as expired
+  if (ttl <= 0 || now < created)
+    return State::MISSING;
+
+  const int64_t age = static_cast<int64_t>(now - created);
+  if (age < ttl)
+    return State::FRESH;
+
+  if (age < ttl + std::max<int64_t>(stale, 0))
+    return State::STALE;
+
+  return State::MISSING;
+}
+
+std::string CPluginDirectoryCache::GetCacheFolder(const std::string& addonId)
+{
+  return URIUtils::AddFileToFolder("special://temp/archive_cache/plugins/", addonId + "/");
+}
+
+std::string CPluginDirectoryCache::GetCacheFile(const std::string& strPath,
+                                                const std::string& identity)
+{
+  // plugin parameters are case sensitive so don't use the lower case crc
+  return StringUtils::Format("{}{:08x}.fi", GetCacheFolder(CURL(strPath).GetHostName()),
+                             Crc32::Compute(identity));
+}
@@ -0,0 +1,74 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <ctime>
+#include <stdint.h>
+#include <string>
+
+class CFileItemList;
+
+namespace XFILE
+{
+/*!
+ \brief Persistent cache for plugin:// directory listings.
+
+ Plugins opt in per listing by setting the "cache.ttl" container property (in seconds) before
+ calling endOfDirectory(). The optional "cache.stale" property defines how many seconds past the
+ TTL the cached listing may still be served while it is refreshed in the background, and the
+ optional "cache.tag" property groups listings so that the plugin can invalidate them together.
+ The optional "cache.key" property stores the listing under a plugin-defined key so that urls
+ declaring the same key share one listing.
+ */
+class CPluginDirectoryCache
+{
+public:
+  enum class State
+  {
+    MISSING,
+    FRESH,
+    STALE,
+  };
+
+  static constexpr const char* PROPERTY_TTL = "cache.ttl";
+  static constexpr const char* PROPERTY_STALE = "cache.stale";
+  static constexpr const char* PROPERTY_TAG = "cache.tag";
+  static constexpr const char* PROPERTY_KEY = "cache.key";
+
+  /*!
+   \brief Load a cached listing.
+   \param strPath the full plugin:// url of the listing.
+   \param items the list to fill with the cached items.
+   \return MISSING if nothing usable is cached, FRESH if the listing is still within its TTL and
+   STALE if it may be shown but has to be refreshed.
+   */
+  static State GetDirectory(const std::string& strPath, CFileItemList& items);
+
+  /*!
+   \brief Store a listing if the plugin asked for it to be cached.
+   \param strPath the full plugin:// url of the listing.
+   \param items the listing as returned by the plugin.
+   \return true if the listing was written to the cache, false otherwise.
+   */
+  static bool SetDirectory(const std::string& strPath, CFileItemList& items);
+
+  /*!
+   \brief Remove cached listings of a plugin.
+   \param addonId the id of the plugin.
+   \param tag only remove listings stored with this "cache.tag", all listings if empty.
+   */
+  static void Invalidate(const std::string& addonId, const std::string& tag = "");
+
+  static State GetState(time_t created, time_t now, int64_t ttl, int64_t stale);
+
+private:
+  static std::string GetCacheFolder(const std::string& addonId);
+  static std::string GetCacheFile(const std::string& strPath, const std::string& identity);
+};
+} // namespace XFILE
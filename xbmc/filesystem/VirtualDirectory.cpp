@@ -60,15 +60,18 @@ bool CVirtualDirectory::GetDirectory(const CURL& url, CFileItemList &items)
 bool CVirtualDirectory::GetDirectory(const CURL& url, CFileItemList &items, bool bUseFileDirectories, bool keepImpl)
 {
   std::string strPath = url.Get();
-  int flags = m_flags;
+  CDirectory::CHints hints;
+  hints.mask = m_strFileMask;
+  hints.flags = m_flags;
+  hints.itemsCallback = m_itemsCallback;
   if (!bUseFileDirectories)
-    flags |= DIR_FLAG_NO_FILE_DIRS;
+    hints.flags |= DIR_FLAG_NO_FILE_DIRS;
   if (!strPath.empty() && strPath != "files://")
   {
     CURL realURL = URIUtils::SubstitutePath(url);
     if (!m_pDir)
       m_pDir.reset(CDirectoryFactory::Create(realURL));
-    bool ret = CDirectory::GetDirectory(strPath, m_pDir, items, m_strFileMask, flags);
+    bool ret = CDirectory::GetDirectory(url, m_pDir, items, hints);
     if (!keepImpl)
       m_pDir.reset();
     return ret;
@@ -8,16 +8,41 @@
 
 #include "FileItem.h"
 #include "FileItemList.h"
+#include "URL.h"
 #include "filesystem/Directory.h"
 #include "filesystem/DirectoryFactory.h"
 #include "filesystem/IDirectory.h"
 #include "filesystem/SpecialProtocol.h"
 #include "test/TestUtils.h"
+#include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 #include "video/VideoInfoTag.h"
 
+#include <memory>
+
 #include <gtest/gtest.h>
 
+namespace
+{
+class CSlowDirectory : public XFILE::IDirectory
+{
+public:
+  bool GetDirectory(const CURL& url, CFileItemList& items) override
+  {
+    for (int i = 0; i < 250; ++i)
+    {
+      const std::string name = StringUtils::Format("file{}.{}", i, i % 2 ? "mkv" : "txt");
+      auto item = std::make_shared<CFileItem>(name);
+      item->SetPath(URIUtils::AddFileToFolder(url.Get(), name));
+      items.Add(item);
+      if (!ReportItems(items))
+        return false;
+    }
+    return true;
+  }
+};
+} // namespace
+
 TEST(TestDirectory, General)
 {
   std::string tmppath1, tmppath2, tmppath3;
@@ -91,3 +116,32 @@ TEST(TestDirectory, BlurayResolve)
   }
 }
 #endif
+
+TEST(TestDirectory, ItemsCallback)
+{
+  int batches = 0;
+  int reported = 0;
+  XFILE::CDirectory::CHints hints;
+  hints.mask = ".mkv";
+  hints.flags = XFILE::DIR_FLAG_BYPASS_CACHE | XFILE::DIR_FLAG_NO_FILE_DIRS;
+  hints.itemsCallback = [&](const CFileItemList& batch)
+  {
+    batches++;
+    reported += batch.Size();
+    for (const auto& item : batch)
+      EXPECT_TRUE(URIUtils::HasExtension(item->GetPath(), ".mkv"));
+    return true;
+  };
+
+  CFileItemList items;
+  const auto dir = std::make_shared<CSlowDirectory>();
+  EXPECT_TRUE(XFILE::CDirectory::GetDirectory(CURL("/slow/"), dir, items, hints));
+  EXPECT_EQ(2, batches);
+  EXPECT_EQ(100, reported);
+  EXPECT_EQ(125, items.Size());
+
+  // stopping the enumeration fails the listing
+  hints.itemsCallback = [](const CFileItemList&) { return false; };
+  items.Clear();
+  EXPECT_FALSE(XFILE::CDirectory::GetDirectory(CURL("/slow/"), dir, items, hints));
+}
@@ -0,0 +1,135 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "FileItem.h"
+#include "FileItemList.h"
+#include "filesystem/DirectoryCache.h"
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+using namespace XFILE;
+
+namespace
+{
+void SetDirectory(CDirectoryCache& cache, const std::string& path, int count, CacheType cacheType)
+{
+  CFileItemList items;
+  items.SetPath(path);
+  for (int i = 0; i < count; ++i)
+    items.Add(std::make_shared<CFileItem>(path + "file" + std::to_string(i) + ".mkv", false));
+  cache.SetDirectory(path, items, cacheType);
+}
+} // namespace
+
+TEST(TestDirectoryCache, HitsAndMisses)
+{
+  CDirectoryCache cache;
+  CFileItemList items;
+
+  EXPECT_FALSE(cache.GetDirectory("smb://server/share/", items));
+  SetDirectory(cache, "smb://server/share/", 3, CacheType::ALWAYS);
+  EXPECT_TRUE(cache.GetDirectory("smb://server/share", items));
+  EXPECT_EQ(3, items.Size());
+
+  bool inCache = false;
+  EXPECT_TRUE(cache.FileExists("smb://server/share/file1.mkv", inCache));
+  EXPECT_TRUE(inCache);
+  EXPECT_FALSE(cache.FileExists("smb://server/share/missing.mkv", inCache));
+  EXPECT_TRUE(inCache);
+  EXPECT_FALSE(cache.FileExists("smb://server/other/file1.mkv", inCache));
+  EXPECT_FALSE(inCache);
+
+  const CDirectoryCache::Stats stats = cache.GetStats();
+  EXPECT_EQ(3u, stats.hits);
+  EXPECT_EQ(2u, stats.misses);
+  EXPECT_EQ(1u, stats.directories);
+  EXPECT_EQ(3u, stats.items);
+}
+
+TEST(TestDirectoryCache, SnapshotsAreImmutable)
+{
+  CDirectoryCache cache;
+  SetDirectory(cache, "nfs://server/export/", 2, CacheType::ALWAYS);
+
+  auto snapshot = cache.GetDirectorySnapshot("nfs://server/export/");
+  ASSERT_NE(nullptr, snapshot);
+  EXPECT_EQ(2, snapshot->Size());
+
+  cache.AddFile("nfs://server/export/new.mkv");
+  EXPECT_EQ(2, snapshot->Size());
+
+  auto updated = cache.GetDirectorySnapshot("nfs://server/export/");
+  ASSERT_NE(nullptr, updated);
+  EXPECT_EQ(3, updated->Size());
+
+  // once cached folders are only handed out when asked for explicitly
+  SetDirectory(cache, "nfs://server/once/", 1, CacheType::ONCE);
+  EXPECT_EQ(nullptr, cache.GetDirectorySnapshot("nfs://server/once/"));
+  EXPECT_NE(nullptr, cache.GetDirectorySnapshot("nfs://server/once/", true));
+}
+
+TEST(TestDirectoryCache, EvictsLeastRecentlyUsedWithinBudget)
+{
+  // room for roughly two folders
+  CDirectoryCache sizing;
+  SetDirectory(sizing, "dav://server/a/", 100, CacheType::ONCE);
+  const size_t folderSize = sizing.GetStats().bytes;
+  ASSERT_GT(folderSize, 0u);
+
+  CDirectoryCache cache(folderSize * 2 + folderSize / 2);
+  SetDirectory(cache, "dav://server/a/", 100, CacheType::ONCE);
+  SetDirectory(cache, "dav://server/b/", 100, CacheType::ONCE);
+
+  // touch a so that b is the least recently used one
+  EXPECT_NE(nullptr, cache.GetDirectorySnapshot("dav://server/a/", true));
+  SetDirectory(cache, "dav://server/c/", 100, CacheType::ONCE);
+
+  EXPECT_NE(nullptr, cache.GetDirectorySnapshot("dav://server/a/", true));
+  EXPECT_EQ(nullptr, cache.GetDirectorySnapshot("dav://server/b/", true));
+  EXPECT_NE(nullptr, cache.GetDirectorySnapshot("dav://server/c/", true));
+
+  const CDirectoryCache::Stats stats = cache.GetStats();
+  EXPECT_EQ(1u, stats.evictions);
+  EXPECT_EQ(2u, stats.directories);
+  EXPECT_LE(stats.bytes, stats.budget);
+
+  // folders which are always cached don't count against the budget
+  SetDirectory(cache, "dav://server/d/", 1000, CacheType::ALWAYS);
+  EXPECT_NE(nullptr, cache.GetDirectorySnapshot("dav://server/d/"));
+  EXPECT_EQ(3u, cache.GetStats().directories);
+
+  cache.ClearSubPaths("dav://server/");
+  EXPECT_EQ(0u, cache.GetStats().directories);
+  EXPECT_EQ(0u, cache.GetStats().bytes);
+}
+
+TEST(TestDirectoryCache, AddFileInPlace)
+{
+  CDirectoryCache cache;
+  SetDirectory(cache, "smb://server/copies/", 2, CacheType::ONCE);
+  const size_t bytes = cache.GetStats().bytes;
+
+  const CFileItemList* list = cache.GetDirectorySnapshot("smb://server/copies/", true).get();
+  ASSERT_NE(nullptr, list);
+
+  // no snapshot is held, so the files are added without copying the listing
+  for (int i = 0; i < 3; ++i)
+    cache.AddFile("smb://server/copies/copy" + std::to_string(i) + ".mkv");
+
+  auto snapshot = cache.GetDirectorySnapshot("smb://server/copies/", true);
+  ASSERT_NE(nullptr, snapshot);
+  EXPECT_EQ(list, snapshot.get());
+  EXPECT_EQ(5, snapshot->Size());
+  EXPECT_GT(cache.GetStats().bytes, bytes);
+
+  bool inCache = false;
+  EXPECT_TRUE(cache.FileExists("smb://server/copies/copy2.mkv", inCache));
+  EXPECT_TRUE(inCache);
+}
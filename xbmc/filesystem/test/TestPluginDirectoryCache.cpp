@@ -0,0 +1,194 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "FileItem.h"
+#include "FileItemList.h"
+#include "filesystem/Directory.h"
+#include "filesystem/File.h"
+#include "filesystem/PluginDirectoryCache.h"
+#include "filesystem/SpecialProtocol.h"
+#include "platform/Filesystem.h"
+#include "utils/Variant.h"
+
+#include <system_error>
+
+#include <gtest/gtest.h>
+
+using namespace XFILE;
+namespace fs = KODI::PLATFORM::FILESYSTEM;
+
+class TestPluginDirectoryCache : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    // keep the listings away from the temp folder shared with other tests
+    m_originalTempPath = CSpecialProtocol::TranslatePath("special://temp/");
+    std::error_code ec;
+    m_tempPath = fs::create_temp_directory(ec);
+    ASSERT_FALSE(ec);
+    CSpecialProtocol::SetTempPath(m_tempPath);
+  }
+
+  void TearDown() override
+  {
+    CSpecialProtocol::SetTempPath(m_originalTempPath);
+    if (!m_tempPath.empty())
+      CDirectory::RemoveRecursive(m_tempPath);
+  }
+
+  static void FillListing(CFileItemList& items, const std::string& ttl)
+  {
+    items.Add(std::make_shared<CFileItem>("plugin://plugin.test.cache/?mode=Play&id=1", false));
+    items.Add(std::make_shared<CFileItem>("plugin://plugin.test.cache/?mode=Play&id=2", false));
+    items.SetProperty(CPluginDirectoryCache::PROPERTY_TTL, ttl);
+  }
+
+  std::string m_originalTempPath;
+  std::string m_tempPath;
+};
+
+TEST(TestPluginDirectoryCache, State)
+{
+  const time_t created = 1000;
+
+  EXPECT_EQ(CPluginDirectoryCache::State::FRESH,
+            CPluginDirectoryCache::GetState(created, created, 60, 60));
+  EXPECT_EQ(CPluginDirectoryCache::State::FRESH,
+            CPluginDirectoryCache::GetState(created, created + 59, 60, 60));
+  EXPECT_EQ(CPluginDirectoryCache::State::STALE,
+            CPluginDirectoryCache::GetState(created, created + 60, 60, 60));
+  EXPECT_EQ(CPluginDirectoryCache::State::STALE,
+            CPluginDirectoryCache::GetState(created, created + 119, 60, 60));
+  EXPECT_EQ(CPluginDirectoryCache::State::MISSING,
+            CPluginDirectoryCache::GetState(created, created + 120, 60, 60));
+
+  // no stale window
+  EXPECT_EQ(CPluginDirectoryCache::State::MISSING,
+            CPluginDirectoryCache::GetState(created, created + 60, 60, 0));
+
+  // not cacheable or clock went backwards
+  EXPECT_EQ(CPluginDirectoryCache::State::MISSING,
+            CPluginDirectoryCache::GetState(created, created, 0, 60));
+  EXPECT_EQ(CPluginDirectoryCache::State::MISSING,
+            CPluginDirectoryCache::GetState(created, created - 1, 60, 60));
+}
+
+TEST_F(TestPluginDirectoryCache, StoreAndInvalidate)
+{
+  const std::string path = "plugin://plugin.test.cache/?mode=List&page=2";
+
+  CFileItemList items;
+  items.Add(std::make_shared<CFileItem>("plugin://plugin.test.cache/?mode=Play&id=1", false));
+  items.Add(std::make_shared<CFileItem>("plugin://plugin.test.cache/?mode=Play&id=2", false));
+
+  // plugins have to opt in
+  EXPECT_FALSE(CPluginDirectoryCache::SetDirectory(path, items));
+
+  items.SetProperty(CPluginDirectoryCache::PROPERTY_TTL, "600");
+  items.SetProperty(CPluginDirectoryCache::PROPERTY_TAG, "tagged");
+  EXPECT_TRUE(CPluginDirectoryCache::SetDirectory(path, items));
+
+  CFileItemList cached;
+  EXPECT_EQ(CPluginDirectoryCache::State::FRESH, CPluginDirectoryCache::GetDirectory(path, cached));
+  EXPECT_EQ(2, cached.Size());
+  EXPECT_EQ(path, cached.GetPath());
+
+  // the query is part of the key
+  CFileItemList other;
+  EXPECT_EQ(CPluginDirectoryCache::State::MISSING,
+            CPluginDirectoryCache::GetDirectory("plugin://plugin.test.cache/?mode=List&page=3",
+                                                other));
+
+  CPluginDirectoryCache::Invalidate("plugin.test.cache", "other");
+  cached.Clear();
+  EXPECT_EQ(CPluginDirectoryCache::State::FRESH, CPluginDirectoryCache::GetDirectory(path, cached));
+
+  CPluginDirectoryCache::Invalidate("plugin.test.cache", "tagged");
+  cached.Clear();
+  EXPECT_EQ(CPluginDirectoryCache::State::MISSING,
+            CPluginDirectoryCache::GetDirectory(path, cached));
+
+  CPluginDirectoryCache::Invalidate("plugin.test.cache");
+}
+
+TEST_F(TestPluginDirectoryCache, VerifyUrl)
+{
+  const std::string path = "plugin://plugin.test.cache/?mode=List&page=2";
+  CFileItemList items;
+  FillListing(items, "600");
+  ASSERT_TRUE(CPluginDirectoryCache::SetDirectory(path, items));
+
+  // a cache file whose header names another url is never served, even if the hash matches
+  CFileItemList listing;
+  ASSERT_TRUE(CDirectory::GetDirectory("special://temp/archive_cache/plugins/plugin.test.cache/",
+                                       listing, ".fi", DIR_FLAG_NO_FILE_DIRS));
+  ASSERT_EQ(1, listing.Size());
+  const std::string otherPath = "plugin://plugin.test.cache/?mode=List&page=3";
+  CFileItemList other;
+  FillListing(other, "600");
+  ASSERT_TRUE(CPluginDirectoryCache::SetDirectory(otherPath, other));
+  CFileItemList otherListing;
+  ASSERT_TRUE(CDirectory::GetDirectory("special://temp/archive_cache/plugins/plugin.test.cache/",
+                                       otherListing, ".fi", DIR_FLAG_NO_FILE_DIRS));
+  ASSERT_EQ(2, otherListing.Size());
+  std::string otherFile;
+  for (const auto& file : otherListing)
+  {
+    if (file->GetPath() != listing[0]->GetPath())
+      otherFile = file->GetPath();
+  }
+  ASSERT_TRUE(CFile::Copy(otherFile, listing[0]->GetPath()));
+
+  CFileItemList cached;
+  EXPECT_EQ(CPluginDirectoryCache::State::MISSING, CPluginDirectoryCache::GetDirectory(path, cached));
+  EXPECT_TRUE(cached.IsEmpty());
+
+  // no temporary files are left behind
+  CFileItemList files;
+  ASSERT_TRUE(CDirectory::GetDirectory("special://temp/archive_cache/plugins/plugin.test.cache/",
+                                       files, "", DIR_FLAG_NO_FILE_DIRS));
+  EXPECT_EQ(2, files.Size());
+}
+
+TEST_F(TestPluginDirectoryCache, CacheKey)
+{
+  const std::string path = "plugin://plugin.test.cache/?mode=List&page=1";
+  const std::string alias = "plugin://plugin.test.cache/?mode=List&page=1&session=abc";
+
+  CFileItemList items;
+  FillListing(items, "600");
+  items.SetProperty(CPluginDirectoryCache::PROPERTY_KEY, "list/page1");
+  items.SetProperty(CPluginDirectoryCache::PROPERTY_TAG, "tagged");
+  ASSERT_TRUE(CPluginDirectoryCache::SetDirectory(path, items));
+
+  // a different url declaring the same key replaces the shared listing
+  CFileItemList newer;
+  FillListing(newer, "600");
+  newer.Add(std::make_shared<CFileItem>("plugin://plugin.test.cache/?mode=Play&id=3", false));
+  newer.SetProperty(CPluginDirectoryCache::PROPERTY_KEY, "list/page1");
+  newer.SetProperty(CPluginDirectoryCache::PROPERTY_TAG, "tagged");
+  ASSERT_TRUE(CPluginDirectoryCache::SetDirectory(alias, newer));
+
+  CFileItemList cached;
+  EXPECT_EQ(CPluginDirectoryCache::State::FRESH, CPluginDirectoryCache::GetDirectory(path, cached));
+  EXPECT_EQ(3, cached.Size());
+  EXPECT_EQ(path, cached.GetPath());
+
+  cached.Clear();
+  EXPECT_EQ(CPluginDirectoryCache::State::FRESH,
+            CPluginDirectoryCache::GetDirectory(alias, cached));
+  EXPECT_EQ(3, cached.Size());
+  EXPECT_EQ(alias, cached.GetPath());
+
+  // dropping the shared listing misses for every url pointing to it
+  CPluginDirectoryCache::Invalidate("plugin.test.cache", "tagged");
+  cached.Clear();
+  EXPECT_EQ(CPluginDirectoryCache::State::MISSING,
+            CPluginDirectoryCache::GetDirectory(alias, cached));
+}
@@ -11,9 +11,11 @@
 #include "FileItem.h"
 #include "FileItemList.h"
 #include "GUIInfoManager.h"
+#include "GUILargeTextureManager.h"
 #include "GUIListItemLayout.h"
 #include "GUIMessage.h"
 #include "ServiceBroker.h"
+#include "guilib/GUIComponent.h"
 #include "guilib/GUIListItem.h"
 #include "guilib/guiinfo/GUIInfoLabels.h"
 #include "guilib/listproviders/IListProvider.h"
@@ -31,6 +33,8 @@
 #include "utils/XBMCTinyXML.h"
 #include "utils/log.h"
 
+#include <algorithm>
+#include <cmath>
 #include <memory>
 
 using namespace KODI;
@@ -39,6 +43,8 @@ using namespace KODI;
 #define HOLD_TIME_END   3000
 #define SCROLLING_GAP   200U
 #define SCROLLING_THRESHOLD 300U
+#define PREFETCH_MIN_SPEED 2.0f // rows per second
+#define PREFETCH_TIME 1.0f      // seconds of scrolling to prefetch for
 
 CGUIBaseContainer::CGUIBaseContainer(int parentID, int controlID, float posX, float posY, float width, float height, ORIENTATION orientation, const CScroller& scroller, int preloadItems)
     : IGUIContainer(parentID, controlID, posX, posY, width, height)
@@ -113,6 +119,9 @@ CGUIBaseContainer::CGUIBaseContainer(const CGUIBaseContainer& other)
 
 CGUIBaseContainer::~CGUIBaseContainer(void)
 {
+  if (CServiceBroker::GetGUI())
+    CServiceBroker::GetGUI()->GetLargeTextureManager().CancelPrefetches(this);
+
   // release the container from items
   for (const auto& item : m_items)
     item->FreeMemory();
@@ -199,6 +208,8 @@ void CGUIBaseContainer::Process(unsigned int currentTime, CDirtyRegionList &dirt
   // to have same behaviour when scrolling down, we need to set page control to offset+1
   UpdatePageControl(offset + (m_scroller.IsScrollingDown() ? 1 : 0));
 
+  PrefetchArtwork(offset - cacheBefore, offset + m_itemsPerPage + cacheAfter, currentTime);
+
   m_lastRenderTime = currentTime;
 
   CGUIControl::Process(currentTime, dirtyregions);
@@ -222,7 +233,7 @@ void CGUIBaseContainer::ProcessItem(float posX,
   {
     if (!item->GetFocusedLayout())
     {
-      item->SetFocusedLayout(std::make_unique<CGUIListItemLayout>(*m_focusedLayout, this));
+      item->SetFocusedLayout(m_layoutPool.Acquire(*m_focusedLayout, this));
     }
     if (item->GetFocusedLayout())
     {
@@ -247,10 +258,7 @@ void CGUIBaseContainer::ProcessItem(float posX,
     if (item->GetFocusedLayout())
       item->GetFocusedLayout()->SetFocusedItem(0);  // focus is not set
     if (!item->GetLayout())
-    {
-      auto layout = std::make_unique<CGUIListItemLayout>(*m_layout, this);
-      item->SetLayout(std::move(layout));
-    }
+      item->SetLayout(m_layoutPool.Acquire(*m_layout, this));
     if (item->GetFocusedLayout() && item->GetFocusedLayout()->IsAnimating(ANIM_TYPE_UNFOCUS))
       item->GetFocusedLayout()->Process(item.get(), m_parentID, currentTime, dirtyregions);
     if (item->GetLayout())
@@ -997,6 +1005,9 @@ void CGUIBaseContainer::AllocResources()
 void CGUIBaseContainer::FreeResources(bool immediately)
 {
   CGUIControl::FreeResources(immediately);
+  m_layoutPool.Clear();
+  CServiceBroker::GetGUI()->GetLargeTextureManager().CancelPrefetches(this);
+  m_prefetchDirection = 0;
   if (m_listProvider)
   {
     if (immediately)
@@ -1014,6 +1025,7 @@ void CGUIBaseContainer::UpdateLayout(bool updateAllItems)
   { // free memory of items
     for (iItems it = m_items.begin(); it != m_items.end(); ++it)
       (*it)->FreeMemory();
+    m_layoutPool.Clear();
   }
   // and recalculate the layout
   CalculateLayout();
@@ -1352,19 +1364,75 @@ void CGUIBaseContainer::SetRenderOffset(const CPoint &offset)
   m_renderOffset = offset;
 }
 
+void CGUIBaseContainer::PrefetchArtwork(int firstRow, int lastRow, unsigned int currentTime)
+{
+  // scroll speed in rows per second, smoothed over a few frames
+  const float value = m_scroller.GetValue();
+  if (currentTime > m_prefetchTime && m_prefetchTime)
+  {
+    const float speed = (value - m_prefetchValue) / m_layout->Size(m_orientation) * 1000.0f /
+                        (currentTime - m_prefetchTime);
+    m_prefetchSpeed = 0.7f * m_prefetchSpeed + 0.3f * speed;
+  }
+  m_prefetchValue = value;
+  m_prefetchTime = currentTime;
+
+  int direction = 0;
+  if (m_prefetchSpeed > PREFETCH_MIN_SPEED)
+    direction = 1;
+  else if (m_prefetchSpeed < -PREFETCH_MIN_SPEED)
+    direction = -1;
+  if (!direction)
+    return; // keep what is queued in case scrolling continues
+
+  if (direction != m_prefetchDirection)
+  { // the rows ahead are behind now
+    CServiceBroker::GetGUI()->GetLargeTextureManager().CancelPrefetches(this);
+    m_prefetchDirection = direction;
+    m_prefetchRow = direction > 0 ? lastRow : firstRow;
+  }
+
+  // prefetch the rows shown within the next moments, below the priority of the rows in view
+  const int rows = std::min(static_cast<int>(std::abs(m_prefetchSpeed) * PREFETCH_TIME) + 1,
+                            2 * m_itemsPerPage);
+  const int endRow = direction > 0 ? lastRow + rows : firstRow - rows;
+  if (direction > 0)
+    m_prefetchRow = std::max(m_prefetchRow, lastRow);
+  else
+    m_prefetchRow = std::min(m_prefetchRow, firstRow);
+
+  while (m_prefetchRow != endRow && (endRow - m_prefetchRow) * direction > 0)
+  {
+    m_prefetchRow += direction;
+    const int start = CorrectOffset(m_prefetchRow, 0);
+    const int count = std::max(CorrectOffset(m_prefetchRow + 1, 0) - start, 1);
+    for (int i = start; i < start + count; ++i)
+    {
+      if (i >= 0 && i < static_cast<int>(m_items.size()))
+        m_layout->Prefetch(m_items[i].get(), this);
+    }
+  }
+}
+
 void CGUIBaseContainer::FreeMemory(int keepStart, int keepEnd)
 {
+  // layouts of items out of view are recycled for the ones scrolling into view, so keep as many
+  // as are in view
+  const int itemCount = static_cast<int>(m_items.size());
+  const int inView =
+      keepStart < keepEnd ? keepEnd - keepStart + 1 : itemCount - keepStart + keepEnd + 1;
+  m_layoutPool.SetCapacity(std::max(inView, 0));
   if (keepStart < keepEnd)
   { // remove before keepStart and after keepEnd
-    for (int i = 0; i < keepStart && i < (int)m_items.size(); ++i)
-      m_items[i]->FreeMemory();
-    for (int i = std::max(keepEnd + 1, 0); i < (int)m_items.size(); ++i)
-      m_items[i]->FreeMemory();
+    for (int i = 0; i < keepStart && i < itemCount; ++i)
+      m_layoutPool.Release(*m_items[i]);
+    for (int i = std::max(keepEnd + 1, 0); i < itemCount; ++i)
+      m_layoutPool.Release(*m_items[i]);
   }
   else
   { // wrapping
-    for (int i = std::max(keepEnd + 1, 0); i < keepStart && i < (int)m_items.size(); ++i)
-      m_items[i]->FreeMemory();
+    for (int i = std::max(keepEnd + 1, 0); i < keepStart && i < itemCount; ++i)
+      m_layoutPool.Release(*m_items[i]);
   }
 }
 
@@ -14,6 +14,7 @@
 */
 
 #include "GUIAction.h"
+#include "GUIListItemLayoutPool.h"
 #include "IGUIContainer.h"
 #include "utils/Stopwatch.h"
 
@@ -135,6 +136,12 @@ protected:
   int ScrollCorrectionRange() const;
   inline float Size() const;
   void FreeMemory(int keepStart, int keepEnd);
+  /*!
+   \brief Load the artwork of the rows about to scroll into view, based on the scroll speed.
+   \param firstRow the first row processed.
+   \param lastRow the last row processed.
+   */
+  void PrefetchArtwork(int firstRow, int lastRow, unsigned int currentTime);
   void GetCurrentLayouts();
   CGUIListItemLayout *GetFocusedLayout() const;
 
@@ -157,6 +164,7 @@ protected:
 
   CGUIListItemLayout* m_layout{nullptr};
   CGUIListItemLayout* m_focusedLayout{nullptr};
+  CGUIListItemLayoutPool m_layoutPool;
   bool m_layoutCondition = false;
   bool m_focusedLayoutCondition = false;
 
@@ -229,6 +237,13 @@ private:
   int m_cursor;
   int m_offset;
   int m_cacheItems;
+
+  // artwork prefetch
+  float m_prefetchValue{0.0f};
+  float m_prefetchSpeed{0.0f}; ///< in rows per second
+  unsigned int m_prefetchTime{0};
+  int m_prefetchDirection{0};
+  int m_prefetchRow{0}; ///< the last row prefetched
   CStopWatch m_scrollTimer;
   CStopWatch m_lastScrollStartTimer;
   CStopWatch m_pageChangeTimer;
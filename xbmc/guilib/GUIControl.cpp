@@ -13,6 +13,7 @@
 #include "GUIControlProfiler.h"
 #include "GUIInfoManager.h"
 #include "GUIMessage.h"
+#include "GUIParallelProcessor.h"
 #include "GUITexture.h"
 #include "GUIWindowManager.h"
 #include "ServiceBroker.h"
@@ -498,7 +499,8 @@ void CGUIControl::MarkDirtyRegion(const unsigned int dirtyState)
   // if the control is culled, bail
   if (dirtyState == DIRTY_STATE_CONTROL && m_isCulled)
     return;
-  if (!m_controlDirtyState && m_parentControl)
+  if (!m_controlDirtyState && m_parentControl &&
+      !CGUIParallelProcessor::DeferMarkDirty(m_parentControl))
     m_parentControl->MarkDirtyRegion(DIRTY_STATE_CHILD);
 
   m_controlDirtyState |= dirtyState;
@@ -20,6 +20,7 @@
 #include "utils/ColorUtils.h"
 #include "windowing/GraphicContext.h" // needed by any rendering operation (all controls)
 
+#include <atomic>
 #include <vector>
 
 class CGUIListItem; // forward
@@ -52,8 +53,9 @@ public:
 
 struct GUICONTROLSTATS
 {
-  unsigned int nCountTotal;
-  unsigned int nCountVisible;
+  // counted by controls which may be processed in parallel
+  std::atomic<unsigned int> nCountTotal{0};
+  std::atomic<unsigned int> nCountVisible{0};
 
   void Reset()
   {
@@ -186,6 +188,9 @@ public:
   virtual float GetHeight() const;
   virtual void AssignDepth();
 
+  static const unsigned int DIRTY_STATE_CONTROL = 1; //This control is dirty
+  static const unsigned int DIRTY_STATE_CHILD = 2; //One / more children are dirty
+
   void MarkDirtyRegion(const unsigned int dirtyState = DIRTY_STATE_CONTROL);
   bool IsControlDirty() const { return m_controlDirtyState != 0; }
 
@@ -233,6 +238,12 @@ public:
   virtual void SetEnabled(bool bEnable);
   virtual void SetInvalid() { m_bInvalidated = true; }
   virtual void SetPulseOnSelect(bool pulse) { m_pulseOnSelect = pulse; }
+  /*! \brief Mark the control as safe to be processed in parallel with its siblings
+   Controls with a camera are always processed on the render thread.
+   \sa CGUIParallelProcessor
+   */
+  void SetParallelProcess(bool parallel) { m_parallelProcess = parallel; }
+  bool IsParallelProcess() const { return m_parallelProcess && !m_hasCamera; }
   virtual std::string GetDescription() const { return ""; }
   virtual std::string GetDescriptionByIndex(int index) const { return ""; }
 
@@ -362,6 +373,7 @@ protected:
   bool m_bInvalidated;
   bool m_bAllocated;
   bool m_pulseOnSelect;
+  bool m_parallelProcess{false};
   GUICONTROLTYPES ControlType;
   GUICONTROLSTATS *m_controlStats;
 
@@ -389,9 +401,6 @@ protected:
   TransformMatrix m_cachedTransform; // Contains the absolute transform the control
   bool m_isCulled{true};
 
-  static const unsigned int DIRTY_STATE_CONTROL = 1; //This control is dirty
-  static const unsigned int DIRTY_STATE_CHILD = 2; //One / more children are dirty
-
   unsigned int  m_controlDirtyState;
   CRect m_renderRegion;         // In screen coordinates
 };
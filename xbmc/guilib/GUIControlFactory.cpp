@@ -869,6 +869,7 @@ CGUIControl* CGUIControlFactory::Create(int parentID,
 
   CGUIControl::GUISCROLLVALUE scrollValue = CGUIControl::FOCUS;
   bool bPulse = true;
+  bool parallelProcess = false;
   unsigned int timePerImage = 0;
   unsigned int fadeTime = 0;
   unsigned int timeToPauseAtEnd = 0;
@@ -1134,6 +1135,7 @@ CGUIControl* CGUIControlFactory::Create(int parentID,
     scrollValue = alwaysScroll ? CGUIControl::ALWAYS : CGUIControl::NEVER;
 
   XMLUtils::GetBoolean(pControlNode, "pulseonselect", bPulse);
+  XMLUtils::GetBoolean(pControlNode, "parallelprocess", parallelProcess);
   XMLUtils::GetInt(pControlNode, "timeblocks", timeBlocks);
   XMLUtils::GetUInt(pControlNode, "minspertimeblock", minutesPerTimeBlock);
   XMLUtils::GetInt(pControlNode, "rulerunit", rulerUnit);
@@ -1762,6 +1764,7 @@ CGUIControl* CGUIControlFactory::Create(int parentID,
     control->SetColorDiffuse(colorDiffuse);
     control->SetActions(actions);
     control->SetPulseOnSelect(bPulse);
+    control->SetParallelProcess(parallelProcess);
     if (hasCamera)
       control->SetCamera(camera);
     control->SetStereoFactor(stereo);
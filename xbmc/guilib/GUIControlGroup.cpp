@@ -9,8 +9,10 @@
 #include "GUIControlGroup.h"
 
 #include "GUIMessage.h"
+#include "GUIParallelProcessor.h"
 #include "input/mouse/MouseEvent.h"
 
+#include <algorithm>
 #include <cassert>
 #include <utility>
 
@@ -89,13 +91,21 @@ void CGUIControlGroup::Process(unsigned int currentTime, CDirtyRegionList &dirty
   CServiceBroker::GetWinSystem()->GetGfxContext().SetOrigin(pos.x, pos.y);
 
   CRect rect;
-  for (auto *control : m_children)
+  if (CGUIParallelProcessor::IsEnabled() &&
+      std::ranges::count_if(m_children, &CGUIControl::IsParallelProcess) > 1)
   {
-    control->UpdateVisibility(nullptr);
-    unsigned int oldDirty = dirtyregions.size();
-    control->DoProcess(currentTime, dirtyregions);
-    if (control->IsVisible() || (oldDirty != dirtyregions.size())) // visible or dirty (was visible?)
-      rect.Union(control->GetRenderRegion());
+    ProcessParallel(currentTime, dirtyregions, rect);
+  }
+  else
+  {
+    for (auto* control : m_children)
+    {
+      control->UpdateVisibility(nullptr);
+      unsigned int oldDirty = dirtyregions.size();
+      control->DoProcess(currentTime, dirtyregions);
+      if (control->IsVisible() || (oldDirty != dirtyregions.size())) // visible or dirty (was visible?)
+        rect.Union(control->GetRenderRegion());
+    }
   }
 
   CServiceBroker::GetWinSystem()->GetGfxContext().RestoreOrigin();
@@ -103,6 +113,41 @@ void CGUIControlGroup::Process(unsigned int currentTime, CDirtyRegionList &dirty
   m_renderRegion = rect;
 }
 
+void CGUIControlGroup::ProcessParallel(unsigned int currentTime,
+                                       CDirtyRegionList& dirtyregions,
+                                       CRect& renderRegion)
+{
+  std::vector<CGUIControl*> parallel;
+  std::vector<CGUIControl*> serial;
+  for (auto* control : m_children)
+    (control->IsParallelProcess() ? parallel : serial).push_back(control);
+
+  std::vector<CDirtyRegionList> parallelRegions;
+  CGUIParallelProcessor::Process(CServiceBroker::GetWinSystem()->GetGfxContext(), *this, parallel,
+                                 currentTime, parallelRegions);
+
+  // the others may change the camera of the render system, so they are processed afterwards
+  std::vector<CDirtyRegionList> serialRegions(serial.size());
+  for (size_t i = 0; i < serial.size(); ++i)
+  {
+    serial[i]->UpdateVisibility(nullptr);
+    serial[i]->DoProcess(currentTime, serialRegions[i]);
+  }
+
+  // merge in the order of the children
+  std::vector<CDirtyRegionList> regions;
+  regions.reserve(m_children.size());
+  auto parallelRegion = parallelRegions.begin();
+  auto serialRegion = serialRegions.begin();
+  for (auto* control : m_children)
+  {
+    CDirtyRegionList& controlRegions =
+        control->IsParallelProcess() ? *parallelRegion++ : *serialRegion++;
+    regions.emplace_back(std::move(controlRegions));
+  }
+  CGUIParallelProcessor::MergeDirtyRegions(m_children, regions, dirtyregions, renderRegion);
+}
+
 void CGUIControlGroup::Render()
 {
   CPoint pos(GetPosition());
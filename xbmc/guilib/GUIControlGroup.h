@@ -77,6 +77,12 @@ public:
   void DumpTextureUse() override;
 #endif
 protected:
+  /*!
+   \brief Process the children marked with <parallelprocess> in parallel, the others afterwards.
+   \param renderRegion receives the union of the render regions of the visible or dirty children.
+   */
+  void ProcessParallel(unsigned int currentTime, CDirtyRegionList& dirtyregions, CRect& renderRegion);
+
   // sub controls
   std::vector<CGUIControl *> m_children;
 
@@ -0,0 +1,143 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "GUIFontAtlas.h"
+
+#include <algorithm>
+
+CGUIFontAtlas::CGUIFontAtlas(unsigned int width, unsigned int pageHeight, unsigned int maxPages)
+  : m_width(width),
+    m_pageHeight(pageHeight),
+    m_maxPages(std::max(maxPages, 1u))
+{
+}
+
+void CGUIFontAtlas::Reset()
+{
+  m_pages.clear();
+}
+
+std::optional<CGUIFontAtlas::Allocation> CGUIFontAtlas::Allocate(unsigned int width,
+                                                                 unsigned int height)
+{
+  if (!Fits(width, height))
+    return {};
+
+  Allocation result;
+  for (Page& page : m_pages)
+  {
+    if (AllocateInPage(page, width, height, result))
+      return result;
+  }
+
+  if (m_pages.size() < m_maxPages)
+  {
+    Page& page = m_pages.emplace_back();
+    ResetPage(page);
+    AllocateInPage(page, width, height, result);
+    return result;
+  }
+
+  return {};
+}
+
+unsigned int CGUIFontAtlas::Evict()
+{
+  if (m_pages.empty())
+    return NO_PAGE;
+
+  const auto lru = std::ranges::min_element(m_pages, {}, &Page::m_lastUse);
+  ResetPage(*lru);
+  ++m_evictions;
+  return static_cast<unsigned int>(lru - m_pages.begin());
+}
+
+CGUIFontAtlas::Stats CGUIFontAtlas::GetStats() const
+{
+  Stats stats;
+  stats.m_pages = GetPageCount();
+  stats.m_maxPages = m_maxPages;
+  for (const Page& page : m_pages)
+    stats.m_usedPixels += page.m_usedPixels;
+  stats.m_totalPixels = static_cast<uint64_t>(m_width) * m_pageHeight * m_pages.size();
+  stats.m_evictions = m_evictions;
+  return stats;
+}
+
+void CGUIFontAtlas::ResetPage(Page& page) const
+{
+  page.m_skyline.assign(1, {0, 0, m_width});
+  page.m_usedPixels = 0;
+}
+
+bool CGUIFontAtlas::AllocateInPage(Page& page,
+                                   unsigned int width,
+                                   unsigned int height,
+                                   Allocation& result)
+{
+  // bottom left rule: the lowest position, the leftmost one of those
+  std::vector<Segment>& skyline = page.m_skyline;
+  size_t best = skyline.size();
+  unsigned int bestY = m_pageHeight;
+  for (size_t i = 0; i < skyline.size(); ++i)
+  {
+    const unsigned int x = skyline[i].m_x;
+    if (x + width > m_width)
+      break;
+
+    // the rectangle rests on the highest segment below it
+    unsigned int y = 0;
+    unsigned int covered = 0;
+    for (size_t j = i; covered < width; ++j)
+    {
+      y = std::max(y, skyline[j].m_y);
+      covered = skyline[j].m_x + skyline[j].m_width - x;
+    }
+
+    if (y + height <= m_pageHeight && y < bestY)
+    {
+      best = i;
+      bestY = y;
+    }
+  }
+
+  if (best == skyline.size())
+    return false;
+
+  const unsigned int x = skyline[best].m_x;
+  const unsigned int right = x + width;
+
+  // replace the segments below the rectangle by its top edge
+  size_t end = best;
+  while (end < skyline.size() && skyline[end].m_x + skyline[end].m_width <= right)
+    ++end;
+  if (end < skyline.size() && skyline[end].m_x < right)
+  {
+    skyline[end].m_width -= right - skyline[end].m_x;
+    skyline[end].m_x = right;
+  }
+  skyline.erase(skyline.begin() + best, skyline.begin() + end);
+  skyline.insert(skyline.begin() + best, {x, bestY + height, width});
+
+  // merge with neighbours of the same height
+  if (best + 1 < skyline.size() && skyline[best + 1].m_y == skyline[best].m_y)
+  {
+    skyline[best].m_width += skyline[best + 1].m_width;
+    skyline.erase(skyline.begin() + best + 1);
+  }
+  if (best > 0 && skyline[best - 1].m_y == skyline[best].m_y)
+  {
+    skyline[best - 1].m_width += skyline[best].m_width;
+    skyline.erase(skyline.begin() + best);
+  }
+
+  page.m_usedPixels += static_cast<uint64_t>(width) * height;
+  page.m_lastUse = ++m_useCounter;
+  result = {static_cast<unsigned int>(&page - m_pages.data()), x, bestY};
+  return true;
+}
@@ -0,0 +1,114 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <vector>
+
+/*!
+ \brief Packs the glyphs of a font into fixed size pages of its glyph texture.
+
+ Every page is packed with a skyline, so glyphs of different heights (CJK, emoji) don't waste the
+ rest of a text line like a fixed line height does. New pages are added until the maximum number of
+ pages is reached, after that the owner has to empty the least recently used page with Evict() at a
+ point where none of its glyphs are being drawn. The atlas only does the bookkeeping, the owner keeps
+ the pixels and has to drop the glyphs of an evicted page.
+ */
+class CGUIFontAtlas
+{
+public:
+  static constexpr unsigned int NO_PAGE = std::numeric_limits<unsigned int>::max();
+
+  struct Allocation
+  {
+    unsigned int m_page;
+    unsigned int m_x;
+    unsigned int m_y; ///< relative to the top of the page
+  };
+
+  struct Stats
+  {
+    unsigned int m_pages{0};
+    unsigned int m_maxPages{0};
+    uint64_t m_usedPixels{0};
+    uint64_t m_totalPixels{0}; ///< of the pages in use
+    uint64_t m_evictions{0};
+  };
+
+  CGUIFontAtlas() = default;
+  CGUIFontAtlas(unsigned int width, unsigned int pageHeight, unsigned int maxPages);
+
+  /*!
+   \brief Drop all pages and glyphs, the statistics are kept.
+   */
+  void Reset();
+
+  /*!
+   \brief Reserve a width x height rectangle.
+   \return the position of the rectangle, nothing if it is larger than a page or all pages are full.
+   */
+  std::optional<Allocation> Allocate(unsigned int width, unsigned int height);
+
+  /*!
+   \brief Check whether a width x height rectangle fits on an empty page.
+   */
+  bool Fits(unsigned int width, unsigned int height) const
+  {
+    return width <= m_width && height <= m_pageHeight;
+  }
+
+  /*!
+   \brief Empty the page that hasn't been used for the longest time, so that it can be reused.
+   \return the emptied page, NO_PAGE if there are no pages.
+   */
+  unsigned int Evict();
+
+  /*!
+   \brief Mark a page as used, so that it is evicted after the pages that weren't used since.
+   */
+  void Touch(unsigned int page)
+  {
+    if (page < m_pages.size())
+      m_pages[page].m_lastUse = ++m_useCounter;
+  }
+
+  unsigned int GetWidth() const { return m_width; }
+  unsigned int GetPageHeight() const { return m_pageHeight; }
+  unsigned int GetPageCount() const { return static_cast<unsigned int>(m_pages.size()); }
+  unsigned int GetMaxPages() const { return m_maxPages; }
+
+  Stats GetStats() const;
+
+private:
+  struct Segment
+  {
+    unsigned int m_x;
+    unsigned int m_y;
+    unsigned int m_width;
+  };
+
+  struct Page
+  {
+    std::vector<Segment> m_skyline;
+    uint64_t m_usedPixels{0};
+    uint64_t m_lastUse{0};
+  };
+
+  void ResetPage(Page& page) const;
+  bool AllocateInPage(Page& page, unsigned int width, unsigned int height, Allocation& result);
+
+  unsigned int m_width{0};
+  unsigned int m_pageHeight{0};
+  unsigned int m_maxPages{0};
+  std::vector<Page> m_pages;
+  uint64_t m_useCounter{0};
+  uint64_t m_evictions{0};
+};
@@ -79,6 +79,8 @@ class CGUIFontCacheImpl
 
   EntryList m_list;
   CGUIFontCache<Position, Value>* m_parent;
+  uint64_t m_hits{0};
+  uint64_t m_misses{0};
 
 public:
   explicit CGUIFontCacheImpl(CGUIFontCache<Position, Value>* parent) : m_parent(parent) {}
@@ -92,6 +94,7 @@ public:
                 std::chrono::steady_clock::time_point now,
                 bool& dirtyCache);
   void Flush();
+  CGUIFontCacheStats GetStats() const { return {m_hits, m_misses, m_list.hashMap.size()}; }
 };
 
 template<class Position, class Value>
@@ -167,6 +170,7 @@ Value& CGUIFontCacheImpl<Position, Value>::Lookup(
   if (i == m_list.hashMap.end())
   {
     // Cache miss
+    ++m_misses;
     dirtyCache = true;
     std::unique_ptr<CGUIFontCacheEntry<Position, Value>> entry;
 
@@ -193,6 +197,7 @@ Value& CGUIFontCacheImpl<Position, Value>::Lookup(
   else
   {
     // Cache hit
+    ++m_hits;
     // Update the translation arguments so that they hold the offset to apply
     // to the cached values (but only in the dynamic case)
     pos.UpdateWithOffsets(i->second->m_key.m_pos, scrolling);
@@ -212,6 +217,12 @@ void CGUIFontCache<Position, Value>::Flush()
   m_impl->Flush();
 }
 
+template<class Position, class Value>
+CGUIFontCacheStats CGUIFontCache<Position, Value>::GetStats() const
+{
+  return m_impl ? m_impl->GetStats() : CGUIFontCacheStats{};
+}
+
 template<class Position, class Value>
 void CGUIFontCacheImpl<Position, Value>::Flush()
 {
@@ -235,6 +246,8 @@ template CGUIFontCacheStaticValue& CGUIFontCache<
                                       std::chrono::steady_clock::time_point,
                                       bool&);
 template void CGUIFontCache<CGUIFontCacheStaticPosition, CGUIFontCacheStaticValue>::Flush();
+template CGUIFontCacheStats
+CGUIFontCache<CGUIFontCacheStaticPosition, CGUIFontCacheStaticValue>::GetStats() const;
 
 template CGUIFontCache<CGUIFontCacheDynamicPosition, CGUIFontCacheDynamicValue>::CGUIFontCache(
     CGUIFontTTF& font);
@@ -253,6 +266,8 @@ template CGUIFontCacheDynamicValue& CGUIFontCache<
                                        std::chrono::steady_clock::time_point,
                                        bool&);
 template void CGUIFontCache<CGUIFontCacheDynamicPosition, CGUIFontCacheDynamicValue>::Flush();
+template CGUIFontCacheStats
+CGUIFontCache<CGUIFontCacheDynamicPosition, CGUIFontCacheDynamicValue>::GetStats() const;
 
 void CVertexBuffer::clear()
 {
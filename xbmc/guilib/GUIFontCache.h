@@ -13,6 +13,7 @@
 \brief
 */
 
+#include "GUIFontShapeCache.h"
 #include "utils/ColorUtils.h"
 #include "utils/TransformMatrix.h"
 
@@ -21,6 +22,7 @@
 #include <chrono>
 #include <cstddef>
 #include <cstring>
+#include <functional>
 #include <memory>
 #include <stdint.h>
 #include <vector>
@@ -110,13 +112,16 @@ struct CGUIFontCacheHash
 {
   size_t operator()(const CGUIFontCacheKey<Position>& key) const
   {
-    /* Not much effort has gone into choosing this hash function */
-    size_t hash = 0, i;
-    for (i = 0; i < 3 && i < key.m_text.size(); ++i)
-      hash += key.m_text[i];
-    if (key.m_colors.size())
-      hash += key.m_colors[0];
-    hash += static_cast<size_t>(MatrixHashContribution(key)); // horrible
+    // everything compared exactly by CGUIFontCacheKeysMatch, labels in lists often share prefixes
+    size_t hash = HashFontText(key.m_text.data(), key.m_text.size());
+    for (const KODI::UTILS::COLOR::Color color : key.m_colors)
+      CombineFontHash(hash, color);
+    CombineFontHash(hash, key.m_alignment);
+    CombineFontHash(hash, std::hash<float>{}(key.m_maxPixelWidth));
+    CombineFontHash(hash, key.m_scrolling);
+    CombineFontHash(hash, std::hash<float>{}(key.m_scaleX));
+    CombineFontHash(hash, std::hash<float>{}(key.m_scaleY));
+    CombineFontHash(hash, std::hash<float>{}(MatrixHashContribution(key)));
     return hash;
   }
 };
@@ -165,6 +170,8 @@ public:
                 std::chrono::steady_clock::time_point now,
                 bool& dirtyCache);
   void Flush();
+
+  CGUIFontCacheStats GetStats() const;
 };
 
 struct CGUIFontCacheStaticPosition
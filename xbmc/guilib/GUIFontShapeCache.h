@@ -0,0 +1,146 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/*!
+ \brief Hash over all characters of a text, only the bits of every character in mask are used.
+ */
+inline size_t HashFontText(const uint32_t* text, size_t size, uint32_t mask = 0xffffffff)
+{
+  // FNV-1a over the characters
+  uint64_t hash = 14695981039346656037ULL;
+  for (size_t i = 0; i < size; ++i)
+  {
+    hash ^= text[i] & mask;
+    hash *= 1099511628211ULL;
+  }
+  return static_cast<size_t>(hash ^ (hash >> 32));
+}
+
+inline void CombineFontHash(size_t& hash, size_t value)
+{
+  hash ^= value + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+}
+
+struct CGUIFontCacheStats
+{
+  uint64_t m_hits{0};
+  uint64_t m_misses{0};
+  size_t m_entries{0};
+};
+
+/*!
+ \brief Least recently used cache of the shaped glyphs of texts.
+
+ Shaping only depends on the characters and styles of a text, so in contrast to the vertex caches
+ the entries are independent of colours, position and transformation and can be shared by all
+ labels showing the same text in a font.
+ */
+template<class Value>
+class CGUIFontShapeCache
+{
+public:
+  static constexpr size_t DEFAULT_CAPACITY = 1024;
+  // the colour bits of the characters don't change the shaping
+  static constexpr uint32_t KEY_MASK = 0xff00ffff;
+
+  explicit CGUIFontShapeCache(size_t capacity = DEFAULT_CAPACITY) : m_capacity(capacity) {}
+
+  CGUIFontShapeCache(const CGUIFontShapeCache&) = delete;
+  CGUIFontShapeCache& operator=(const CGUIFontShapeCache&) = delete;
+
+  /*!
+   \brief Get the shaped glyphs of the text, shape(text) is called to create them on a miss.
+   \return the glyphs, which stay valid until the next call.
+   */
+  template<class Shaper>
+  const Value& Get(const std::vector<uint32_t>& text, Shaper&& shape)
+  {
+    const auto it = m_index.find(TextView{text.data(), text.size()});
+    if (it != m_index.end())
+    {
+      ++m_hits;
+      m_entries.splice(m_entries.begin(), m_entries, it->second);
+      return it->second->m_value;
+    }
+
+    ++m_misses;
+    if (m_entries.size() >= m_capacity && !m_entries.empty())
+    {
+      const Entry& oldest = m_entries.back();
+      m_index.erase(TextView{oldest.m_text.data(), oldest.m_text.size()});
+      m_entries.pop_back();
+    }
+
+    Entry& entry = m_entries.emplace_front();
+    entry.m_text.reserve(text.size());
+    for (const uint32_t ch : text)
+      entry.m_text.push_back(ch & KEY_MASK);
+    entry.m_value = shape(text);
+    m_index.emplace(TextView{entry.m_text.data(), entry.m_text.size()}, m_entries.begin());
+    return entry.m_value;
+  }
+
+  void Flush()
+  {
+    m_index.clear();
+    m_entries.clear();
+  }
+
+  CGUIFontCacheStats GetStats() const { return {m_hits, m_misses, m_entries.size()}; }
+
+private:
+  struct Entry
+  {
+    std::vector<uint32_t> m_text; ///< characters masked with KEY_MASK
+    Value m_value;
+  };
+
+  struct TextView
+  {
+    const uint32_t* m_data;
+    size_t m_size;
+  };
+
+  struct TextHash
+  {
+    size_t operator()(const TextView& text) const
+    {
+      return HashFontText(text.m_data, text.m_size, KEY_MASK);
+    }
+  };
+
+  struct TextEqual
+  {
+    bool operator()(const TextView& a, const TextView& b) const
+    {
+      if (a.m_size != b.m_size)
+        return false;
+      for (size_t i = 0; i < a.m_size; ++i)
+      {
+        if ((a.m_data[i] & KEY_MASK) != (b.m_data[i] & KEY_MASK))
+          return false;
+      }
+      return true;
+    }
+  };
+
+  size_t m_capacity;
+  std::list<Entry> m_entries; ///< most recently used first
+  std::unordered_map<TextView, typename std::list<Entry>::iterator, TextHash, TextEqual> m_index;
+  uint64_t m_hits{0};
+  uint64_t m_misses{0};
+};
@@ -8,7 +8,9 @@
 
 #include "GUIFontTTF.h"
 
+#include "GUIComponent.h"
 #include "GUIFontManager.h"
+#include "GUIWindowManager.h"
 #include "ServiceBroker.h"
 #include "Texture.h"
 #include "URL.h"
@@ -21,8 +23,10 @@
 #include "windowing/GraphicContext.h"
 #include "windowing/WinSystem.h"
 
+#include <algorithm>
 #include <math.h>
 #include <memory>
+#include <optional>
 #include <queue>
 #include <utility>
 
@@ -52,6 +56,7 @@ namespace
 {
 constexpr int VERTEX_PER_GLYPH = 4; // number of vertex for each glyph
 constexpr int CHARS_PER_TEXTURE_LINE = 20; // number characters to cache per texture line
+constexpr unsigned int TEXTURE_LINES_PER_PAGE = 4; // text lines per page of the glyph texture
 constexpr int MAX_TRANSLATED_VERTEX = 32; // max number of structs CTranslatedVertices expect to use
 constexpr int MAX_GLYPHS_PER_TEXT_LINE = 1024; // max number of glyphs per text line expect to use
 constexpr unsigned int SPACING_BETWEEN_CHARACTERS_IN_TEXTURE = 1;
@@ -201,6 +206,19 @@ CGUIFontTTF::CGUIFontTTF(const std::string& fontIdent)
 
 CGUIFontTTF::~CGUIFontTTF(void)
 {
+  const CGUIFontCacheStats shapes = m_shapeCache.GetStats();
+  const CGUIFontCacheStats staticVertices = m_staticCache.GetStats();
+  const CGUIFontCacheStats dynamicVertices = m_dynamicCache.GetStats();
+  CLog::Log(LOGDEBUG,
+            "{}: shaping cache {} hits / {} misses, vertex caches {} hits / {} misses (static), "
+            "{} hits / {} misses (dynamic)",
+            m_fontIdent, shapes.m_hits, shapes.m_misses, staticVertices.m_hits,
+            staticVertices.m_misses, dynamicVertices.m_hits, dynamicVertices.m_misses);
+  const CGUIFontAtlas::Stats atlas = m_atlas.GetStats();
+  CLog::Log(LOGDEBUG, "{}: glyph texture {}/{} pages, {}/{} pixels used, {} pages evicted",
+            m_fontIdent, atlas.m_pages, atlas.m_maxPages, atlas.m_usedPixels, atlas.m_totalPixels,
+            atlas.m_evictions);
+
   Clear();
 }
 
@@ -228,9 +246,9 @@ void CGUIFontTTF::ClearCharacterCache()
   m_char.clear();
   m_char.reserve(CHAR_CHUNK);
   memset(m_charquick, 0, sizeof(m_charquick));
-  // set the posX and posY so that our texture will be created on first character write.
-  m_posX = m_textureWidth;
-  m_posY = -static_cast<int>(GetTextureLineHeight());
+  // the texture will be created on first character write.
+  m_atlas.Reset();
+  m_pageEvictionPending = false;
   m_textureHeight = 0;
 }
 
@@ -239,10 +257,11 @@ void CGUIFontTTF::Clear()
   m_texture.reset();
   m_texture = nullptr;
   memset(m_charquick, 0, sizeof(m_charquick));
-  m_posX = 0;
-  m_posY = 0;
+  m_atlas.Reset();
+  m_pageEvictionPending = false;
   m_nestedBeginCount = 0;
 
+  m_shapeCache.Flush();
   if (m_hbFont)
     hb_font_destroy(m_hbFont);
   m_hbFont = nullptr;
@@ -333,14 +352,27 @@ bool CGUIFontTTF::Load(
     m_textureWidth = m_renderSystem->GetMaxTextureSize();
   m_textureScaleX = 1.0f / m_textureWidth;
 
-  // set the posX and posY so that our texture will be created on first character write.
-  m_posX = m_textureWidth;
-  m_posY = -static_cast<int>(GetTextureLineHeight());
+  // the texture grows by whole pages, once it has the maximum size the least recently used page
+  // is reused. The texture will be created on first character write.
+  const unsigned int maxTextureSize = m_renderSystem->GetMaxTextureSize();
+  const unsigned int pageHeight =
+      std::min(CTexture::PadPow2(GetTextureLineHeight() * TEXTURE_LINES_PER_PAGE), maxTextureSize);
+  m_atlas = CGUIFontAtlas(m_textureWidth, pageHeight, maxTextureSize / pageHeight);
 
   return true;
 }
 
 void CGUIFontTTF::Begin()
+{
+  // no characters are referenced by queued or half built vertices outside of a Begin(), End()
+  // block, so this is the place to reuse a page the last block couldn't get
+  if (m_nestedBeginCount == 0 && m_pageEvictionPending)
+    EvictPage();
+
+  BeginBatch();
+}
+
+void CGUIFontTTF::BeginBatch()
 {
   if (m_nestedBeginCount == 0 && m_texture && FirstBegin())
   {
@@ -450,7 +482,7 @@ void CGUIFontTTF::DrawTextInternal(CGraphicContext& context,
     //! by add validating alignments from each parent caller component
     ValidateAlignments(alignment);
 
-    const std::vector<Glyph> glyphs = GetHarfBuzzShapedGlyphs(text);
+    const std::vector<Glyph>& glyphs = GetHarfBuzzShapedGlyphs(text);
     // save the origin, which is scaled separately
 #if not defined(HAS_DX)
     // the origin is now at [0,0], and not at "random" locations anymore. positioning is done in the vertex shader.
@@ -745,8 +777,7 @@ void CGUIFontTTF::DrawTextInternal(CGraphicContext& context,
 
 float CGUIFontTTF::GetTextWidthInternal(const vecText& text)
 {
-  const std::vector<Glyph> glyphs = GetHarfBuzzShapedGlyphs(text);
-  return GetTextWidthInternal(text, glyphs);
+  return GetTextWidthInternal(text, GetHarfBuzzShapedGlyphs(text));
 }
 
 // this routine assumes a single line (i.e. it was called from GUITextLayout)
@@ -806,12 +837,12 @@ unsigned int CGUIFontTTF::GetTextureLineHeight() const
   return m_cellHeight + SPACING_BETWEEN_CHARACTERS_IN_TEXTURE;
 }
 
-unsigned int CGUIFontTTF::GetMaxFontHeight() const
+const std::vector<CGUIFontTTF::Glyph>& CGUIFontTTF::GetHarfBuzzShapedGlyphs(const vecText& text)
 {
-  return m_maxFontHeight + SPACING_BETWEEN_CHARACTERS_IN_TEXTURE;
+  return m_shapeCache.Get(text, [this](const vecText& shapeText) { return ShapeText(shapeText); });
 }
 
-std::vector<CGUIFontTTF::Glyph> CGUIFontTTF::GetHarfBuzzShapedGlyphs(const vecText& text)
+std::vector<CGUIFontTTF::Glyph> CGUIFontTTF::ShapeText(const vecText& text) const
 {
   std::vector<Glyph> glyphs;
   if (text.empty())
@@ -925,14 +956,16 @@ CGUIFontTTF::Character* CGUIFontTTF::GetCharacter(character_t chr, FT_UInt glyph
     character_t ch = (style << 12) | glyphIndex; // 2^12 = 4096
 
     if (ch < LOOKUPTABLE_SIZE && m_charquick[ch])
+    {
+      m_atlas.Touch(m_charquick[ch]->m_page);
       return m_charquick[ch];
+    }
   }
 
   // letters are stored based on style and glyph
   character_t ch = (style << 16) | glyphIndex;
 
-  // perform binary search on sorted array by m_glyphAndStyle and
-  // if not found obtains position to insert the new m_char to keep sorted
+  // perform binary search on sorted array by m_glyphAndStyle
   int low = 0;
   int high = m_char.size() - 1;
   while (low <= high)
@@ -943,17 +976,10 @@ CGUIFontTTF::Character* CGUIFontTTF::GetCharacter(character_t chr, FT_UInt glyph
     else if (ch < m_char[mid].m_glyphAndStyle)
       high = mid - 1;
     else
+    {
+      m_atlas.Touch(m_char[mid].m_page);
       return &m_char[mid];
-  }
-  // if we get to here, then low is where we should insert the new character
-
-  int startIndex = low;
-
-  // increase the size of the buffer if we need it
-  if (m_char.size() == m_char.capacity())
-  {
-    m_char.reserve(m_char.capacity() + CHAR_CHUNK);
-    startIndex = 0;
+    }
   }
 
   // render the character to our texture
@@ -963,30 +989,59 @@ CGUIFontTTF::Character* CGUIFontTTF::GetCharacter(character_t chr, FT_UInt glyph
   if (nestedBeginCount)
     End();
 
-  m_char.emplace(m_char.begin() + low);
-  if (!CacheCharacter(glyphIndex, style, m_char.data() + low))
+  Character character;
+  bool cached = CacheCharacter(glyphIndex, style, &character);
+  if (!cached && m_pageEvictionPending && !nestedBeginCount)
+  {
+    // no text is being drawn, so a page can be reused right away
+    EvictPage();
+    cached = CacheCharacter(glyphIndex, style, &character);
+  }
+  if (!cached && m_pageEvictionPending)
+  {
+    // the characters of the text being drawn refer to the pages, the character is left out until
+    // a page is reused at the next Begin() and the GUI is redrawn
+    if (CServiceBroker::GetGUI())
+      CServiceBroker::GetGUI()->GetWindowManager().MarkDirty();
+  }
+  else if (!cached)
   { // unable to cache character - try clearing them all out and starting over
     CLog::LogF(LOGDEBUG, "Unable to cache character. Clearing character cache of {} characters",
                m_char.size());
     ClearCharacterCache();
-    low = 0;
-    startIndex = 0;
-    m_char.emplace(m_char.begin());
-    if (!CacheCharacter(glyphIndex, style, m_char.data()))
-    {
+    cached = CacheCharacter(glyphIndex, style, &character);
+    if (!cached)
       CLog::LogF(LOGERROR, "Unable to cache character (out of memory?)");
-      if (nestedBeginCount)
-        Begin();
-      m_nestedBeginCount = nestedBeginCount;
-      return nullptr;
-    }
   }
 
   if (nestedBeginCount)
-    Begin();
+    BeginBatch();
   m_nestedBeginCount = nestedBeginCount;
 
+  if (!cached)
+    return nullptr;
+
+  // caching may have evicted characters, so look for the position to insert at again
+  const size_t index =
+      std::ranges::lower_bound(m_char, ch, {}, &Character::m_glyphAndStyle) - m_char.begin();
+  size_t startIndex = index;
+
+  // increase the size of the buffer if we need it
+  if (m_char.size() == m_char.capacity())
+  {
+    m_char.reserve(m_char.capacity() + CHAR_CHUNK);
+    startIndex = 0;
+  }
+  m_char.insert(m_char.begin() + index, character);
+
   // update the lookup table with only the m_char addresses that have changed
+  UpdateCharacterLookup(startIndex);
+
+  return m_char.data() + index;
+}
+
+void CGUIFontTTF::UpdateCharacterLookup(size_t startIndex)
+{
   for (size_t i = startIndex; i < m_char.size(); ++i)
   {
     if (m_char[i].m_glyphIndex < MAX_GLYPH_IDX)
@@ -998,8 +1053,38 @@ CGUIFontTTF::Character* CGUIFontTTF::GetCharacter(character_t chr, FT_UInt glyph
         m_charquick[ch] = m_char.data() + i;
     }
   }
+}
 
-  return m_char.data() + low;
+void CGUIFontTTF::EvictPage()
+{
+  m_pageEvictionPending = false;
+  const unsigned int page = m_atlas.Evict();
+  if (page == CGUIFontAtlas::NO_PAGE)
+    return;
+
+  CLog::LogF(LOGDEBUG, "{}: glyph texture is full, reusing page {}", m_fontIdent, page);
+
+  std::erase_if(m_char, [page](const Character& ch) { return ch.m_page == page; });
+  memset(m_charquick, 0, sizeof(m_charquick));
+  UpdateCharacterLookup(0);
+
+  // the cached vertices may refer to the characters of the page
+  m_staticCache.Flush();
+  m_dynamicCache.Flush();
+
+  // the spacing between the new characters has to be empty, so clear the whole page
+  const unsigned int y1 = page * m_atlas.GetPageHeight();
+  const unsigned int y2 = std::min(y1 + m_atlas.GetPageHeight(), m_textureHeight);
+  if (!m_texture || y1 >= y2)
+    return;
+
+  std::vector<unsigned char> pixels(static_cast<size_t>(m_textureWidth) * (y2 - y1));
+  FT_BitmapGlyphRec empty{};
+  empty.bitmap.width = m_textureWidth;
+  empty.bitmap.rows = y2 - y1;
+  empty.bitmap.pitch = static_cast<int>(m_textureWidth);
+  empty.bitmap.buffer = pixels.data();
+  CopyCharToTexture(&empty, 0, y1, m_textureWidth, y2);
 }
 
 bool CGUIFontTTF::CacheCharacter(FT_UInt glyphIndex, uint32_t style, Character* ch)
@@ -1039,44 +1124,43 @@ bool CGUIFontTTF::CacheCharacter(FT_UInt glyphIndex, uint32_t style, Character*
   FT_Bitmap bitmap = bitGlyph->bitmap;
   bool isEmptyGlyph = (bitmap.width == 0 || bitmap.rows == 0);
 
+  unsigned int page = CGUIFontAtlas::NO_PAGE;
+  unsigned int x1 = 0;
+  unsigned int y1 = 0;
   if (!isEmptyGlyph)
   {
-    if (bitGlyph->left < 0)
-      m_posX += -bitGlyph->left;
-
-    // check we have enough room for the character.
-    // cast-fest is here to avoid warnings due to freeetype version differences (signedness of width).
-    if (static_cast<int>(m_posX + bitGlyph->left + bitmap.width +
-                         SPACING_BETWEEN_CHARACTERS_IN_TEXTURE) > static_cast<int>(m_textureWidth))
-    { // no space - gotta drop to the next line (which means creating a new texture and copying it across)
-      m_posX = 1;
-      m_posY += GetTextureLineHeight();
-      if (bitGlyph->left < 0)
-        m_posX += -bitGlyph->left;
-
-      if (m_posY + GetTextureLineHeight() >= m_textureHeight)
-      {
-        // create the new larger texture
-        unsigned int newHeight = m_posY + GetTextureLineHeight();
-        // check for max height
-        if (newHeight > m_renderSystem->GetMaxTextureSize())
-        {
-          CLog::LogF(LOGDEBUG, "New cache texture is too large ({} > {} pixels long)", newHeight,
-                     m_renderSystem->GetMaxTextureSize());
-          FT_Done_Glyph(glyph);
-          return false;
-        }
+    // reserve room for the character and the spacing to its neighbours
+    const unsigned int width = bitmap.width + SPACING_BETWEEN_CHARACTERS_IN_TEXTURE;
+    const unsigned int height = bitmap.rows + SPACING_BETWEEN_CHARACTERS_IN_TEXTURE;
+    const std::optional<CGUIFontAtlas::Allocation> allocation = m_atlas.Allocate(width, height);
+    if (!allocation)
+    {
+      if (m_atlas.Fits(width, height))
+        m_pageEvictionPending = true; // all pages are full
+      else
+        CLog::LogF(LOGDEBUG, "Glyph {:x} is too large for the cache texture ({}x{} pixels)",
+                   glyphIndex, bitmap.width, bitmap.rows);
+      FT_Done_Glyph(glyph);
+      return false;
+    }
 
-        std::unique_ptr<CTexture> newTexture = ReallocTexture(newHeight);
-        if (!newTexture)
-        {
-          FT_Done_Glyph(glyph);
-          CLog::LogF(LOGDEBUG, "Failed to allocate new texture of height {}", newHeight);
-          return false;
-        }
-        m_texture = std::move(newTexture);
+    page = allocation->m_page;
+    x1 = allocation->m_x + SPACING_BETWEEN_CHARACTERS_IN_TEXTURE;
+    y1 = page * m_atlas.GetPageHeight() + allocation->m_y + SPACING_BETWEEN_CHARACTERS_IN_TEXTURE;
+
+    const unsigned int pageBottom = (page + 1) * m_atlas.GetPageHeight();
+    if (pageBottom > m_textureHeight)
+    {
+      // a new page - create the new larger texture and copy the old pages across
+      unsigned int newHeight = pageBottom;
+      std::unique_ptr<CTexture> newTexture = ReallocTexture(newHeight);
+      if (!newTexture)
+      {
+        FT_Done_Glyph(glyph);
+        CLog::LogF(LOGDEBUG, "Failed to allocate new texture of height {}", newHeight);
+        return false;
       }
-      m_posY = GetMaxFontHeight();
+      m_texture = std::move(newTexture);
     }
 
     if (!m_texture)
@@ -1092,26 +1176,21 @@ bool CGUIFontTTF::CacheCharacter(FT_UInt glyphIndex, uint32_t style, Character*
   ch->m_glyphIndex = glyphIndex;
   ch->m_offsetX = static_cast<short>(bitGlyph->left);
   ch->m_offsetY = static_cast<short>(m_cellBaseLine - bitGlyph->top);
-  ch->m_left = isEmptyGlyph ? 0.0f : (static_cast<float>(m_posX));
-  ch->m_top = isEmptyGlyph ? 0.0f : (static_cast<float>(m_posY));
+  ch->m_left = static_cast<float>(x1);
+  ch->m_top = static_cast<float>(y1);
   ch->m_right = ch->m_left + bitmap.width;
   ch->m_bottom = ch->m_top + bitmap.rows;
   ch->m_advance =
       static_cast<float>(MathUtils::round_int(static_cast<double>(m_face->glyph->advance.x) / 64));
+  ch->m_page = page;
 
   // we need only render if we actually have some pixels
   if (!isEmptyGlyph)
   {
     // ensure our rect will stay inside the texture (it *should* but we need to be certain)
-    unsigned int x1 = std::max(m_posX, 0);
-    unsigned int y1 = std::max(m_posY, 0);
     unsigned int x2 = std::min(x1 + bitmap.width, m_textureWidth);
     unsigned int y2 = std::min(y1 + bitmap.rows, m_textureHeight);
-    m_maxFontHeight = std::max(m_maxFontHeight, y2);
     CopyCharToTexture(bitGlyph, x1, y1, x2, y2);
-
-    m_posX += SPACING_BETWEEN_CHARACTERS_IN_TEXTURE +
-              static_cast<unsigned short>(ch->m_right - ch->m_left);
   }
 
   // free the glyph
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "GUIFont.h"
+#include "GUIFontAtlas.h"
 #include "utils/ColorUtils.h"
 #include "utils/Geometry.h"
 
@@ -107,6 +108,11 @@ public:
 
   const std::string& GetFontIdent() const { return m_fontIdent; }
 
+  /*!
+   \brief Occupancy of the glyph texture pages.
+   */
+  CGUIFontAtlas::Stats GetAtlasStats() const { return m_atlas.GetStats(); }
+
 protected:
   explicit CGUIFontTTF(const std::string& fontIdent);
 
@@ -132,6 +138,7 @@ protected:
     float m_advance;
     FT_UInt m_glyphIndex;
     character_t m_glyphAndStyle;
+    unsigned int m_page; // page of the glyph texture or CGUIFontAtlas::NO_PAGE
   };
 
   struct RunInfo
@@ -147,7 +154,12 @@ protected:
   void AddReference();
   void RemoveReference();
 
-  std::vector<Glyph> GetHarfBuzzShapedGlyphs(const vecText& text);
+  /*!
+   \brief Get the glyphs of the text shaped by HarfBuzz from the shaping cache.
+   \return the glyphs, which stay valid until the next call.
+   */
+  const std::vector<Glyph>& GetHarfBuzzShapedGlyphs(const vecText& text);
+  std::vector<Glyph> ShapeText(const vecText& text) const;
 
   float GetTextWidthInternal(const vecText& text);
   float GetTextWidthInternal(const vecText& text, const std::vector<Glyph>& glyph);
@@ -181,6 +193,13 @@ protected:
                        bool roundX,
                        std::vector<SVertex>& vertices);
   void ClearCharacterCache();
+  void UpdateCharacterLookup(size_t startIndex);
+  /*!
+   \brief Empty the least recently used page of the glyph texture and drop its characters.
+
+   The cached vertices are flushed as well, so this must not be called while text is being drawn.
+   */
+  void EvictPage();
 
   virtual std::unique_ptr<CTexture> ReallocTexture(unsigned int& newHeight) = 0;
   virtual bool CopyCharToTexture(FT_BitmapGlyph bitGlyph,
@@ -199,14 +218,12 @@ protected:
 
   unsigned int m_textureWidth{0}; // width of our texture
   unsigned int m_textureHeight{0}; // height of our texture
-  int m_posX{0}; // current position in the texture
-  int m_posY{0};
+  CGUIFontAtlas m_atlas; // packs the characters into pages of the texture
 
   /*! \brief the height of each line in the texture.
    Accounts for spacing between lines to avoid characters overlapping.
    */
   unsigned int GetTextureLineHeight() const;
-  unsigned int GetMaxFontHeight() const;
 
   KODI::UTILS::COLOR::Color m_color{KODI::UTILS::COLOR::NONE};
 
@@ -220,9 +237,9 @@ protected:
 
   unsigned int m_cellBaseLine{0};
   unsigned int m_cellHeight{0};
-  unsigned int m_maxFontHeight{0};
 
   unsigned int m_nestedBeginCount{0}; // speedups
+  bool m_pageEvictionPending{false}; // the glyph texture is full, reuse a page at the next Begin()
 
   // freetype stuff
   FT_Face m_face{nullptr};
@@ -273,11 +290,13 @@ protected:
 
   CGUIFontCache<CGUIFontCacheStaticPosition, CGUIFontCacheStaticValue> m_staticCache;
   CGUIFontCache<CGUIFontCacheDynamicPosition, CGUIFontCacheDynamicValue> m_dynamicCache;
+  CGUIFontShapeCache<std::vector<Glyph>> m_shapeCache;
 
   CRenderSystemBase* m_renderSystem;
 
 private:
   float GetTabSpaceLength();
+  void BeginBatch();
 
   virtual bool FirstBegin() = 0;
   virtual void LastEnd() = 0;
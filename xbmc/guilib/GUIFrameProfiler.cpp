@@ -0,0 +1,211 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "GUIFrameProfiler.h"
+
+#include "filesystem/File.h"
+#include "utils/JSONVariantWriter.h"
+#include "utils/Variant.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <mutex>
+
+namespace
+{
+// nearest rank percentiles of the durations, which are reordered
+CGUIFrameProfiler::Percentiles GetPercentiles(std::vector<int64_t>& durations)
+{
+  CGUIFrameProfiler::Percentiles result;
+  if (durations.empty())
+    return result;
+
+  const auto percentile = [&durations](unsigned int percent)
+  {
+    const size_t rank = (durations.size() * percent + 99) / 100;
+    const auto nth = durations.begin() + std::max<size_t>(rank, 1) - 1;
+    std::ranges::nth_element(durations, nth);
+    return static_cast<float>(*nth) / 1000.0f;
+  };
+  result.m_p50 = percentile(50);
+  result.m_p95 = percentile(95);
+  result.m_p99 = percentile(99);
+  result.m_max = static_cast<float>(std::ranges::max(durations)) / 1000.0f;
+  return result;
+}
+
+CVariant CreateTraceEvent(const char* name, int64_t startUs, int64_t durationUs, uint64_t frame)
+{
+  CVariant event(CVariant::VariantTypeObject);
+  event["name"] = name;
+  event["cat"] = "gui";
+  event["ph"] = "X";
+  event["ts"] = startUs;
+  event["dur"] = durationUs;
+  event["pid"] = 1;
+  event["tid"] = 1;
+  event["args"]["frame"] = frame;
+  return event;
+}
+} // unnamed namespace
+
+CGUIFrameProfiler& CGUIFrameProfiler::Instance()
+{
+  static CGUIFrameProfiler profiler(DEFAULT_MAX_FRAMES, DEFAULT_MAX_PHASES);
+  return profiler;
+}
+
+const char* CGUIFrameProfiler::GetPhaseName(Phase phase)
+{
+  switch (phase)
+  {
+    case Phase::APP_PROCESS:
+      return "Process";
+    case Phase::FRAME_MOVE:
+      return "FrameMove";
+    case Phase::GUI_PROCESS:
+      return "WindowManager::Process";
+    case Phase::GUI_RENDER:
+      return "WindowManager::Render";
+    case Phase::DIRTY_REGIONS:
+      return "DirtyRegions";
+    case Phase::TEXTURE_UPLOAD:
+      return "TextureUpload";
+    case Phase::PRESENT:
+      return "Present";
+    default:
+      return "Unknown";
+  }
+}
+
+CGUIFrameProfiler::CGUIFrameProfiler(size_t maxFrames, size_t maxPhases)
+  : m_epoch(Clock::now()),
+    m_frames(std::max<size_t>(maxFrames, 1)),
+    m_phases(std::max<size_t>(maxPhases, 1))
+{
+}
+
+void CGUIFrameProfiler::BeginFrame(Clock::time_point now)
+{
+  std::unique_lock lock(m_section);
+  const int64_t nowUs = ToUs(now);
+  if (m_inFrame)
+  {
+    m_current.m_durationUs = nowUs - m_current.m_startUs;
+    m_frames[m_nextFrame] = m_current;
+    m_nextFrame = (m_nextFrame + 1) % m_frames.size();
+    m_frameCount = std::min(m_frameCount + 1, m_frames.size());
+  }
+
+  const uint64_t number = m_inFrame ? m_current.m_number + 1 : 0;
+  m_current = {};
+  m_current.m_number = number;
+  m_current.m_startUs = nowUs;
+  m_inFrame = true;
+  m_frameThread = std::this_thread::get_id();
+}
+
+void CGUIFrameProfiler::AddPhase(Phase phase, Clock::time_point start, Clock::time_point end)
+{
+  if (phase >= Phase::COUNT)
+    return;
+
+  std::unique_lock lock(m_section);
+  if (!m_inFrame || std::this_thread::get_id() != m_frameThread)
+    return;
+
+  PhaseEvent& event = m_phases[m_nextPhase];
+  event.m_frame = m_current.m_number;
+  event.m_startUs = ToUs(start);
+  event.m_durationUs = ToUs(end) - event.m_startUs;
+  event.m_phase = phase;
+  m_nextPhase = (m_nextPhase + 1) % m_phases.size();
+  m_phaseCount = std::min(m_phaseCount + 1, m_phases.size());
+
+  m_current.m_phaseUs[static_cast<size_t>(phase)] += event.m_durationUs;
+}
+
+CGUIFrameProfiler::Stats CGUIFrameProfiler::GetStats() const
+{
+  Stats stats;
+  std::vector<int64_t> durations;
+  std::array<std::vector<int64_t>, PHASE_COUNT> phases;
+  {
+    std::unique_lock lock(m_section);
+    stats.m_frames = static_cast<unsigned int>(m_frameCount);
+    durations.reserve(m_frameCount);
+    for (std::vector<int64_t>& phase : phases)
+      phase.reserve(m_frameCount);
+
+    for (size_t i = 0; i < m_frameCount; ++i)
+    {
+      const Frame& frame = m_frames[i];
+      durations.push_back(frame.m_durationUs);
+      for (size_t phase = 0; phase < PHASE_COUNT; ++phase)
+        phases[phase].push_back(frame.m_phaseUs[phase]);
+    }
+  }
+
+  stats.m_frame = GetPercentiles(durations);
+  for (size_t phase = 0; phase < PHASE_COUNT; ++phase)
+    stats.m_phases[phase] = GetPercentiles(phases[phase]);
+  return stats;
+}
+
+std::string CGUIFrameProfiler::ExportTrace() const
+{
+  CVariant events(CVariant::VariantTypeArray);
+  {
+    std::unique_lock lock(m_section);
+    // oldest first
+    const size_t firstFrame = (m_nextFrame + m_frames.size() - m_frameCount) % m_frames.size();
+    for (size_t i = 0; i < m_frameCount; ++i)
+    {
+      const Frame& frame = m_frames[(firstFrame + i) % m_frames.size()];
+      events.push_back(
+          CreateTraceEvent("Frame", frame.m_startUs, frame.m_durationUs, frame.m_number));
+    }
+
+    const size_t firstPhase = (m_nextPhase + m_phases.size() - m_phaseCount) % m_phases.size();
+    for (size_t i = 0; i < m_phaseCount; ++i)
+    {
+      const PhaseEvent& event = m_phases[(firstPhase + i) % m_phases.size()];
+      events.push_back(CreateTraceEvent(GetPhaseName(event.m_phase), event.m_startUs,
+                                        event.m_durationUs, event.m_frame));
+    }
+  }
+
+  CVariant trace(CVariant::VariantTypeObject);
+  trace["traceEvents"] = events;
+  trace["displayTimeUnit"] = "ms";
+
+  std::string output;
+  if (!CJSONVariantWriter::Write(trace, output, true))
+    return {};
+  return output;
+}
+
+bool CGUIFrameProfiler::SaveTrace(const std::string& path) const
+{
+  const std::string trace = ExportTrace();
+  XFILE::CFile file;
+  if (trace.empty() || !file.OpenForWrite(path, true) ||
+      file.Write(trace.data(), trace.size()) != static_cast<ssize_t>(trace.size()))
+  {
+    CLog::Log(LOGERROR, "CGUIFrameProfiler: failed to save the frame timeline to {}", path);
+    return false;
+  }
+
+  CLog::Log(LOGINFO, "CGUIFrameProfiler: saved the frame timeline to {}", path);
+  return true;
+}
+
+int64_t CGUIFrameProfiler::ToUs(Clock::time_point time) const
+{
+  return std::chrono::duration_cast<std::chrono::microseconds>(time - m_epoch).count();
+}
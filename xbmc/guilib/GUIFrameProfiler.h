@@ -0,0 +1,139 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*!
+ \brief Records the timeline of the last frames of the GUI loop.
+
+ The phases of every frame (application process, frame move, window process and render, dirty
+ region solving, texture uploads and present) are stored in fixed size ring buffers, so the
+ profiler is cheap enough to always run. Phases are only recorded on the thread running the frame
+ loop, nested phases are included in the time of their parent. The timeline can be exported in
+ the Chrome trace event format, e.g. for chrome://tracing or Perfetto.
+ */
+class CGUIFrameProfiler
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  enum class Phase : uint8_t
+  {
+    APP_PROCESS,
+    FRAME_MOVE,
+    GUI_PROCESS,
+    GUI_RENDER,
+    DIRTY_REGIONS,
+    TEXTURE_UPLOAD,
+    PRESENT,
+    COUNT
+  };
+  static constexpr size_t PHASE_COUNT = static_cast<size_t>(Phase::COUNT);
+
+  struct Percentiles
+  {
+    float m_p50{0.0f}; ///< in ms
+    float m_p95{0.0f};
+    float m_p99{0.0f};
+    float m_max{0.0f};
+  };
+
+  struct Stats
+  {
+    unsigned int m_frames{0}; ///< the number of frames the statistics are based on
+    Percentiles m_frame;
+    std::array<Percentiles, PHASE_COUNT> m_phases;
+  };
+
+  /*!
+   \brief Measures a phase from construction to destruction.
+   */
+  class CScope
+  {
+  public:
+    explicit CScope(Phase phase) : m_phase(phase), m_start(Clock::now()) {}
+    ~CScope() { Instance().AddPhase(m_phase, m_start, Clock::now()); }
+
+    CScope(const CScope&) = delete;
+    CScope& operator=(const CScope&) = delete;
+
+  private:
+    Phase m_phase;
+    Clock::time_point m_start;
+  };
+
+  static constexpr size_t DEFAULT_MAX_FRAMES = 600;
+  static constexpr size_t DEFAULT_MAX_PHASES = 8192;
+
+  static CGUIFrameProfiler& Instance();
+  static const char* GetPhaseName(Phase phase);
+
+  CGUIFrameProfiler(size_t maxFrames, size_t maxPhases);
+
+  /*!
+   \brief Start a new frame, this ends the previous one.
+   */
+  void BeginFrame(Clock::time_point now = Clock::now());
+
+  /*!
+   \brief Record a phase of the current frame, ignored on other threads than the frame loop.
+   */
+  void AddPhase(Phase phase, Clock::time_point start, Clock::time_point end);
+
+  /*!
+   \brief Get the percentiles of the frame and phase times of the recorded frames.
+   */
+  Stats GetStats() const;
+
+  /*!
+   \brief Get the recorded timeline in the Chrome trace event format.
+   */
+  std::string ExportTrace() const;
+  bool SaveTrace(const std::string& path) const;
+
+private:
+  struct Frame
+  {
+    uint64_t m_number{0};
+    int64_t m_startUs{0};
+    int64_t m_durationUs{0};
+    std::array<int64_t, PHASE_COUNT> m_phaseUs{};
+  };
+
+  struct PhaseEvent
+  {
+    uint64_t m_frame{0};
+    int64_t m_startUs{0};
+    int64_t m_durationUs{0};
+    Phase m_phase{Phase::APP_PROCESS};
+  };
+
+  int64_t ToUs(Clock::time_point time) const;
+
+  mutable CCriticalSection m_section;
+  Clock::time_point m_epoch;
+  std::thread::id m_frameThread;
+  // completed frames, the current frame is m_current
+  std::vector<Frame> m_frames;
+  size_t m_nextFrame{0};
+  size_t m_frameCount{0};
+  Frame m_current;
+  bool m_inFrame{false};
+  std::vector<PhaseEvent> m_phases;
+  size_t m_nextPhase{0};
+  size_t m_phaseCount{0};
+};
@@ -110,6 +110,14 @@ void CGUIImage::UpdateInfo(const CGUIListItem *item)
     SetFileName(m_info.GetLabel(m_parentID, true, &m_currentFallback));
 }
 
+void CGUIImage::Prefetch(const CGUIListItem* item, const void* owner) const
+{
+  if (m_info.IsConstant())
+    return;
+
+  m_textureCurrent->Prefetch(m_info.GetItemLabel(item, true), owner);
+}
+
 void CGUIImage::AllocateOnDemand()
 {
   // if we're hidden, we can free our resources and return
@@ -70,6 +70,11 @@ public:
   void SetInvalid() override;
   bool CanFocus() const override;
   void UpdateInfo(const CGUIListItem *item = NULL) override;
+  /*!
+   \brief Load the image of an item ahead of showing it.
+   \param owner identifies the requester, to cancel the prefetch.
+   */
+  void Prefetch(const CGUIListItem* item, const void* owner) const;
 
   virtual void SetInfo(const KODI::GUILIB::GUIINFO::CGUIInfoLabel &info);
   virtual void SetFileName(const std::string& strFileName, bool setConstant = false, const bool useCache = true);
@@ -8,6 +8,7 @@
 
 #include "GUIListGroup.h"
 
+#include "GUIImage.h"
 #include "GUIListLabel.h"
 #include "utils/log.h"
 
@@ -116,6 +117,25 @@ void CGUIListGroup::UpdateInfo(const CGUIListItem *item)
   }
 }
 
+void CGUIListGroup::Prefetch(const CGUIListItem* item, const void* owner) const
+{
+  for (const CGUIControl* control : m_children)
+  {
+    switch (control->GetControlType())
+    {
+      case CGUIControl::GUICONTROL_IMAGE:
+      case CGUIControl::GUICONTROL_BORDEREDIMAGE:
+        static_cast<const CGUIImage*>(control)->Prefetch(item, owner);
+        break;
+      case CGUIControl::GUICONTROL_LISTGROUP:
+        static_cast<const CGUIListGroup*>(control)->Prefetch(item, owner);
+        break;
+      default:
+        break;
+    }
+  }
+}
+
 void CGUIListGroup::EnlargeWidth(float difference)
 {
   // Alters the width of the controls that have an ID of 1 to 14
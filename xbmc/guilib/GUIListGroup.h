@@ -33,6 +33,7 @@ public:
   void ResetAnimation(ANIMATION_TYPE type) override;
   void UpdateVisibility(const CGUIListItem *item = NULL) override;
   void UpdateInfo(const CGUIListItem *item) override;
+  void Prefetch(const CGUIListItem* item, const void* owner) const;
   void SetInvalid() override;
 
   void EnlargeWidth(float difference);
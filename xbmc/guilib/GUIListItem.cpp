@@ -341,6 +341,16 @@ CGUIListItemLayout *CGUIListItem::GetFocusedLayout()
   return m_focusedLayout.get();
 }
 
+std::unique_ptr<CGUIListItemLayout> CGUIListItem::ReleaseLayout()
+{
+  return std::move(m_layout);
+}
+
+std::unique_ptr<CGUIListItemLayout> CGUIListItem::ReleaseFocusedLayout()
+{
+  return std::move(m_focusedLayout);
+}
+
 void CGUIListItem::SetInvalid()
 {
   if (m_layout)
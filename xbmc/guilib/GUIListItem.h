@@ -134,6 +134,12 @@ public:
   void SetFocusedLayout(std::unique_ptr<CGUIListItemLayout> layout);
   CGUIListItemLayout *GetFocusedLayout();
 
+  /*! \brief Take the layouts from the item, e.g. to recycle them for another item.
+   \return the layout, nullptr if the item has none
+   */
+  std::unique_ptr<CGUIListItemLayout> ReleaseLayout();
+  std::unique_ptr<CGUIListItemLayout> ReleaseFocusedLayout();
+
   void FreeIcons();
   void FreeMemory(bool immediately = false);
   void SetInvalid();
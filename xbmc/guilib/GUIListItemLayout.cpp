@@ -30,6 +30,7 @@ CGUIListItemLayout::CGUIListItemLayout(const CGUIListItemLayout& from)
 
 CGUIListItemLayout::CGUIListItemLayout(const CGUIListItemLayout& from, CGUIControl* control)
   : m_group(from.m_group),
+    m_source(&from),
     m_width(from.m_width),
     m_height(from.m_height),
     m_focused(from.m_focused),
@@ -55,6 +56,17 @@ void CGUIListItemLayout::ResetAnimation(ANIMATION_TYPE animType)
   return m_group.ResetAnimation(animType);
 }
 
+void CGUIListItemLayout::Recycle()
+{
+  m_group.ResetAnimations();
+  m_group.SetFocusedItem(0);
+  SetInvalid();
+
+  // the resources were freed when the layout was released, the textures of the new item are
+  // loaded once the info is updated
+  m_group.AllocResources();
+}
+
 float CGUIListItemLayout::Size(ORIENTATION orientation) const
 {
   return (orientation == HORIZONTAL) ? m_width : m_height;
@@ -96,6 +108,11 @@ void CGUIListItemLayout::Render(CGUIListItem *item, int parentID)
   m_group.DoRender();
 }
 
+void CGUIListItemLayout::Prefetch(const CGUIListItem* item, const void* owner) const
+{
+  m_group.Prefetch(item, owner);
+}
+
 void CGUIListItemLayout::SetFocusedItem(unsigned int focus)
 {
   m_group.SetFocusedItem(focus);
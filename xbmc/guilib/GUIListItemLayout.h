@@ -33,7 +33,21 @@ public:
   bool IsAnimating(ANIMATION_TYPE animType);
   void ResetAnimation(ANIMATION_TYPE animType);
   void SetInvalid() { m_invalidated = true; }
+  /*!
+   \brief Prepare the released layout to show another item, keeping its controls.
+   */
+  void Recycle();
+  /*!
+   \brief Get the layout this one is a copy of.
+   \return the layout, nullptr if the layout was loaded from the skin
+   */
+  const CGUIListItemLayout* GetSource() const { return m_source; }
   void FreeResources(bool immediately = false);
+  /*!
+   \brief Load the images of an item ahead of showing it with this layout.
+   \param owner identifies the requester, to cancel the prefetch.
+   */
+  void Prefetch(const CGUIListItem* item, const void* owner) const;
   void SetParentControl(CGUIControl* control) { m_group.SetParentControl(control); }
   void AssignDepth();
 
@@ -55,6 +69,7 @@ protected:
   void LoadControl(TiXmlElement *child, CGUIControlGroup *group);
 
   CGUIListGroup m_group;
+  const CGUIListItemLayout* m_source{nullptr};
 
   float m_width{0};
   float m_height{0};
@@ -0,0 +1,68 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "GUIListItemLayoutPool.h"
+
+#include "GUIListItem.h"
+#include "GUIListItemLayout.h"
+
+CGUIListItemLayoutPool::~CGUIListItemLayoutPool()
+{
+  Clear();
+}
+
+std::unique_ptr<CGUIListItemLayout> CGUIListItemLayoutPool::Acquire(
+    const CGUIListItemLayout& layout, CGUIControl* control)
+{
+  auto it = m_layouts.find(&layout);
+  if (it != m_layouts.end() && !it->second.empty())
+  {
+    std::unique_ptr<CGUIListItemLayout> recycled = std::move(it->second.back());
+    it->second.pop_back();
+    recycled->Recycle();
+    ++m_recycled;
+    return recycled;
+  }
+
+  ++m_created;
+  return std::make_unique<CGUIListItemLayout>(layout, control);
+}
+
+void CGUIListItemLayoutPool::Release(CGUIListItem& item)
+{
+  if (item.GetLayout())
+    Release(item.ReleaseLayout());
+  if (item.GetFocusedLayout())
+    Release(item.ReleaseFocusedLayout());
+}
+
+void CGUIListItemLayoutPool::Release(std::unique_ptr<CGUIListItemLayout> layout)
+{
+  // the textures of the previous item mustn't show up for the next one, and pooled layouts don't
+  // hold on to textures
+  layout->FreeResources();
+
+  std::vector<std::unique_ptr<CGUIListItemLayout>>& layouts = m_layouts[layout->GetSource()];
+  if (layouts.size() < m_capacity)
+    layouts.emplace_back(std::move(layout));
+}
+
+void CGUIListItemLayoutPool::SetCapacity(size_t capacity)
+{
+  m_capacity = capacity;
+  for (auto& [source, layouts] : m_layouts)
+  {
+    if (layouts.size() > m_capacity)
+      layouts.resize(m_capacity);
+  }
+}
+
+void CGUIListItemLayoutPool::Clear()
+{
+  m_layouts.clear();
+}
@@ -0,0 +1,72 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <vector>
+
+class CGUIControl;
+class CGUIListItem;
+class CGUIListItemLayout;
+
+/*!
+ \ingroup controls
+ \brief Recycles the item layouts of a container.
+
+ Every item shown by a container gets a copy of the layout of the skin, which copies all controls
+ of the layout. Layouts of items which scroll out of view are kept here and bound to the items
+ which scroll into view, so scrolling through a large list doesn't copy layouts over and over.
+ The pool keeps at most the given capacity of layouts per skin layout, so memory stays
+ proportional to the number of items in view.
+ */
+class CGUIListItemLayoutPool
+{
+public:
+  CGUIListItemLayoutPool() = default;
+  ~CGUIListItemLayoutPool();
+
+  CGUIListItemLayoutPool(const CGUIListItemLayoutPool&) = delete;
+  CGUIListItemLayoutPool& operator=(const CGUIListItemLayoutPool&) = delete;
+
+  /*!
+   \brief Get a layout for an item.
+   \param layout the layout of the skin.
+   \param control the container the layout belongs to.
+   \return a recycled copy of layout if available, a new copy otherwise.
+   */
+  std::unique_ptr<CGUIListItemLayout> Acquire(const CGUIListItemLayout& layout,
+                                              CGUIControl* control);
+
+  /*!
+   \brief Take the layouts of an item which is out of view, their resources are freed.
+   */
+  void Release(CGUIListItem& item);
+
+  /*!
+   \brief Set the number of layouts kept per layout of the skin, surplus layouts are freed.
+   */
+  void SetCapacity(size_t capacity);
+
+  /*!
+   \brief Free all layouts in the pool.
+   */
+  void Clear();
+
+  size_t GetCreated() const { return m_created; }
+  size_t GetRecycled() const { return m_recycled; }
+
+private:
+  void Release(std::unique_ptr<CGUIListItemLayout> layout);
+
+  std::map<const CGUIListItemLayout*, std::vector<std::unique_ptr<CGUIListItemLayout>>> m_layouts;
+  size_t m_capacity{0};
+  size_t m_created{0};
+  size_t m_recycled{0};
+};
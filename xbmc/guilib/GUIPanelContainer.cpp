@@ -87,6 +87,8 @@ void CGUIPanelContainer::Process(unsigned int currentTime, CDirtyRegionList &dir
   // to have same behaviour when scrolling down, we need to set page control to offset+1
   UpdatePageControl(offset + (m_scroller.IsScrollingDown() ? 1 : 0));
 
+  PrefetchArtwork(offset - cacheBefore, offset + m_itemsPerPage + cacheAfter, currentTime);
+
   CGUIControl::Process(currentTime, dirtyregions);
 }
 
@@ -0,0 +1,162 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "GUIParallelProcessor.h"
+
+#include "GUIControl.h"
+#include "ServiceBroker.h"
+#include "settings/AdvancedSettings.h"
+#include "settings/SettingsComponent.h"
+#include "threads/Event.h"
+#include "utils/JobManager.h"
+#include "windowing/GraphicContext.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+
+namespace
+{
+struct Batch
+{
+  Batch(CGraphicContext& context,
+        CGUIControl& parent,
+        const std::vector<CGUIControl*>& controls,
+        unsigned int currentTime,
+        std::vector<CDirtyRegionList>& dirtyRegions,
+        CGraphicContext::TransformState state)
+    : m_context(context),
+      m_parent(parent),
+      m_controls(controls),
+      m_count(controls.size()),
+      m_currentTime(currentTime),
+      m_dirtyRegions(dirtyRegions),
+      m_state(std::move(state))
+  {
+  }
+
+  // only valid while controls are left, the caller waits for them
+  CGraphicContext& m_context;
+  CGUIControl& m_parent;
+  const std::vector<CGUIControl*>& m_controls;
+  const size_t m_count;
+  const unsigned int m_currentTime;
+  std::vector<CDirtyRegionList>& m_dirtyRegions;
+
+  const CGraphicContext::TransformState m_state;
+  std::atomic<size_t> m_next{0};
+  std::atomic<size_t> m_done{0};
+  std::atomic<bool> m_parentDirty{false};
+  CEvent m_finished;
+};
+
+// the batch whose controls are processed on this thread
+thread_local Batch* t_batch = nullptr;
+
+// process controls of the batch until none is left
+void Run(Batch& batch)
+{
+  t_batch = &batch;
+  CGraphicContext::SetThreadProcessing(true);
+  for (size_t index = batch.m_next++; index < batch.m_count; index = batch.m_next++)
+  {
+    CGUIControl* control = batch.m_controls[index];
+    control->UpdateVisibility(nullptr);
+    control->DoProcess(batch.m_currentTime, batch.m_dirtyRegions[index]);
+    if (++batch.m_done == batch.m_count)
+      batch.m_finished.Set();
+  }
+  CGraphicContext::SetThreadProcessing(false);
+  t_batch = nullptr;
+}
+} // unnamed namespace
+
+bool CGUIParallelProcessor::IsEnabled()
+{
+  return t_batch == nullptr &&
+         CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_guiParallelProcess;
+}
+
+void CGUIParallelProcessor::Process(CGraphicContext& context,
+                                    CGUIControl& parent,
+                                    const std::vector<CGUIControl*>& controls,
+                                    unsigned int currentTime,
+                                    std::vector<CDirtyRegionList>& dirtyRegions)
+{
+  dirtyRegions.assign(controls.size(), {});
+  if (controls.empty())
+    return;
+
+  auto batch = std::make_shared<Batch>(context, parent, controls, currentTime, dirtyRegions,
+                                       context.GetTransformState());
+
+  // workers which start late don't find anything left to do
+  const size_t workers =
+      std::min<size_t>(controls.size(), std::max(std::thread::hardware_concurrency(), 2u)) - 1;
+  for (size_t i = 0; i < workers; ++i)
+  {
+    CServiceBroker::GetJobManager()->Submit(
+        [batch]()
+        {
+          if (batch->m_next >= batch->m_count)
+            return;
+
+          CGraphicContext::TransformState state = batch->m_state;
+          CGraphicContext::SetThreadTransformState(&state);
+          Run(*batch);
+          CGraphicContext::SetThreadTransformState(nullptr);
+        },
+        CJob::PRIORITY_HIGH);
+  }
+
+  // the context stays locked, the workers lock its processing section instead
+  Run(*batch);
+  if (batch->m_done < batch->m_count)
+    batch->m_finished.Wait();
+
+  if (batch->m_parentDirty)
+    parent.MarkDirtyRegion(CGUIControl::DIRTY_STATE_CHILD);
+}
+
+bool CGUIParallelProcessor::DeferMarkDirty(const CGUIControl* parent)
+{
+  if (!t_batch || parent != &t_batch->m_parent)
+    return false;
+
+  t_batch->m_parentDirty = true;
+  return true;
+}
+
+void CGUIParallelProcessor::MergeDirtyRegions(const std::vector<CGUIControl*>& controls,
+                                              const std::vector<CDirtyRegionList>& regions,
+                                              CDirtyRegionList& dirtyRegions,
+                                              CRect& renderRegion)
+{
+  for (size_t i = 0; i < controls.size(); ++i)
+  {
+    if (controls[i]->IsVisible() || !regions[i].empty()) // visible or dirty (was visible?)
+      renderRegion.Union(controls[i]->GetRenderRegion());
+    dirtyRegions.insert(dirtyRegions.end(), regions[i].begin(), regions[i].end());
+  }
+}
+
+CGUIParallelProcessor::CSerialSection::CSerialSection()
+{
+  if (t_batch)
+  {
+    m_context = &t_batch->m_context;
+    m_context->lock();
+  }
+}
+
+CGUIParallelProcessor::CSerialSection::~CSerialSection()
+{
+  if (m_context)
+    m_context->unlock();
+}
@@ -0,0 +1,92 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "DirtyRegion.h"
+
+#include <vector>
+
+class CGraphicContext;
+class CGUIControl;
+
+/*!
+ \ingroup controls
+ \brief Processes sibling controls in parallel on the workers of the job manager.
+
+ Skins mark the controls whose subtree is safe to be processed in parallel with its siblings with
+ <parallelprocess>. The render thread processes controls as well and waits for the rest. It keeps
+ the graphic context locked for the whole batch, the threads processing the controls lock a
+ section of the context of their own instead, so other threads don't get in between. Every worker
+ gets a copy of the transform state of the render thread, the dirty regions are collected per
+ control and merged in the order of the controls, so the result doesn't depend on the scheduling.
+ Controls processed in parallel process their own children serially.
+
+ The info providers and the cached values of the info bools keep state which isn't thread safe,
+ they are serialized with CSerialSection.
+ */
+class CGUIParallelProcessor
+{
+public:
+  /*!
+   \brief Whether controls can be processed in parallel from the calling thread.
+   \return true if enabled in the advanced settings and not called while processing in parallel.
+   */
+  static bool IsEnabled();
+
+  /*!
+   \brief Update the visibility of and process the controls.
+   \param context the graphic context, locked by the calling thread.
+   \param parent the control the controls belong to.
+   \param controls the controls to process.
+   \param currentTime the time of the frame.
+   \param dirtyRegions receives the dirty regions of the controls, one list per control.
+   */
+  static void Process(CGraphicContext& context,
+                      CGUIControl& parent,
+                      const std::vector<CGUIControl*>& controls,
+                      unsigned int currentTime,
+                      std::vector<CDirtyRegionList>& dirtyRegions);
+
+  /*!
+   \brief Defer marking a parent as dirty while its children are processed in parallel.
+   \param parent the parent of the control which is marked as dirty.
+   \return true if parent is the one of the controls processed on the calling thread, it is marked
+   as dirty once all controls are processed.
+   */
+  static bool DeferMarkDirty(const CGUIControl* parent);
+
+  /*!
+   \brief Merge the dirty regions collected per control in the order of the controls.
+   \param controls the controls in the order of their parent.
+   \param regions the dirty regions of each of the controls.
+   \param dirtyRegions receives the dirty regions.
+   \param renderRegion receives the render regions of the controls which are visible or dirty.
+   */
+  static void MergeDirtyRegions(const std::vector<CGUIControl*>& controls,
+                                const std::vector<CDirtyRegionList>& regions,
+                                CDirtyRegionList& dirtyRegions,
+                                CRect& renderRegion);
+
+  /*!
+   \brief Serializes a section with the other threads processing controls in parallel, for state
+   which isn't thread safe. Does nothing on threads which don't process controls in parallel.
+   */
+  class CSerialSection
+  {
+  public:
+    CSerialSection();
+    ~CSerialSection();
+
+  private:
+    CSerialSection(const CSerialSection&) = delete;
+    CSerialSection& operator=(const CSerialSection&) = delete;
+
+    CGraphicContext* m_context{nullptr};
+  };
+};
@@ -0,0 +1,121 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "GUIQuadBatch.h"
+
+#include <algorithm>
+
+CGUIQuadBatch::CGUIQuadBatch(DrawFunction draw) : m_draw(std::move(draw))
+{
+}
+
+void CGUIQuadBatch::SetEnabled(bool enabled)
+{
+  if (m_enabled == enabled)
+    return;
+
+  Flush();
+  m_enabled = enabled;
+}
+
+void CGUIQuadBatch::Begin(const State& state)
+{
+  m_state = state;
+  m_stats.textures++;
+}
+
+void CGUIQuadBatch::AddQuad(const std::array<Vertex, 4>& quad)
+{
+  // the position of quads outside of the z = 0 plane depends on the projection,
+  // so don't move them in front of anything
+  bool unbounded = false;
+  CRect bounds(quad[0].x, quad[0].y, quad[0].x, quad[0].y);
+  for (const auto& vertex : quad)
+  {
+    unbounded |= vertex.z != 0.0f;
+    bounds.x1 = std::min(bounds.x1, vertex.x);
+    bounds.y1 = std::min(bounds.y1, vertex.y);
+    bounds.x2 = std::max(bounds.x2, vertex.x);
+    bounds.y2 = std::max(bounds.y2, vertex.y);
+  }
+
+  Batch& batch = GetBatch(bounds, unbounded);
+
+  const auto first = static_cast<uint16_t>(batch.vertices.size());
+  batch.vertices.insert(batch.vertices.end(), quad.begin(), quad.end());
+  for (const uint16_t index : {0, 1, 2, 2, 3, 0})
+    batch.indices.push_back(first + index);
+
+  batch.bounds.Union(bounds);
+  batch.unbounded |= unbounded;
+
+  m_stats.quads++;
+  m_stats.vertices += 4;
+}
+
+void CGUIQuadBatch::End()
+{
+  if (!m_enabled)
+    Flush();
+}
+
+void CGUIQuadBatch::Flush()
+{
+  if (m_flushing || m_usedBatches == 0)
+    return;
+
+  // drawing changes render state, which would flush us again
+  m_flushing = true;
+  for (size_t i = 0; i < m_usedBatches; ++i)
+  {
+    Batch& batch = m_batches[i];
+    if (!batch.vertices.empty())
+    {
+      m_draw(batch.state, batch.vertices, batch.indices);
+      m_stats.drawCalls++;
+    }
+    batch.vertices.clear();
+    batch.indices.clear();
+  }
+  m_usedBatches = 0;
+  m_flushing = false;
+}
+
+void CGUIQuadBatch::FrameEnd()
+{
+  Flush();
+  m_frameStats = m_stats;
+  m_stats = {};
+}
+
+CGUIQuadBatch::Batch& CGUIQuadBatch::GetBatch(const CRect& bounds, bool unbounded)
+{
+  // look for the latest batch with the same state which can take the quad
+  // without it being drawn before anything it overlaps
+  for (size_t i = m_usedBatches; i-- > 0;)
+  {
+    Batch& batch = m_batches[i];
+    if (batch.state == m_state && batch.vertices.size() + 4 <= MAX_VERTICES)
+      return batch;
+
+    if (unbounded || batch.unbounded || batch.bounds.Intersects(bounds))
+      break;
+  }
+
+  if (m_usedBatches == MAX_BATCHES)
+    Flush();
+
+  if (m_usedBatches == m_batches.size())
+    m_batches.emplace_back();
+
+  Batch& batch = m_batches[m_usedBatches++];
+  batch.state = m_state;
+  batch.bounds = CRect();
+  batch.unbounded = false;
+  return batch;
+}
@@ -0,0 +1,120 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "utils/Geometry.h"
+
+#include <array>
+#include <functional>
+#include <stdint.h>
+#include <vector>
+
+/*!
+ \ingroup textures
+ \brief Frame level batcher for the textured quads of GUI textures.
+
+ Renderers queue the quads of each CGUITexture here instead of drawing them right away. Quads that
+ share the same render state (textures, shader, colour, depth and blending) are merged into a
+ single draw call, also across controls. A quad is only moved into an earlier draw call if it
+ doesn't overlap anything queued after that call, so the visible stacking order is unchanged.
+
+ The queue has to be flushed before anything else is drawn or any render state (shader, scissors,
+ viewport, matrices) is changed, which the render system takes care of.
+
+ The batcher itself doesn't touch the graphics API, drawing is done by the draw function passed
+ on construction.
+ */
+class CGUIQuadBatch
+{
+public:
+  struct Vertex
+  {
+    float x, y, z;
+    float u1, v1;
+    float u2, v2;
+  };
+
+  struct State
+  {
+    unsigned int texture0 = 0; ///< texture bound to the first unit
+    unsigned int texture1 = 0; ///< texture bound to the second unit (diffuse), 0 for none
+    int shader = 0; ///< render system specific shader method
+    uint32_t color = 0; ///< modulating colour as ARGB
+    float depth = 0.0f;
+    bool blend = false;
+
+    bool operator==(const State& rhs) const = default;
+  };
+
+  struct Stats
+  {
+    unsigned int drawCalls = 0; ///< draw calls issued
+    unsigned int textures = 0; ///< GUI textures submitted
+    unsigned int quads = 0;
+    unsigned int vertices = 0;
+  };
+
+  using DrawFunction = std::function<void(const State& state,
+                                          const std::vector<Vertex>& vertices,
+                                          const std::vector<uint16_t>& indices)>;
+
+  explicit CGUIQuadBatch(DrawFunction draw);
+
+  /*!
+   \brief Enable or disable merging. When disabled every texture is drawn on End().
+   */
+  void SetEnabled(bool enabled);
+  bool IsEnabled() const { return m_enabled; }
+
+  /*!
+   \brief Start queueing the quads of a GUI texture.
+   \param state the render state of all quads added until End().
+   */
+  void Begin(const State& state);
+  void AddQuad(const std::array<Vertex, 4>& quad);
+  void End();
+
+  /*!
+   \brief Draw all queued quads.
+   */
+  void Flush();
+  bool IsFlushing() const { return m_flushing; }
+
+  /*!
+   \brief Draw all queued quads and make the counters of this frame available with GetFrameStats().
+   */
+  void FrameEnd();
+  const Stats& GetFrameStats() const { return m_frameStats; }
+
+  static constexpr size_t MAX_BATCHES = 64;
+  static constexpr size_t MAX_VERTICES = 65536;
+
+private:
+  struct Batch
+  {
+    State state;
+    std::vector<Vertex> vertices;
+    std::vector<uint16_t> indices;
+    CRect bounds;
+    bool unbounded = false; ///< contains quads of which the screen position isn't known
+  };
+
+  Batch& GetBatch(const CRect& bounds, bool unbounded);
+
+  DrawFunction m_draw;
+  bool m_enabled = true;
+  bool m_flushing = false;
+
+  State m_state;
+  std::vector<Batch> m_batches;
+  size_t m_usedBatches = 0;
+
+  Stats m_stats;
+  Stats m_frameStats;
+};
@@ -632,6 +632,28 @@ bool CGUITexture::SetDiffuseColor(KODI::UTILS::COLOR::Color color,
   return changed;
 }
 
+void CGUITexture::Prefetch(const std::string& filename, const void* owner) const
+{
+  if (filename.empty())
+    return;
+
+  if (!m_info.useLarge && CServiceBroker::GetGUI()->GetTextureManager().CanLoad(filename))
+    return;
+
+  // the size AllocResources() requests the image with
+  int width = m_requestWidth;
+  int height = m_requestHeight;
+  if (width == REQUEST_SIZE_UNSET && height == REQUEST_SIZE_UNSET)
+  {
+    const CGraphicContext& gfxContext = CServiceBroker::GetWinSystem()->GetGfxContext();
+    width = static_cast<int>(m_width / gfxContext.GetGUIScaleX() + 0.5f);
+    height = static_cast<int>(m_height / gfxContext.GetGUIScaleY() + 0.5f);
+  }
+  CServiceBroker::GetGUI()->GetLargeTextureManager().PrefetchImage(filename, width, height,
+                                                                   m_aspect.ratio, m_use_cache,
+                                                                   owner);
+}
+
 bool CGUITexture::ReadyToRender() const
 {
   return m_texture.size() > 0;
@@ -85,6 +85,13 @@ public:
   void DynamicResourceAlloc(bool bOnOff);
   bool AllocResources();
   void FreeResources(bool immediately = false);
+  /*!
+   \brief Load an image for this texture ahead of use, if it is loaded in the background.
+   \param filename the image to load.
+   \param owner identifies the requester, to cancel the prefetch.
+   \sa CGUILargeTextureManager::PrefetchImage
+   */
+  void Prefetch(const std::string& filename, const void* owner) const;
   void SetInvalid();
   void OnWindowResize();
 
@@ -46,15 +46,6 @@ private:
 
   std::array<GLubyte, 4> m_col;
 
-  struct PackedVertex
-  {
-    float x, y, z;
-    float u1, v1;
-    float u2, v2;
-  };
-
-  std::vector<PackedVertex> m_packedVertices;
-  std::vector<GLushort> m_idx;
   CRenderSystemGL *m_renderSystem;
 };
 
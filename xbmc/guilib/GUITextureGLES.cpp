@@ -10,6 +10,7 @@
 
 #include "ServiceBroker.h"
 #include "Texture.h"
+#include "TextureGLES.h"
 #include "guilib/TextureFormats.h"
 #include "rendering/gles/RenderSystemGLES.h"
 #include "utils/GLUtils.h"
@@ -19,6 +20,7 @@
 #include "windowing/WinSystem.h"
 
 #include <cstddef>
+#include <utility>
 
 void CGUITextureGLES::Register()
 {
@@ -70,6 +72,13 @@ void CGUITextureGLES::Begin(KODI::UTILS::COLOR::Color color)
   const bool hasBlendColor =
       m_col[0] != 255 || m_col[1] != 255 || m_col[2] != 255 || m_col[3] != 255;
 
+  // the quads are drawn by the render system, possibly together with those of other textures
+  CGUIQuadBatch::State state;
+  state.depth = m_depth;
+  m_swapUnits = false;
+
+  ShaderMethodGLES shader;
+
   if (m_diffuse.size())
   {
     if (m_isGLES20 && (texture->GetSwizzle() == KD_TEX_SWIZ_111R ||
@@ -77,19 +86,19 @@ void CGUITextureGLES::Begin(KODI::UTILS::COLOR::Color color)
     {
       if (texture->GetSwizzle() == KD_TEX_SWIZ_111R &&
           m_diffuse.m_textures[0]->GetSwizzle() == KD_TEX_SWIZ_111R)
-        m_renderSystem->EnableGUIShader(ShaderMethodGLES::SM_MULTI_111R_111R_BLENDCOLOR);
+        shader = ShaderMethodGLES::SM_MULTI_111R_111R_BLENDCOLOR;
       else if (hasBlendColor)
-        m_renderSystem->EnableGUIShader(ShaderMethodGLES::SM_MULTI_RGBA_111R_BLENDCOLOR);
+        shader = ShaderMethodGLES::SM_MULTI_RGBA_111R_BLENDCOLOR;
       else
-        m_renderSystem->EnableGUIShader(ShaderMethodGLES::SM_MULTI_RGBA_111R);
+        shader = ShaderMethodGLES::SM_MULTI_RGBA_111R;
     }
     else if (hasBlendColor)
     {
-      m_renderSystem->EnableGUIShader(ShaderMethodGLES::SM_MULTI_BLENDCOLOR);
+      shader = ShaderMethodGLES::SM_MULTI_BLENDCOLOR;
     }
     else
     {
-      m_renderSystem->EnableGUIShader(ShaderMethodGLES::SM_MULTI);
+      shader = ShaderMethodGLES::SM_MULTI;
     }
 
     hasAlpha |= m_diffuse.m_textures[0]->HasAlpha();
@@ -97,97 +106,47 @@ void CGUITextureGLES::Begin(KODI::UTILS::COLOR::Color color)
     // We don't need a 111R_RGBA version of the GLES 2.0 shaders, so in the
     // unlikely event of having an alpha-only texture, switch with the
     // diffuse.
-    if (texture->GetSwizzle() == KD_TEX_SWIZ_111R)
-    {
-      texture->BindToUnit(1);
-      m_diffuse.m_textures[0]->BindToUnit(0);
-    }
-    else
-    {
-      texture->BindToUnit(0);
-      m_diffuse.m_textures[0]->BindToUnit(1);
-    }
+    const GLuint textureId = static_cast<CGLESTexture*>(texture)->GetTextureID();
+    const GLuint diffuseId =
+        static_cast<CGLESTexture*>(m_diffuse.m_textures[0].get())->GetTextureID();
+    m_swapUnits = texture->GetSwizzle() == KD_TEX_SWIZ_111R;
+    state.texture0 = m_swapUnits ? diffuseId : textureId;
+    state.texture1 = m_swapUnits ? textureId : diffuseId;
   }
   else
   {
     if (m_isGLES20 && texture->GetSwizzle() == KD_TEX_SWIZ_111R)
     {
-      m_renderSystem->EnableGUIShader(ShaderMethodGLES::SM_TEXTURE_111R);
+      shader = ShaderMethodGLES::SM_TEXTURE_111R;
     }
     else if (hasBlendColor)
     {
-      m_renderSystem->EnableGUIShader(ShaderMethodGLES::SM_TEXTURE);
+      shader = ShaderMethodGLES::SM_TEXTURE;
     }
     else
     {
-      m_renderSystem->EnableGUIShader(ShaderMethodGLES::SM_TEXTURE_NOBLEND);
+      shader = ShaderMethodGLES::SM_TEXTURE_NOBLEND;
     }
 
-    texture->BindToUnit(0);
+    state.texture0 = static_cast<CGLESTexture*>(texture)->GetTextureID();
   }
 
-  if ( hasAlpha )
-  {
-    glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE_MINUS_DST_ALPHA, GL_ONE);
-    glEnable( GL_BLEND );
-  }
-  else
-  {
-    glDisable(GL_BLEND);
-  }
-  m_packedVertices.clear();
+  state.shader = static_cast<int>(shader);
+  // limited range is applied to the colour already
+  state.color = static_cast<uint32_t>(m_col[3]) << 24 | static_cast<uint32_t>(m_col[0]) << 16 |
+                static_cast<uint32_t>(m_col[1]) << 8 | m_col[2];
+  state.blend = hasAlpha;
+  m_renderSystem->GetGUIQuadBatch().Begin(state);
 }
 
 void CGUITextureGLES::End()
 {
-  if (!m_packedVertices.empty())
-  {
-    GLint posLoc  = m_renderSystem->GUIShaderGetPos();
-    GLint tex0Loc = m_renderSystem->GUIShaderGetCoord0();
-    GLint tex1Loc = m_renderSystem->GUIShaderGetCoord1();
-    GLint uniColLoc = m_renderSystem->GUIShaderGetUniCol();
-    GLint depthLoc = m_renderSystem->GUIShaderGetDepth();
-
-    if(uniColLoc >= 0)
-    {
-      glUniform4f(uniColLoc,(m_col[0] / 255.0f), (m_col[1] / 255.0f), (m_col[2] / 255.0f), (m_col[3] / 255.0f));
-    }
-
-    glUniform1f(depthLoc, m_depth);
-
-    if(m_diffuse.size())
-    {
-      if (m_texture.m_textures[m_currentFrame]->GetSwizzle() == KD_TEX_SWIZ_111R)
-        std::swap(tex0Loc, tex1Loc);
-      glVertexAttribPointer(tex1Loc, 2, GL_FLOAT, 0, sizeof(PackedVertex),
-                            (char*)m_packedVertices.data() + offsetof(PackedVertex, u2));
-      glEnableVertexAttribArray(tex1Loc);
-    }
-    glVertexAttribPointer(posLoc, 3, GL_FLOAT, 0, sizeof(PackedVertex),
-                          (char*)m_packedVertices.data() + offsetof(PackedVertex, x));
-    glEnableVertexAttribArray(posLoc);
-    glVertexAttribPointer(tex0Loc, 2, GL_FLOAT, 0, sizeof(PackedVertex),
-                          (char*)m_packedVertices.data() + offsetof(PackedVertex, u1));
-    glEnableVertexAttribArray(tex0Loc);
-
-    glDrawElements(GL_TRIANGLES, m_packedVertices.size()*6 / 4, GL_UNSIGNED_SHORT, m_idx.data());
-
-    if (m_diffuse.size())
-      glDisableVertexAttribArray(tex1Loc);
-
-    glDisableVertexAttribArray(posLoc);
-    glDisableVertexAttribArray(tex0Loc);
-  }
-
-  if (m_diffuse.size())
-    glActiveTexture(GL_TEXTURE0);
-  glEnable(GL_BLEND);
-  m_renderSystem->DisableGUIShader();
+  m_renderSystem->GetGUIQuadBatch().End();
 }
 
 void CGUITextureGLES::Draw(float *x, float *y, float *z, const CRect &texture, const CRect &diffuse, int orientation)
 {
-  PackedVertex vertices[4];
+  std::array<CGUIQuadBatch::Vertex, 4> vertices;
 
   // Setup texture coordinates
   //TopLeft
@@ -256,19 +215,16 @@ void CGUITextureGLES::Draw(float *x, float *y, float *z, const CRect &texture, c
     vertices[i].x = x[i];
     vertices[i].y = y[i];
     vertices[i].z = z[i];
-    m_packedVertices.push_back(vertices[i]);
-  }
 
-  if ((m_packedVertices.size() / 4) > (m_idx.size() / 6))
-  {
-    size_t i = m_packedVertices.size() - 4;
-    m_idx.push_back(i+0);
-    m_idx.push_back(i+1);
-    m_idx.push_back(i+2);
-    m_idx.push_back(i+2);
-    m_idx.push_back(i+3);
-    m_idx.push_back(i+0);
+    // the texture units are switched, so are the coordinates
+    if (m_swapUnits)
+    {
+      std::swap(vertices[i].u1, vertices[i].u2);
+      std::swap(vertices[i].v1, vertices[i].v2);
+    }
   }
+
+  m_renderSystem->GetGUIQuadBatch().AddQuad(vertices);
 }
 
 void CGUITextureGLES::DrawQuad(const CRect& rect,
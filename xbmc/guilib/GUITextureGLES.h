@@ -55,9 +55,8 @@ private:
 
   std::array<GLubyte, 4> m_col;
 
-  PackedVertices m_packedVertices;
-  std::vector<GLushort> m_idx;
   CRenderSystemGLES *m_renderSystem;
   bool m_isGLES20{true};
+  bool m_swapUnits{false}; ///< texture and diffuse are bound to each other's unit
 };
 
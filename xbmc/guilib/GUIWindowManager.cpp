@@ -10,6 +10,7 @@
 
 #include "GUIAudioManager.h"
 #include "GUIDialog.h"
+#include "GUIFrameProfiler.h"
 #include "GUIInfoManager.h"
 #include "GUIPassword.h"
 #include "GUITexture.h"
@@ -1214,6 +1215,7 @@ bool RenderOrderSortFunction(CGUIWindow *first, CGUIWindow *second)
 void CGUIWindowManager::Process(unsigned int currentTime)
 {
   assert(CServiceBroker::GetAppMessenger()->IsProcessThread());
+  CGUIFrameProfiler::CScope profile(CGUIFrameProfiler::Phase::GUI_PROCESS);
   std::unique_lock lock(CServiceBroker::GetWinSystem()->GetGfxContext());
 
   m_dirtyregions.clear();
@@ -1350,8 +1352,10 @@ void CGUIWindowManager::RenderEx() const
 bool CGUIWindowManager::Render()
 {
   assert(CServiceBroker::GetAppMessenger()->IsProcessThread());
+  CGUIFrameProfiler::CScope profile(CGUIFrameProfiler::Phase::GUI_RENDER);
   CSingleExit lock(CServiceBroker::GetWinSystem()->GetGfxContext());
 
+  const auto solveStart = CGUIFrameProfiler::Clock::now();
   int bufferAge = CServiceBroker::GetWinSystem()->GetBufferAge();
   bool visualizeDirtyRegions =
       CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_guiVisualizeDirtyRegions;
@@ -1363,6 +1367,8 @@ bool CGUIWindowManager::Render()
     m_tracker.CleanMarkedRegions(10);
 
   CDirtyRegionList dirtyRegions = m_tracker.GetDirtyRegions();
+  CGUIFrameProfiler::Instance().AddPhase(CGUIFrameProfiler::Phase::DIRTY_REGIONS, solveStart,
+                                         CGUIFrameProfiler::Clock::now());
 
   bool hasRendered = false;
   // If we visualize the regions we will always render the entire viewport
@@ -8,6 +8,7 @@
 
 #include "TextureDX.h"
 
+#include "guilib/GUIFrameProfiler.h"
 #include "utils/MemUtils.h"
 #include "utils/log.h"
 
@@ -75,6 +76,7 @@ void CDXTexture::LoadToGPU()
     // nothing to load - probably same image (no change)
     return;
   }
+  CGUIFrameProfiler::CScope profile(CGUIFrameProfiler::Phase::TEXTURE_UPLOAD);
 
   bool needUpdate = true;
   D3D11_USAGE usage = D3D11_USAGE_DEFAULT;
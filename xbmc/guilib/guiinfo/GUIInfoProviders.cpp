@@ -8,6 +8,7 @@
 
 #include "guilib/guiinfo/GUIInfoProviders.h"
 
+#include "guilib/GUIParallelProcessor.h"
 #include "guilib/guiinfo/IGUIInfoProvider.h"
 
 #include <algorithm>
@@ -80,6 +81,8 @@ bool CGUIInfoProviders::InitCurrentItem(CFileItem* item) const
 
 bool CGUIInfoProviders::GetLabel(std::string& value, const CFileItem *item, int contextWindow, const CGUIInfo &info, std::string *fallback) const
 {
+  // the providers keep state of their own, e.g. the temperatures of the system info
+  CGUIParallelProcessor::CSerialSection serial;
   for (const auto& provider : m_providers)
   {
     if (provider->GetLabel(value, item, contextWindow, info, fallback))
@@ -95,6 +98,7 @@ bool CGUIInfoProviders::GetLabel(std::string& value, const CFileItem *item, int
 
 bool CGUIInfoProviders::GetInt(int& value, const CGUIListItem *item, int contextWindow, const CGUIInfo &info) const
 {
+  CGUIParallelProcessor::CSerialSection serial;
   for (const auto& provider : m_providers)
   {
     if (provider->GetInt(value, item, contextWindow, info))
@@ -105,6 +109,7 @@ bool CGUIInfoProviders::GetInt(int& value, const CGUIListItem *item, int context
 
 bool CGUIInfoProviders::GetBool(bool& value, const CGUIListItem *item, int contextWindow, const CGUIInfo &info) const
 {
+  CGUIParallelProcessor::CSerialSection serial;
   for (const auto& provider : m_providers)
   {
     if (provider->GetBool(value, item, contextWindow, info))
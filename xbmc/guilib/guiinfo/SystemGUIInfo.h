@@ -41,6 +41,8 @@ private:
 
   static const int SYSTEM_HEAT_UPDATE_INTERVAL = 60000;
 
+  // updated while getting the labels, controls processed in parallel are serialized by
+  // CGUIInfoProviders
   mutable unsigned int m_lastSysHeatInfoTime;
   mutable CTemperature m_gpuTemp;
   mutable CTemperature m_cpuTemp;
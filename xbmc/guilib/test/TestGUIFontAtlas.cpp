@@ -0,0 +1,125 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "guilib/GUIFontAtlas.h"
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+bool Overlap(const CGUIFontAtlas::Allocation& a,
+             unsigned int aWidth,
+             unsigned int aHeight,
+             const CGUIFontAtlas::Allocation& b,
+             unsigned int bWidth,
+             unsigned int bHeight)
+{
+  return a.m_page == b.m_page && a.m_x < b.m_x + bWidth && b.m_x < a.m_x + aWidth &&
+         a.m_y < b.m_y + bHeight && b.m_y < a.m_y + aHeight;
+}
+} // unnamed namespace
+
+TEST(TestGUIFontAtlas, Skyline)
+{
+  CGUIFontAtlas atlas(64, 64, 1);
+
+  auto tall = atlas.Allocate(16, 32);
+  ASSERT_TRUE(tall);
+  EXPECT_EQ(0u, tall->m_x);
+  EXPECT_EQ(0u, tall->m_y);
+
+  auto small = atlas.Allocate(16, 8);
+  ASSERT_TRUE(small);
+  EXPECT_EQ(16u, small->m_x);
+  EXPECT_EQ(0u, small->m_y);
+
+  // doesn't fit next to the others, goes on top of the lowest part of the skyline
+  auto wide = atlas.Allocate(48, 8);
+  ASSERT_TRUE(wide);
+  EXPECT_EQ(16u, wide->m_x);
+  EXPECT_EQ(8u, wide->m_y);
+
+  EXPECT_FALSE(atlas.Allocate(65, 8));
+  EXPECT_FALSE(atlas.Allocate(8, 65));
+
+  const CGUIFontAtlas::Stats stats = atlas.GetStats();
+  EXPECT_EQ(1u, stats.m_pages);
+  EXPECT_EQ(16u * 32 + 16 * 8 + 48 * 8, stats.m_usedPixels);
+  EXPECT_EQ(64u * 64, stats.m_totalPixels);
+}
+
+TEST(TestGUIFontAtlas, NoOverlap)
+{
+  CGUIFontAtlas atlas(128, 64, 4);
+
+  struct Rect
+  {
+    CGUIFontAtlas::Allocation m_allocation;
+    unsigned int m_width;
+    unsigned int m_height;
+  };
+  std::vector<Rect> rects;
+  for (unsigned int i = 0; i < 100; ++i)
+  {
+    const unsigned int width = 5 + (i * 7) % 13;
+    const unsigned int height = 6 + (i * 5) % 11;
+    auto allocation = atlas.Allocate(width, height);
+    ASSERT_TRUE(allocation);
+    EXPECT_LE(allocation->m_x + width, 128u);
+    EXPECT_LE(allocation->m_y + height, 64u);
+    for (const Rect& rect : rects)
+      EXPECT_FALSE(Overlap(rect.m_allocation, rect.m_width, rect.m_height, *allocation, width,
+                           height));
+    rects.push_back({*allocation, width, height});
+  }
+  EXPECT_GT(atlas.GetPageCount(), 1u);
+}
+
+TEST(TestGUIFontAtlas, EvictLeastRecentlyUsedPage)
+{
+  CGUIFontAtlas atlas(32, 32, 3);
+
+  // one full page per allocation
+  for (unsigned int page = 0; page < 3; ++page)
+  {
+    auto allocation = atlas.Allocate(32, 32);
+    ASSERT_TRUE(allocation);
+    EXPECT_EQ(page, allocation->m_page);
+  }
+
+  // all pages are full, nothing is evicted until the owner asks for it
+  EXPECT_FALSE(atlas.Allocate(8, 8));
+  EXPECT_EQ(0u, atlas.GetStats().m_evictions);
+
+  atlas.Touch(0);
+  atlas.Touch(2);
+  EXPECT_EQ(1u, atlas.Evict());
+
+  auto allocation = atlas.Allocate(8, 8);
+  ASSERT_TRUE(allocation);
+  EXPECT_EQ(1u, allocation->m_page);
+  EXPECT_EQ(0u, allocation->m_x);
+  EXPECT_EQ(0u, allocation->m_y);
+
+  // the evicted page has room again
+  allocation = atlas.Allocate(8, 8);
+  ASSERT_TRUE(allocation);
+  EXPECT_EQ(1u, allocation->m_page);
+
+  const CGUIFontAtlas::Stats stats = atlas.GetStats();
+  EXPECT_EQ(3u, stats.m_pages);
+  EXPECT_EQ(1u, stats.m_evictions);
+  EXPECT_EQ(2u * 32 * 32 + 2 * 8 * 8, stats.m_usedPixels);
+
+  atlas.Reset();
+  EXPECT_EQ(0u, atlas.GetPageCount());
+  EXPECT_EQ(CGUIFontAtlas::NO_PAGE, atlas.Evict());
+  EXPECT_EQ(1u, atlas.GetStats().m_evictions);
+}
@@ -0,0 +1,105 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "guilib/GUIFontShapeCache.h"
+
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+std::vector<uint32_t> ToText(const std::string& str, uint32_t attributes = 0)
+{
+  std::vector<uint32_t> text;
+  for (const char ch : str)
+    text.push_back(static_cast<unsigned char>(ch) | attributes);
+  return text;
+}
+
+class TestGUIFontShapeCache : public ::testing::Test
+{
+protected:
+  const std::string& Get(const std::vector<uint32_t>& text)
+  {
+    return m_cache.Get(text,
+                       [this](const std::vector<uint32_t>& shapeText)
+                       {
+                         ++m_shaped;
+                         return std::string(shapeText.begin(), shapeText.end());
+                       });
+  }
+
+  CGUIFontShapeCache<std::string> m_cache{2};
+  int m_shaped = 0;
+};
+} // unnamed namespace
+
+TEST_F(TestGUIFontShapeCache, HitAndMiss)
+{
+  EXPECT_EQ("abc", Get(ToText("abc")));
+  EXPECT_EQ("abc", Get(ToText("abc")));
+  EXPECT_EQ("abd", Get(ToText("abd")));
+  EXPECT_EQ(2, m_shaped);
+
+  const CGUIFontCacheStats stats = m_cache.GetStats();
+  EXPECT_EQ(1u, stats.m_hits);
+  EXPECT_EQ(2u, stats.m_misses);
+  EXPECT_EQ(2u, stats.m_entries);
+}
+
+TEST_F(TestGUIFontShapeCache, Attributes)
+{
+  // colours don't change the shaping, styles do
+  Get(ToText("abc"));
+  Get(ToText("abc", 0x00030000));
+  EXPECT_EQ(1, m_shaped);
+
+  Get(ToText("abc", 0x01000000));
+  EXPECT_EQ(2, m_shaped);
+}
+
+TEST_F(TestGUIFontShapeCache, LeastRecentlyUsed)
+{
+  Get(ToText("a"));
+  Get(ToText("b"));
+  Get(ToText("a"));
+  Get(ToText("c")); // evicts "b"
+  EXPECT_EQ(3, m_shaped);
+
+  Get(ToText("a"));
+  EXPECT_EQ(3, m_shaped);
+  Get(ToText("b"));
+  EXPECT_EQ(4, m_shaped);
+  EXPECT_EQ(2u, m_cache.GetStats().m_entries);
+
+  m_cache.Flush();
+  EXPECT_EQ(0u, m_cache.GetStats().m_entries);
+  Get(ToText("a"));
+  EXPECT_EQ(5, m_shaped);
+}
+
+TEST(TestGUIFontText, Hash)
+{
+  // labels of a list which only differ at the end end up in different buckets
+  std::unordered_set<size_t> hashes;
+  for (int i = 0; i < 1000; ++i)
+  {
+    const std::vector<uint32_t> text = ToText("Episode " + std::to_string(i));
+    hashes.insert(HashFontText(text.data(), text.size()));
+  }
+  EXPECT_EQ(1000u, hashes.size());
+
+  const std::vector<uint32_t> text = ToText("abc", 0x00020000);
+  const std::vector<uint32_t> plain = ToText("abc");
+  EXPECT_NE(HashFontText(text.data(), text.size()), HashFontText(plain.data(), plain.size()));
+  EXPECT_EQ(HashFontText(text.data(), text.size(), 0xff00ffff),
+            HashFontText(plain.data(), plain.size(), 0xff00ffff));
+}
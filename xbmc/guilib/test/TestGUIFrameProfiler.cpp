@@ -0,0 +1,117 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "guilib/GUIFrameProfiler.h"
+#include "utils/JSONVariantParser.h"
+#include "utils/Variant.h"
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+constexpr size_t Index(CGUIFrameProfiler::Phase phase)
+{
+  return static_cast<size_t>(phase);
+}
+} // unnamed namespace
+
+TEST(TestGUIFrameProfiler, Percentiles)
+{
+  CGUIFrameProfiler profiler(100, 1000);
+  auto now = CGUIFrameProfiler::Clock::now();
+
+  // frames of 1 to 100 ms, rendering takes half of each
+  for (int i = 1; i <= 100; ++i)
+  {
+    profiler.BeginFrame(now);
+    profiler.AddPhase(CGUIFrameProfiler::Phase::GUI_RENDER, now, now + i * 500us);
+    now += i * 1ms;
+  }
+  profiler.BeginFrame(now);
+
+  const CGUIFrameProfiler::Stats stats = profiler.GetStats();
+  EXPECT_EQ(100u, stats.m_frames);
+  EXPECT_FLOAT_EQ(50.0f, stats.m_frame.m_p50);
+  EXPECT_FLOAT_EQ(95.0f, stats.m_frame.m_p95);
+  EXPECT_FLOAT_EQ(99.0f, stats.m_frame.m_p99);
+  EXPECT_FLOAT_EQ(100.0f, stats.m_frame.m_max);
+
+  const CGUIFrameProfiler::Percentiles& render =
+      stats.m_phases[Index(CGUIFrameProfiler::Phase::GUI_RENDER)];
+  EXPECT_FLOAT_EQ(25.0f, render.m_p50);
+  EXPECT_FLOAT_EQ(50.0f, render.m_max);
+  EXPECT_FLOAT_EQ(0.0f, stats.m_phases[Index(CGUIFrameProfiler::Phase::PRESENT)].m_max);
+}
+
+TEST(TestGUIFrameProfiler, RingBuffer)
+{
+  CGUIFrameProfiler profiler(10, 4);
+  auto now = CGUIFrameProfiler::Clock::now();
+
+  // the last 10 frames take 2 ms, the ones before 50 ms
+  for (int i = 0; i < 30; ++i)
+  {
+    profiler.BeginFrame(now);
+    profiler.AddPhase(CGUIFrameProfiler::Phase::PRESENT, now, now + 1ms);
+    profiler.AddPhase(CGUIFrameProfiler::Phase::PRESENT, now + 1ms, now + 2ms);
+    now += i < 20 ? 50ms : 2ms;
+  }
+  profiler.BeginFrame(now);
+
+  const CGUIFrameProfiler::Stats stats = profiler.GetStats();
+  EXPECT_EQ(10u, stats.m_frames);
+  EXPECT_FLOAT_EQ(2.0f, stats.m_frame.m_max);
+  // phases of the same kind add up
+  EXPECT_FLOAT_EQ(2.0f, stats.m_phases[Index(CGUIFrameProfiler::Phase::PRESENT)].m_p50);
+}
+
+TEST(TestGUIFrameProfiler, OtherThreadsAreIgnored)
+{
+  CGUIFrameProfiler profiler(10, 10);
+  const auto now = CGUIFrameProfiler::Clock::now();
+  profiler.BeginFrame(now);
+
+  std::thread loader(
+      [&profiler, now]()
+      { profiler.AddPhase(CGUIFrameProfiler::Phase::TEXTURE_UPLOAD, now, now + 5ms); });
+  loader.join();
+  profiler.AddPhase(CGUIFrameProfiler::Phase::TEXTURE_UPLOAD, now, now + 1ms);
+  profiler.BeginFrame(now + 10ms);
+
+  const CGUIFrameProfiler::Stats stats = profiler.GetStats();
+  EXPECT_FLOAT_EQ(1.0f, stats.m_phases[Index(CGUIFrameProfiler::Phase::TEXTURE_UPLOAD)].m_max);
+}
+
+TEST(TestGUIFrameProfiler, ExportTrace)
+{
+  CGUIFrameProfiler profiler(10, 10);
+  const auto now = CGUIFrameProfiler::Clock::now();
+  profiler.BeginFrame(now);
+  profiler.AddPhase(CGUIFrameProfiler::Phase::APP_PROCESS, now + 1ms, now + 3ms);
+  profiler.BeginFrame(now + 16ms);
+
+  CVariant trace;
+  ASSERT_TRUE(CJSONVariantParser::Parse(profiler.ExportTrace(), trace));
+  const CVariant& events = trace["traceEvents"];
+  ASSERT_TRUE(events.isArray());
+  ASSERT_EQ(2u, events.size());
+
+  EXPECT_EQ("Frame", events[0]["name"].asString());
+  EXPECT_EQ("X", events[0]["ph"].asString());
+  EXPECT_EQ(16000, events[0]["dur"].asInteger());
+
+  EXPECT_EQ(CGUIFrameProfiler::GetPhaseName(CGUIFrameProfiler::Phase::APP_PROCESS),
+            events[1]["name"].asString());
+  EXPECT_EQ(events[0]["ts"].asInteger() + 1000, events[1]["ts"].asInteger());
+  EXPECT_EQ(2000, events[1]["dur"].asInteger());
+  EXPECT_EQ(0, events[1]["args"]["frame"].asInteger());
+}
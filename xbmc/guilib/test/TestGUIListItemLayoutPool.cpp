@@ -0,0 +1,96 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "guilib/GUIListItem.h"
+#include "guilib/GUIListItemLayout.h"
+#include "guilib/GUIListItemLayoutPool.h"
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+TEST(TestGUIListItemLayoutPool, ScrollLargeList)
+{
+  constexpr size_t ITEMS = 50000;
+  constexpr size_t IN_VIEW = 12;
+
+  std::vector<std::shared_ptr<CGUIListItem>> items;
+  items.reserve(ITEMS);
+  for (size_t i = 0; i < ITEMS; ++i)
+    items.emplace_back(std::make_shared<CGUIListItem>());
+
+  const CGUIListItemLayout layout;
+  CGUIListItemLayoutPool pool;
+  pool.SetCapacity(IN_VIEW);
+
+  // scroll through the list one item at a time, like the container does
+  for (size_t offset = 0; offset + IN_VIEW <= ITEMS; ++offset)
+  {
+    if (offset > 0)
+      pool.Release(*items[offset - 1]);
+    for (size_t i = offset; i < offset + IN_VIEW; ++i)
+    {
+      if (!items[i]->GetLayout())
+        items[i]->SetLayout(pool.Acquire(layout, nullptr));
+    }
+  }
+
+  EXPECT_EQ(IN_VIEW, pool.GetCreated());
+  EXPECT_EQ(ITEMS - IN_VIEW, pool.GetRecycled());
+  EXPECT_EQ(nullptr, items.front()->GetLayout());
+  EXPECT_NE(nullptr, items.back()->GetLayout());
+}
+
+TEST(TestGUIListItemLayoutPool, RecyclesPerLayout)
+{
+  const CGUIListItemLayout layout;
+  const CGUIListItemLayout focusedLayout;
+  CGUIListItemLayoutPool pool;
+  pool.SetCapacity(1);
+
+  CGUIListItem item;
+  item.SetLayout(pool.Acquire(layout, nullptr));
+  item.SetFocusedLayout(pool.Acquire(focusedLayout, nullptr));
+  CGUIListItemLayout* released = item.GetFocusedLayout();
+  pool.Release(item);
+  EXPECT_EQ(nullptr, item.GetLayout());
+  EXPECT_EQ(nullptr, item.GetFocusedLayout());
+
+  // a layout is only recycled for the layout it is a copy of
+  item.SetFocusedLayout(pool.Acquire(focusedLayout, nullptr));
+  EXPECT_EQ(released, item.GetFocusedLayout());
+  EXPECT_EQ(&focusedLayout, item.GetFocusedLayout()->GetSource());
+  EXPECT_EQ(2u, pool.GetCreated());
+  EXPECT_EQ(1u, pool.GetRecycled());
+}
+
+TEST(TestGUIListItemLayoutPool, Capacity)
+{
+  const CGUIListItemLayout layout;
+  CGUIListItemLayoutPool pool;
+  pool.SetCapacity(2);
+
+  std::vector<CGUIListItem> items(4);
+  for (CGUIListItem& item : items)
+    item.SetLayout(pool.Acquire(layout, nullptr));
+  for (CGUIListItem& item : items)
+    pool.Release(item);
+
+  // surplus layouts are freed
+  for (CGUIListItem& item : items)
+    item.SetLayout(pool.Acquire(layout, nullptr));
+  EXPECT_EQ(6u, pool.GetCreated());
+  EXPECT_EQ(2u, pool.GetRecycled());
+
+  for (CGUIListItem& item : items)
+    pool.Release(item);
+  pool.Clear();
+  items.front().SetLayout(pool.Acquire(layout, nullptr));
+  EXPECT_EQ(7u, pool.GetCreated());
+}
@@ -0,0 +1,196 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "guilib/GUIControl.h"
+#include "guilib/GUIParallelProcessor.h"
+#include "windowing/GraphicContext.h"
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+class CTestControl : public CGUIControl
+{
+public:
+  CTestControl(const CRect& region, bool visible = true)
+  {
+    m_renderRegion = region;
+    m_visible = visible ? VISIBLE : HIDDEN;
+    m_controlDirtyState = 0;
+    m_isCulled = false;
+  }
+
+  void UpdateVisibility(const CGUIListItem* item) override {}
+
+  void DoProcess(unsigned int currentTime, CDirtyRegionList& dirtyregions) override
+  {
+    if (m_process)
+      m_process(*this, dirtyregions);
+  }
+
+  CGUIControl* Clone() const override { return nullptr; }
+
+  std::function<void(CTestControl&, CDirtyRegionList&)> m_process;
+};
+
+std::vector<CGUIControl*> Pointers(const std::vector<std::unique_ptr<CTestControl>>& controls)
+{
+  std::vector<CGUIControl*> pointers;
+  for (const auto& control : controls)
+    pointers.push_back(control.get());
+  return pointers;
+}
+} // unnamed namespace
+
+TEST(TestGUIParallelProcessor, MergeDirtyRegions)
+{
+  CTestControl visible(CRect(0, 0, 10, 10));
+  CTestControl hidden(CRect(100, 100, 110, 110), false);
+  CTestControl hiddenDirty(CRect(20, 0, 30, 10), false);
+  const std::vector<CGUIControl*> controls{&visible, &hidden, &hiddenDirty};
+  const std::vector<CDirtyRegionList> regions{{CDirtyRegion(0, 0, 5, 5)},
+                                              {},
+                                              {CDirtyRegion(20, 0, 25, 5),
+                                               CDirtyRegion(25, 5, 30, 10)}};
+
+  CDirtyRegionList dirtyRegions{CDirtyRegion(50, 50, 60, 60)};
+  CRect renderRegion;
+  CGUIParallelProcessor::MergeDirtyRegions(controls, regions, dirtyRegions, renderRegion);
+
+  // appended in the order of the controls
+  ASSERT_EQ(4u, dirtyRegions.size());
+  EXPECT_EQ(CRect(50, 50, 60, 60), dirtyRegions[0]);
+  EXPECT_EQ(CRect(0, 0, 5, 5), dirtyRegions[1]);
+  EXPECT_EQ(CRect(20, 0, 25, 5), dirtyRegions[2]);
+  EXPECT_EQ(CRect(25, 5, 30, 10), dirtyRegions[3]);
+
+  // the hidden control which isn't dirty doesn't count
+  EXPECT_EQ(CRect(0, 0, 30, 10), renderRegion);
+}
+
+TEST(TestGUIParallelProcessor, DirtyRegionsInOrderOfControls)
+{
+  constexpr int CONTROLS = 16;
+  CGraphicContext context;
+  CTestControl parent{CRect()};
+
+  std::vector<std::unique_ptr<CTestControl>> controls;
+  for (int i = 0; i < CONTROLS; ++i)
+  {
+    auto control = std::make_unique<CTestControl>(CRect(i, 0, i + 1, 1));
+    control->SetParentControl(&parent);
+    // the later controls finish first
+    control->m_process = [i](CTestControl& control, CDirtyRegionList& dirtyregions)
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(CONTROLS - i));
+      for (int region = 0; region <= i % 3; ++region)
+        dirtyregions.emplace_back(CRect(i, region, i + 1, region + 1));
+    };
+    controls.emplace_back(std::move(control));
+  }
+
+  std::unique_lock lock(context);
+  std::vector<CDirtyRegionList> regions;
+  CGUIParallelProcessor::Process(context, parent, Pointers(controls), 0, regions);
+
+  ASSERT_EQ(static_cast<size_t>(CONTROLS), regions.size());
+  for (int i = 0; i < CONTROLS; ++i)
+  {
+    ASSERT_EQ(static_cast<size_t>(i % 3 + 1), regions[i].size());
+    for (int region = 0; region <= i % 3; ++region)
+      EXPECT_EQ(CRect(i, region, i + 1, region + 1), regions[i][region]);
+  }
+}
+
+TEST(TestGUIParallelProcessor, DeferMarkDirty)
+{
+  constexpr int CONTROLS = 8;
+  CGraphicContext context;
+  CTestControl parent{CRect()};
+  CTestControl other{CRect()};
+
+  std::atomic<int> deferred{0};
+  std::atomic<int> parentDirty{0};
+  std::vector<std::unique_ptr<CTestControl>> controls;
+  for (int i = 0; i < CONTROLS; ++i)
+  {
+    auto control = std::make_unique<CTestControl>(CRect(i, 0, i + 1, 1));
+    control->SetParentControl(&parent);
+    control->m_process = [&](CTestControl& control, CDirtyRegionList& dirtyregions)
+    {
+      // only the parent of the batch is deferred
+      if (CGUIParallelProcessor::DeferMarkDirty(&parent) &&
+          !CGUIParallelProcessor::DeferMarkDirty(&other))
+        ++deferred;
+      control.MarkDirtyRegion();
+      if (parent.IsControlDirty())
+        ++parentDirty;
+    };
+    controls.emplace_back(std::move(control));
+  }
+
+  EXPECT_FALSE(CGUIParallelProcessor::DeferMarkDirty(&parent));
+
+  std::unique_lock lock(context);
+  std::vector<CDirtyRegionList> regions;
+  CGUIParallelProcessor::Process(context, parent, Pointers(controls), 0, regions);
+
+  EXPECT_EQ(CONTROLS, deferred);
+  // the parent is marked once all controls are processed
+  EXPECT_EQ(0, parentDirty);
+  EXPECT_TRUE(parent.IsControlDirty());
+  for (const auto& control : controls)
+    EXPECT_TRUE(control->IsControlDirty());
+  EXPECT_FALSE(other.IsControlDirty());
+}
+
+TEST(TestGUIParallelProcessor, KeepOtherThreadsOut)
+{
+  CGraphicContext context;
+  CTestControl parent{CRect()};
+
+  std::atomic<int> processed{0};
+  std::atomic<int> otherLocked{0};
+  std::vector<std::unique_ptr<CTestControl>> controls;
+  for (int i = 0; i < 4; ++i)
+  {
+    auto control = std::make_unique<CTestControl>(CRect(i, 0, i + 1, 1));
+    control->m_process = [&](CTestControl& control, CDirtyRegionList& dirtyregions)
+    {
+      // the threads processing the controls can lock the context, other threads can't
+      std::unique_lock processingLock(context);
+      std::thread other(
+          [&context, &otherLocked]()
+          {
+            if (context.try_lock())
+            {
+              ++otherLocked;
+              context.unlock();
+            }
+          });
+      other.join();
+      ++processed;
+    };
+    controls.emplace_back(std::move(control));
+  }
+
+  std::unique_lock lock(context);
+  std::vector<CDirtyRegionList> regions;
+  CGUIParallelProcessor::Process(context, parent, Pointers(controls), 0, regions);
+
+  EXPECT_EQ(4, processed);
+  EXPECT_EQ(0, otherLocked);
+}
@@ -0,0 +1,133 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "guilib/GUIQuadBatch.h"
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+struct DrawCall
+{
+  CGUIQuadBatch::State state;
+  std::vector<CGUIQuadBatch::Vertex> vertices;
+  std::vector<uint16_t> indices;
+};
+
+class TestGUIQuadBatch : public ::testing::Test
+{
+protected:
+  TestGUIQuadBatch()
+    : m_batch([this](const CGUIQuadBatch::State& state,
+                     const std::vector<CGUIQuadBatch::Vertex>& vertices,
+                     const std::vector<uint16_t>& indices)
+              { m_drawCalls.push_back({state, vertices, indices}); })
+  {
+  }
+
+  static CGUIQuadBatch::State State(unsigned int texture)
+  {
+    CGUIQuadBatch::State state;
+    state.texture0 = texture;
+    state.color = 0xFFFFFFFF;
+    return state;
+  }
+
+  void Draw(unsigned int texture, float x, float y, float z = 0.0f)
+  {
+    m_batch.Begin(State(texture));
+    m_batch.AddQuad({{{x, y, z, 0, 0, 0, 0},
+                      {x + 10, y, z, 1, 0, 0, 0},
+                      {x + 10, y + 10, z, 1, 1, 0, 0},
+                      {x, y + 10, z, 0, 1, 0, 0}}});
+    m_batch.End();
+  }
+
+  std::vector<DrawCall> m_drawCalls;
+  CGUIQuadBatch m_batch;
+};
+} // namespace
+
+TEST_F(TestGUIQuadBatch, MergesSameState)
+{
+  Draw(1, 0, 0);
+  Draw(1, 20, 0);
+  Draw(1, 40, 0);
+  EXPECT_TRUE(m_drawCalls.empty());
+
+  m_batch.Flush();
+  ASSERT_EQ(1u, m_drawCalls.size());
+  EXPECT_EQ(12u, m_drawCalls[0].vertices.size());
+  EXPECT_EQ(18u, m_drawCalls[0].indices.size());
+  EXPECT_EQ(8, m_drawCalls[0].indices[12]);
+}
+
+TEST_F(TestGUIQuadBatch, MergesAcrossNonOverlapping)
+{
+  // 1 - 2 - 1 where the second quad of texture 1 doesn't overlap texture 2
+  Draw(1, 0, 0);
+  Draw(2, 20, 0);
+  Draw(1, 40, 0);
+  m_batch.Flush();
+
+  ASSERT_EQ(2u, m_drawCalls.size());
+  EXPECT_EQ(1u, m_drawCalls[0].state.texture0);
+  EXPECT_EQ(8u, m_drawCalls[0].vertices.size());
+  EXPECT_EQ(2u, m_drawCalls[1].state.texture0);
+}
+
+TEST_F(TestGUIQuadBatch, KeepsOrderOfOverlapping)
+{
+  Draw(1, 0, 0);
+  Draw(2, 5, 5);
+  Draw(1, 8, 8);
+  m_batch.Flush();
+
+  ASSERT_EQ(3u, m_drawCalls.size());
+  EXPECT_EQ(1u, m_drawCalls[0].state.texture0);
+  EXPECT_EQ(2u, m_drawCalls[1].state.texture0);
+  EXPECT_EQ(1u, m_drawCalls[2].state.texture0);
+}
+
+TEST_F(TestGUIQuadBatch, KeepsOrderOutsideOfPlane)
+{
+  Draw(1, 0, 0);
+  Draw(2, 20, 0, 5.0f);
+  Draw(1, 40, 0);
+  m_batch.Flush();
+
+  EXPECT_EQ(3u, m_drawCalls.size());
+}
+
+TEST_F(TestGUIQuadBatch, Disabled)
+{
+  m_batch.SetEnabled(false);
+  Draw(1, 0, 0);
+  Draw(1, 20, 0);
+
+  EXPECT_EQ(2u, m_drawCalls.size());
+}
+
+TEST_F(TestGUIQuadBatch, FrameStats)
+{
+  Draw(1, 0, 0);
+  Draw(2, 20, 0);
+  Draw(1, 40, 0);
+  m_batch.FrameEnd();
+
+  const CGUIQuadBatch::Stats& stats = m_batch.GetFrameStats();
+  EXPECT_EQ(2u, stats.drawCalls);
+  EXPECT_EQ(3u, stats.textures);
+  EXPECT_EQ(3u, stats.quads);
+  EXPECT_EQ(12u, stats.vertices);
+
+  m_batch.FrameEnd();
+  EXPECT_EQ(0u, m_batch.GetFrameStats().drawCalls);
+}
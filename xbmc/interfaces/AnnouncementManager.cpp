@@ -13,25 +13,30 @@
 #include "music/tags/MusicInfoTag.h"
 #include "playlists/PlayListTypes.h"
 #include "pvr/channels/PVRChannel.h"
-#include "threads/SingleLock.h"
+#include "utils/JSONVariantWriter.h"
 #include "utils/StringUtils.h"
 #include "utils/Variant.h"
 #include "utils/log.h"
 #include "video/VideoDatabase.h"
 #include "video/VideoFileItemClassify.h"
 
+#include <iterator>
 #include <memory>
 #include <mutex>
+#include <unordered_set>
 
 #define LOOKUP_PROPERTY "database-lookup"
 
 using namespace ANNOUNCEMENT;
 using namespace KODI;
+using namespace std::chrono_literals;
 
 const std::string CAnnouncementManager::ANNOUNCEMENT_SENDER = "xbmc";
 
 namespace
 {
+// how long to wait for more announcements which may replace the ones of a batch
+constexpr auto COALESCING_WINDOW = 50ms;
 
 void CopyPVRTagInfoToObject(const PVR::CPVRChannel& channel, bool copyPlayerId, CVariant& object)
 {
@@ -328,7 +333,7 @@ void CAnnouncementManager::Announce(AnnouncementFlag flag,
 
   {
     std::unique_lock lock(m_queueCritSection);
-    m_announcementQueue.push_back(announcement);
+    m_announcementQueue.push_back(std::move(announcement));
   }
   m_queueEvent.Set();
 }
@@ -366,27 +371,115 @@ void CAnnouncementManager::DoAnnounce(AnnouncementFlag flag,
     DoAnnounce(flag, sender, message, CreateDataObjectFromItem(*item, data));
 }
 
+std::string CAnnouncementManager::GetCoalescingKey(const CAnnounceData& announcement)
+{
+  if (announcement.item != nullptr)
+    return {};
+
+  std::string key = StringUtils::Format("{}|{}|{}", static_cast<int>(announcement.flag),
+                                        announcement.sender, announcement.message);
+
+  // only the latest volume is of interest
+  if (announcement.flag == Application && announcement.message == "OnVolumeChanged")
+    return key;
+
+  // the data only identifies the changed item, so a scan or bulk update announcing the same
+  // item several times produces identical announcements
+  if ((announcement.flag == VideoLibrary || announcement.flag == AudioLibrary) &&
+      (announcement.message == "OnUpdate" || announcement.message == "OnRemove"))
+  {
+    std::string data;
+    if (!CJSONVariantWriter::Write(announcement.data, data, true))
+      return {};
+
+    key += '|';
+    key += data;
+    return key;
+  }
+
+  return {};
+}
+
+size_t CAnnouncementManager::Coalesce(std::vector<CAnnounceData>& batch)
+{
+  // keep the latest announcement of every key at its position
+  std::unordered_set<std::string> keys;
+  std::vector<bool> superseded(batch.size(), false);
+  size_t dropped = 0;
+  for (size_t i = batch.size(); i-- > 0;)
+  {
+    std::string key = GetCoalescingKey(batch[i]);
+    if (!key.empty() && !keys.insert(std::move(key)).second)
+    {
+      superseded[i] = true;
+      ++dropped;
+    }
+  }
+
+  if (dropped == 0)
+    return 0;
+
+  size_t kept = 0;
+  for (size_t i = 0; i < batch.size(); ++i)
+  {
+    if (superseded[i])
+      continue;
+    if (kept != i)
+      batch[kept] = std::move(batch[i]);
+    ++kept;
+  }
+  batch.erase(batch.begin() + kept, batch.end());
+
+  return dropped;
+}
+
 void CAnnouncementManager::Process()
 {
   SetPriority(ThreadPriority::LOWEST);
 
+  std::vector<CAnnounceData> batch;
   while (!m_bStop)
   {
-    std::unique_lock lock(m_queueCritSection);
-    if (!m_announcementQueue.empty())
     {
-      auto announcement = m_announcementQueue.front();
-      m_announcementQueue.pop_front();
-      {
-        CSingleExit ex(m_queueCritSection);
-        DoAnnounce(announcement.flag, announcement.sender, announcement.message, announcement.item,
-                   announcement.data);
-      }
+      std::unique_lock lock(m_queueCritSection);
+      batch.swap(m_announcementQueue);
     }
-    else
+
+    if (batch.empty())
     {
-      CSingleExit ex(m_queueCritSection);
       m_queueEvent.Wait();
+      continue;
+    }
+
+    // a coalescable announcement usually comes in a burst (a library scan, a volume change), so
+    // give the burst some time to be coalesced into as few announcements as possible
+    if (!GetCoalescingKey(batch.back()).empty())
+    {
+      Sleep(COALESCING_WINDOW);
+
+      std::vector<CAnnounceData> more;
+      {
+        std::unique_lock lock(m_queueCritSection);
+        more.swap(m_announcementQueue);
+      }
+      batch.insert(batch.end(), std::make_move_iterator(more.begin()),
+                   std::make_move_iterator(more.end()));
     }
+
+    const size_t dropped = Coalesce(batch);
+    if (dropped > 0)
+      CLog::LogFC(LOGDEBUG, LOGANNOUNCE,
+                  "CAnnouncementManager - Coalesced {} of {} announcements", dropped,
+                  batch.size() + dropped);
+
+    for (const auto& announcement : batch)
+      DoAnnounce(announcement.flag, announcement.sender, announcement.message, announcement.item,
+                 announcement.data);
+    batch.clear();
+
+    std::unique_lock lock(m_announcersCritSection);
+    std::unordered_map<IAnnouncer*, int> announcers{m_announcers};
+    for (const auto& [announcer, flagMask] : announcers)
+      announcer->FlushAnnouncements();
   }
 }
@@ -14,9 +14,10 @@
 #include "threads/Thread.h"
 #include "utils/Variant.h"
 
-#include <list>
 #include <memory>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 class CFileItem;
 class CVariant;
@@ -82,7 +83,27 @@ namespace ANNOUNCEMENT
       std::shared_ptr<CFileItem> item;
       CVariant data;
     };
-    std::list<CAnnounceData> m_announcementQueue;
+
+    /*!
+     \brief Get the key under which announcements replace each other within a batch.
+
+     Announcements with the same key are either identical or only the latest one is of interest
+     (e.g. the volume). Announcements about an item aren't coalesced as their data is only known
+     once it has been looked up while dispatching.
+     \return the key, or an empty string if the announcement must not be coalesced.
+     */
+    static std::string GetCoalescingKey(const CAnnounceData& announcement);
+    /*!
+     \brief Drop the announcements of a batch that are superseded by later ones with the same key.
+     \return the number of dropped announcements.
+     */
+    static size_t Coalesce(std::vector<CAnnounceData>& batch);
+
+    /*!
+     \brief The announcements that haven't been dispatched yet. The thread swaps the whole queue
+     out under the lock and dispatches the batch without holding it.
+     */
+    std::vector<CAnnounceData> m_announcementQueue;
     CEvent m_queueEvent;
 
   private:
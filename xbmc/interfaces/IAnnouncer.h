@@ -80,5 +80,12 @@ inline const char* AnnouncementFlagToString(const AnnouncementFlag& notification
                           const std::string& sender,
                           const std::string& message,
                           const CVariant& data) = 0;
+
+    /*!
+     \brief Called after a batch of announcements has been passed to Announce().
+
+     Announcers which buffer announcements to send them together have to send them now.
+     */
+    virtual void FlushAnnouncements() {}
   };
 }
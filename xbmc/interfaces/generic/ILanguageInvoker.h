@@ -46,6 +46,8 @@ public:
   bool IsActive() const;
   bool IsRunning() const;
   void Reset() { m_state = InvokerStateUninitialized; }
+  void SetReuseable(bool reuseable) { m_reuseable = reuseable; }
+  bool IsReuseable() const { return m_reuseable; }
 
 protected:
   friend class CLanguageInvokerThread;
@@ -71,5 +73,6 @@ protected:
 private:
   int m_id = -1;
   InvokerState m_state = InvokerStateUninitialized;
+  bool m_reuseable = false;
   ILanguageInvocationHandler *m_invocationHandler;
 };
@@ -10,6 +10,7 @@
 
 #include "ScriptInvocationManager.h"
 
+#include <chrono>
 #include <utility>
 
 CLanguageInvokerThread::CLanguageInvokerThread(std::shared_ptr<ILanguageInvoker> invoker,
@@ -91,6 +92,7 @@ void CLanguageInvokerThread::OnStartup()
     return;
 
   m_invoker->SetId(GetId());
+  m_invoker->SetReuseable(m_reusable);
   if (m_addon != NULL)
     m_invoker->SetAddon(m_addon);
 }
@@ -101,10 +103,18 @@ void CLanguageInvokerThread::Process()
     return;
 
   std::unique_lock<std::mutex> lckdl(m_mutex);
+  bool warmStart = false;
   do
   {
     m_restart = false;
+    const auto start = std::chrono::steady_clock::now();
     m_invoker->Execute(m_script, m_args);
+    m_invocationManager->OnInvocationDone(
+        m_script,
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() -
+                                                              start),
+        warmStart);
+    warmStart = true;
 
     if (m_invoker->GetState() != InvokerStateScriptDone)
       m_reusable = false;
@@ -41,7 +41,8 @@ protected:
 
     // reuse an existing script handle or get a new one if necessary
     int handle = CScriptInvocationManager::GetInstance().GetReusablePluginHandle(addon->LibPath());
-    if (handle < 0)
+    const bool reserved = handle >= 0;
+    if (!reserved)
       handle = GetNewScriptHandle(script);
     else
       ReuseScriptHandle(handle, script);
@@ -49,6 +50,10 @@ protected:
     // run the script
     auto result = CScriptRunner::RunScript(addon, path, handle, resume);
 
+    // give back a reserved invoker if the script never got to use it
+    if (!result && reserved)
+      CScriptInvocationManager::GetInstance().ReleasePluginHandle(handle);
+
     // remove the script handle if necessary
     RemoveScriptHandle(handle);
 
@@ -17,6 +17,7 @@
 #include "utils/XTimeUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
 #include <cerrno>
 #include <memory>
 #include <mutex>
@@ -50,10 +51,21 @@ void CScriptInvocationManager::Process()
       ++it;
   }
 
-  // remove the finished scripts from the script path map as well
+  // remove the finished scripts from the script path map and the invoker pools as well
   for (const auto& it : tempList)
+  {
     m_scriptPaths.erase(it.script);
 
+    auto pool = m_invokerPools.find(it.script);
+    if (pool != m_invokerPools.end())
+    {
+      std::erase_if(pool->second.threads, [&it](const PooledInvokerThread& pooled)
+                    { return pooled.thread == it.thread; });
+      if (pool->second.threads.empty())
+        m_invokerPools.erase(pool);
+    }
+  }
+
   // we can leave the lock now
   lock.unlock();
 
@@ -73,8 +85,9 @@ void CScriptInvocationManager::Uninitialize()
   // execute Process() once more to handle the remaining scripts
   Process();
 
-  // it is safe to release early, thread must be in m_scripts too
-  m_lastInvokerThread = nullptr;
+  // it is safe to release early, pooled threads must be in m_scripts too
+  m_invokerPools.clear();
+  m_reservedInvokerThreads.clear();
 
   // make sure all scripts are done
   std::vector<LanguageInvokerThread> tempList;
@@ -180,14 +193,18 @@ int CScriptInvocationManager::GetReusablePluginHandle(const std::string& script)
 {
   std::unique_lock lock(m_critSection);
 
-  if (m_lastInvokerThread)
-  {
-    if (m_lastInvokerThread->Reuseable(script))
-      return m_lastPluginHandle;
-    m_lastInvokerThread->Release();
-    m_lastInvokerThread = nullptr;
-  }
-  return -1;
+  releaseUnpooledInvokerThreads(script);
+
+  int pluginHandle = -1;
+  CLanguageInvokerThreadPtr invokerThread = getIdleInvokerThread(script, &pluginHandle);
+  if (!invokerThread || pluginHandle < 0)
+    return -1;
+
+  // mark the invoker as busy so that it isn't handed out twice
+  invokerThread->GetInvoker()->Reset();
+  m_reservedInvokerThreads[pluginHandle] = invokerThread;
+
+  return pluginHandle;
 }
 
 std::shared_ptr<ILanguageInvoker> CScriptInvocationManager::GetLanguageInvoker(
@@ -195,17 +212,15 @@ std::shared_ptr<ILanguageInvoker> CScriptInvocationManager::GetLanguageInvoker(
 {
   std::unique_lock lock(m_critSection);
 
-  if (m_lastInvokerThread)
+  releaseUnpooledInvokerThreads(script);
+
+  CLanguageInvokerThreadPtr invokerThread = getIdleInvokerThread(script);
+  if (invokerThread)
   {
-    if (m_lastInvokerThread->Reuseable(script))
-    {
-      CLog::Log(LOGDEBUG, "{} - Reusing LanguageInvokerThread {} for script {}", __FUNCTION__,
-                m_lastInvokerThread->GetId(), script);
-      m_lastInvokerThread->GetInvoker()->Reset();
-      return m_lastInvokerThread->GetInvoker();
-    }
-    m_lastInvokerThread->Release();
-    m_lastInvokerThread = nullptr;
+    CLog::Log(LOGDEBUG, "{} - Reusing LanguageInvokerThread {} for script {}", __FUNCTION__,
+              invokerThread->GetId(), script);
+    invokerThread->GetInvoker()->Reset();
+    return invokerThread->GetInvoker();
   }
 
   std::string extension = URIUtils::GetExtension(script);
@@ -218,6 +233,23 @@ std::shared_ptr<ILanguageInvoker> CScriptInvocationManager::GetLanguageInvoker(
   return {};
 }
 
+void CScriptInvocationManager::ReleasePluginHandle(int pluginHandle)
+{
+  std::unique_lock lock(m_critSection);
+  auto reserved = m_reservedInvokerThreads.find(pluginHandle);
+  if (reserved == m_reservedInvokerThreads.end())
+    return;
+
+  // the invoker was marked as busy when it was reserved so it can't be handed out again
+  CLanguageInvokerThreadPtr invokerThread = reserved->second;
+  m_reservedInvokerThreads.erase(reserved);
+  lock.unlock();
+
+  CLog::Log(LOGDEBUG, "{} - Releasing unused LanguageInvokerThread {} of plugin handle {}",
+            __FUNCTION__, invokerThread->GetId(), pluginHandle);
+  invokerThread->Release();
+}
+
 int CScriptInvocationManager::ExecuteAsync(
     const std::string& script,
     const ADDON::AddonPtr& addon /* = ADDON::AddonPtr() */,
@@ -225,17 +257,34 @@ int CScriptInvocationManager::ExecuteAsync(
     bool reuseable /* = false */,
     int pluginHandle /* = -1 */)
 {
-  if (script.empty())
-    return -1;
-
-  if (!CFileUtils::Exists(script, false))
+  if (script.empty() || !CFileUtils::Exists(script, false))
   {
     CLog::Log(LOGERROR, "{} - Not executing non-existing script {}", __FUNCTION__, script);
+    ReleasePluginHandle(pluginHandle);
     return -1;
   }
 
-  auto invoker = GetLanguageInvoker(script);
-  return ExecuteAsync(script, invoker, addon, arguments, reuseable, pluginHandle);
+  CLanguageInvokerThreadPtr reservedThread;
+  std::shared_ptr<ILanguageInvoker> invoker;
+  {
+    // pick up the invoker reserved through GetReusablePluginHandle()
+    std::unique_lock lock(m_critSection);
+    auto reserved = m_reservedInvokerThreads.find(pluginHandle);
+    if (reserved != m_reservedInvokerThreads.end())
+    {
+      reservedThread = reserved->second;
+      invoker = reservedThread->GetInvoker();
+      m_reservedInvokerThreads.erase(reserved);
+    }
+  }
+
+  if (!invoker)
+    invoker = GetLanguageInvoker(script);
+
+  int scriptId = ExecuteAsync(script, invoker, addon, arguments, reuseable, pluginHandle);
+  if (scriptId < 0 && reservedThread)
+    reservedThread->Release();
+  return scriptId;
 }
 
 int CScriptInvocationManager::ExecuteAsync(
@@ -257,34 +306,43 @@ int CScriptInvocationManager::ExecuteAsync(
 
   std::unique_lock lock(m_critSection);
 
-  if (m_lastInvokerThread && m_lastInvokerThread->GetInvoker() == languageInvoker)
+  InvokerPool& pool = m_invokerPools[script];
+  for (const auto& pooled : pool.threads)
   {
+    if (pooled.thread->GetInvoker() != languageInvoker)
+      continue;
+
     if (addon != NULL)
-      m_lastInvokerThread->SetAddon(addon);
+      pooled.thread->SetAddon(addon);
 
-    // After we leave the lock, m_lastInvokerThread can be released -> copy!
-    CLanguageInvokerThreadPtr invokerThread = m_lastInvokerThread;
+    // After we leave the lock, the pooled thread can be released -> copy!
+    CLanguageInvokerThreadPtr invokerThread = pooled.thread;
     lock.unlock();
     invokerThread->Execute(script, arguments);
 
     return invokerThread->GetId();
   }
 
-  m_lastInvokerThread = std::make_shared<CLanguageInvokerThread>(languageInvoker, this, reuseable);
-  if (m_lastInvokerThread == NULL)
-    return -1;
+  // only keep as many interpreters alive as the add-on asked for
+  if (reuseable)
+  {
+    pool.size = getInvokerPoolSize(addon);
+    reuseable = pool.threads.size() < pool.size;
+  }
 
+  auto invokerThread = std::make_shared<CLanguageInvokerThread>(languageInvoker, this, reuseable);
   if (addon != NULL)
-    m_lastInvokerThread->SetAddon(addon);
+    invokerThread->SetAddon(addon);
 
-  m_lastInvokerThread->SetId(m_nextId++);
-  m_lastPluginHandle = pluginHandle;
+  invokerThread->SetId(m_nextId++);
+  if (reuseable)
+    pool.threads.push_back({invokerThread, pluginHandle});
+  else if (pool.threads.empty())
+    m_invokerPools.erase(script);
 
-  LanguageInvokerThread thread = {m_lastInvokerThread, script, false};
-  m_scripts.insert(std::make_pair(m_lastInvokerThread->GetId(), thread));
-  m_scriptPaths.insert(std::make_pair(script, m_lastInvokerThread->GetId()));
-  // After we leave the lock, m_lastInvokerThread can be released -> copy!
-  CLanguageInvokerThreadPtr invokerThread = m_lastInvokerThread;
+  LanguageInvokerThread thread = {invokerThread, script, false};
+  m_scripts.insert(std::make_pair(invokerThread->GetId(), thread));
+  m_scriptPaths.insert(std::make_pair(script, invokerThread->GetId()));
   lock.unlock();
   invokerThread->Execute(script, arguments);
 
@@ -411,6 +469,25 @@ void CScriptInvocationManager::OnExecutionDone(int scriptId)
     script->second.done = true;
 }
 
+void CScriptInvocationManager::OnInvocationDone(const std::string& script,
+                                                std::chrono::milliseconds duration,
+                                                bool warmStart)
+{
+  std::unique_lock lock(m_critSection);
+  InvocationStats& stats = m_invocationStats[script];
+  stats.invocations++;
+  if (warmStart)
+    stats.warmInvocations++;
+  stats.maxDuration = std::max(stats.maxDuration, duration);
+  stats.totalDuration += duration;
+
+  CLog::Log(LOGDEBUG,
+            "{} - script {} took {}ms ({} start), average {}ms, max {}ms, {}/{} warm invocations",
+            __FUNCTION__, script, duration.count(), warmStart ? "warm" : "cold",
+            stats.totalDuration.count() / static_cast<int64_t>(stats.invocations),
+            stats.maxDuration.count(), stats.warmInvocations, stats.invocations);
+}
+
 CScriptInvocationManager::LanguageInvokerThread CScriptInvocationManager::getInvokerThread(int scriptId) const
 {
   if (scriptId < 0)
@@ -422,3 +499,54 @@ CScriptInvocationManager::LanguageInvokerThread CScriptInvocationManager::getInv
 
   return script->second;
 }
+
+CLanguageInvokerThreadPtr CScriptInvocationManager::getIdleInvokerThread(
+    const std::string& script, int* pluginHandle /* = nullptr */) const
+{
+  auto pool = m_invokerPools.find(script);
+  if (pool == m_invokerPools.end())
+    return {};
+
+  for (const auto& pooled : pool->second.threads)
+  {
+    if (pooled.thread->Reuseable(script))
+    {
+      if (pluginHandle)
+        *pluginHandle = pooled.pluginHandle;
+      return pooled.thread;
+    }
+  }
+
+  return {};
+}
+
+void CScriptInvocationManager::releaseUnpooledInvokerThreads(const std::string& script)
+{
+  // add-ons which didn't opt into a pool of interpreters keep the previous
+  // behaviour of only staying alive until another script is invoked
+  for (auto it = m_invokerPools.begin(); it != m_invokerPools.end();)
+  {
+    if (it->first != script && it->second.size <= 1)
+    {
+      for (const auto& pooled : it->second.threads)
+        pooled.thread->Release();
+      it = m_invokerPools.erase(it);
+    }
+    else
+      ++it;
+  }
+}
+
+unsigned int CScriptInvocationManager::getInvokerPoolSize(const ADDON::AddonPtr& addon)
+{
+  static constexpr unsigned int MAX_INVOKER_POOL_SIZE = 8;
+
+  if (!addon)
+    return 1;
+
+  const auto poolSize = addon->ExtraInfo().find("languageinvokerpool");
+  if (poolSize == addon->ExtraInfo().end())
+    return 1;
+
+  return std::clamp(StringUtils::ToUint32(poolSize->second, 1), 1U, MAX_INVOKER_POOL_SIZE);
+}
@@ -12,6 +12,7 @@
 #include "interfaces/generic/ILanguageInvoker.h"
 #include "threads/CriticalSection.h"
 
+#include <chrono>
 #include <map>
 #include <memory>
 #include <set>
@@ -35,10 +36,21 @@ public:
   std::shared_ptr<ILanguageInvoker> GetLanguageInvoker(const std::string& script);
 
   /*!
-  * \brief Returns addon_handle if last reusable invoker is ready to use.
+  * \brief Returns addon_handle if a pooled reusable invoker is ready to use.
+  *
+  * \details The idle invoker is reserved for the returned handle until the
+  * script is executed through ExecuteAsync() with the same plugin handle.
   */
   int GetReusablePluginHandle(const std::string& script);
 
+  /*!
+  * \brief Releases the invoker reserved for the given plugin handle.
+  *
+  * \details Does nothing if the reservation was taken by ExecuteAsync(),
+  * otherwise the reserved invoker is stopped as it was already handed out.
+  */
+  void ReleasePluginHandle(int pluginHandle);
+
   /*!
    * \brief Executes the given script asynchronously in a separate thread.
    *
@@ -128,6 +140,9 @@ protected:
   friend class CLanguageInvokerThread;
 
   void OnExecutionDone(int scriptId);
+  void OnInvocationDone(const std::string& script,
+                        std::chrono::milliseconds duration,
+                        bool warmStart);
 
 private:
   CScriptInvocationManager() = default;
@@ -143,12 +158,35 @@ private:
   typedef std::map<int, LanguageInvokerThread> LanguageInvokerThreadMap;
   typedef std::map<std::string, ILanguageInvocationHandler*> LanguageInvocationHandlerMap;
 
+  typedef struct {
+    CLanguageInvokerThreadPtr thread;
+    int pluginHandle;
+  } PooledInvokerThread;
+  typedef struct {
+    unsigned int size = 1;
+    std::vector<PooledInvokerThread> threads;
+  } InvokerPool;
+  typedef std::map<std::string, InvokerPool> InvokerPoolMap;
+
+  struct InvocationStats
+  {
+    uint64_t invocations = 0;
+    uint64_t warmInvocations = 0;
+    std::chrono::milliseconds maxDuration{0};
+    std::chrono::milliseconds totalDuration{0};
+  };
+
   LanguageInvokerThread getInvokerThread(int scriptId) const;
+  CLanguageInvokerThreadPtr getIdleInvokerThread(const std::string& script,
+                                                 int* pluginHandle = nullptr) const;
+  void releaseUnpooledInvokerThreads(const std::string& script);
+  static unsigned int getInvokerPoolSize(const ADDON::AddonPtr& addon);
 
   LanguageInvocationHandlerMap m_invocationHandlers;
   LanguageInvokerThreadMap m_scripts;
-  CLanguageInvokerThreadPtr m_lastInvokerThread;
-  int m_lastPluginHandle = -1;
+  InvokerPoolMap m_invokerPools;
+  std::map<int, CLanguageInvokerThreadPtr> m_reservedInvokerThreads;
+  std::map<std::string, InvocationStats> m_invocationStats;
 
   std::map<std::string, int> m_scriptPaths;
   int m_nextId = 0;
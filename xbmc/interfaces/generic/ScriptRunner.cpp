@@ -81,6 +81,10 @@ int CScriptRunner::ExecuteScript(const ADDON::AddonPtr& addon,
   if (reuseLanguageInvokerIt != addon->ExtraInfo().end())
     reuseLanguageInvoker = reuseLanguageInvokerIt->second == "true";
 
+  // a pool of interpreters implies reusing them
+  if (addon->ExtraInfo().contains("languageinvokerpool"))
+    reuseLanguageInvoker = true;
+
   // run the script
   CLog::Log(LOGDEBUG, "CScriptRunner: running add-on script {:s}('{:s}', '{:s}', '{:s}')",
             addon->Name(), argv[0], argv[1], argv[2]);
@@ -0,0 +1,167 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "filesystem/File.h"
+#include "interfaces/generic/ILanguageInvocationHandler.h"
+#include "interfaces/generic/ILanguageInvoker.h"
+#include "interfaces/generic/ScriptInvocationManager.h"
+#include "test/TestUtils.h"
+#include "utils/XTimeUtils.h"
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+constexpr int PLUGIN_HANDLE = 7;
+
+class CTestInvoker : public ILanguageInvoker
+{
+public:
+  explicit CTestInvoker(ILanguageInvocationHandler* handler) : ILanguageInvoker(handler) {}
+
+  std::atomic<int> m_executions{0};
+
+protected:
+  bool execute(const std::string& script, const std::vector<std::string>& arguments) override
+  {
+    setState(InvokerStateRunning);
+    ++m_executions;
+    setState(InvokerStateScriptDone);
+    return true;
+  }
+  bool stop(bool abort) override { return true; }
+};
+
+class CTestInvocationHandler : public ILanguageInvocationHandler
+{
+public:
+  ILanguageInvoker* CreateInvoker() override
+  {
+    auto invoker = new CTestInvoker(this);
+    m_invokers.push_back(invoker);
+    return invoker;
+  }
+
+  std::vector<CTestInvoker*> m_invokers;
+};
+
+bool WaitFor(const std::function<bool()>& condition)
+{
+  for (int i = 0; i < 500; ++i)
+  {
+    if (condition())
+      return true;
+    KODI::TIME::Sleep(10ms);
+  }
+  return false;
+}
+} // unnamed namespace
+
+class TestScriptInvocationManager : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    m_manager.RegisterLanguageInvocationHandler(&m_handler, ".testscript");
+    m_file = XBMC_CREATETEMPFILE(".testscript");
+    ASSERT_NE(nullptr, m_file);
+    m_script = XBMC_TEMPFILEPATH(m_file);
+  }
+
+  void TearDown() override
+  {
+    m_manager.ReleasePluginHandle(PLUGIN_HANDLE);
+    for (int scriptId : m_scriptIds)
+      m_manager.Stop(scriptId, true);
+    m_manager.Process();
+    m_manager.UnregisterLanguageInvocationHandler(&m_handler);
+    XBMC_DELETETEMPFILE(m_file);
+  }
+
+  int Execute(const std::string& script)
+  {
+    int scriptId = m_manager.ExecuteAsync(script, ADDON::AddonPtr(), {}, true, PLUGIN_HANDLE);
+    if (scriptId >= 0)
+      m_scriptIds.push_back(scriptId);
+    return scriptId;
+  }
+
+  bool WaitForIdle(const CTestInvoker* invoker, int executions)
+  {
+    return WaitFor([invoker, executions]() {
+      return invoker->m_executions == executions &&
+             invoker->GetState() == InvokerStateScriptDone;
+    });
+  }
+
+  CScriptInvocationManager& m_manager{CScriptInvocationManager::GetInstance()};
+  CTestInvocationHandler m_handler;
+  XFILE::CFile* m_file{nullptr};
+  std::string m_script;
+  std::vector<int> m_scriptIds;
+};
+
+TEST_F(TestScriptInvocationManager, ReuseReservedInvoker)
+{
+  const int scriptId = Execute(m_script);
+  ASSERT_GE(scriptId, 0);
+  ASSERT_EQ(1u, m_handler.m_invokers.size());
+  ASSERT_TRUE(WaitForIdle(m_handler.m_invokers.front(), 1));
+
+  EXPECT_EQ(PLUGIN_HANDLE, m_manager.GetReusablePluginHandle(m_script));
+  // a reserved invoker isn't handed out twice
+  EXPECT_EQ(-1, m_manager.GetReusablePluginHandle(m_script));
+
+  // the reservation is picked up by the plugin handle and runs on the same interpreter
+  EXPECT_EQ(scriptId, Execute(m_script));
+  EXPECT_TRUE(WaitForIdle(m_handler.m_invokers.front(), 2));
+  EXPECT_EQ(1u, m_handler.m_invokers.size());
+  EXPECT_EQ(PLUGIN_HANDLE, m_manager.GetReusablePluginHandle(m_script));
+}
+
+TEST_F(TestScriptInvocationManager, ReleaseUnusedReservation)
+{
+  const int scriptId = Execute(m_script);
+  ASSERT_GE(scriptId, 0);
+  ASSERT_TRUE(WaitForIdle(m_handler.m_invokers.front(), 1));
+  ASSERT_EQ(PLUGIN_HANDLE, m_manager.GetReusablePluginHandle(m_script));
+
+  // the reserved interpreter is stopped instead of leaking
+  m_manager.ReleasePluginHandle(PLUGIN_HANDLE);
+  EXPECT_TRUE(WaitFor([&]() { return !m_manager.IsRunning(scriptId); }));
+  m_manager.Process();
+  EXPECT_EQ(-1, m_manager.GetReusablePluginHandle(m_script));
+
+  // releasing again is harmless
+  m_manager.ReleasePluginHandle(PLUGIN_HANDLE);
+}
+
+TEST_F(TestScriptInvocationManager, ReleaseReservationOnFailure)
+{
+  const int scriptId = Execute(m_script);
+  ASSERT_GE(scriptId, 0);
+  ASSERT_TRUE(WaitForIdle(m_handler.m_invokers.front(), 1));
+  ASSERT_EQ(PLUGIN_HANDLE, m_manager.GetReusablePluginHandle(m_script));
+
+  EXPECT_EQ(-1, Execute(m_script + ".missing"));
+  EXPECT_TRUE(WaitFor([&]() { return !m_manager.IsRunning(scriptId); }));
+  m_manager.Process();
+
+  // the next invocation starts a new interpreter
+  EXPECT_EQ(-1, m_manager.GetReusablePluginHandle(m_script));
+  EXPECT_GE(Execute(m_script), 0);
+  EXPECT_EQ(2u, m_handler.m_invokers.size());
+}
@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include "guilib/GUIParallelProcessor.h"
+
 #include <memory>
 #include <string>
 
@@ -29,12 +31,14 @@ public:
   virtual void Initialize(CGUIInfoManager* infoMgr) { m_infoMgr = infoMgr; }
 
   /*! \brief Get the value of this info bool
-   This is called to update (if dirty) and fetch the value of the info bool
+   This is called to update (if dirty) and fetch the value of the info bool. Controls may be
+   processed in parallel, so the update is serialized with the info providers.
    \param contextWindow the context (window id) where this condition is being evaluated
    \param item the item used to evaluate the bool
    */
   inline bool Get(int contextWindow, const CGUIListItem* item = nullptr)
   {
+    CGUIParallelProcessor::CSerialSection serial;
     if (item && m_listItemDependent)
       Update(contextWindow, item);
     else if (m_refreshCounter != m_parentRefreshCounter || m_refreshCounter == 0)
@@ -15,6 +15,7 @@
 #include "Util.h"
 #include "VideoLibrary.h"
 #include "addons/kodi-dev-kit/include/kodi/c-api/addon-instance/pvr/pvr_epg.h" // EPG_TAG_INVALID_UID
+#include "dbwrappers/Database.h"
 #include "filesystem/Directory.h"
 #include "imagefiles/ImageFileURL.h"
 #include "music/MusicThumbLoader.h"
@@ -555,3 +556,43 @@ void CFileItemHandler::Sort(CFileItemList &items, const CVariant &parameterObjec
 
   items.Sort(sorting);
 }
+
+void CFileItemHandler::HandleJournalChanges(CDatabase& database,
+                                            const CVariant& parameterObject,
+                                            CVariant& result)
+{
+  std::vector<CDatabase::JournalChange> changes;
+  int64_t cursor;
+  bool more;
+  const bool known = database.GetJournalChanges(
+      parameterObject["cursor"].asInteger(),
+      static_cast<unsigned int>(parameterObject["limit"].asUnsignedInteger()), changes, cursor,
+      more);
+
+  result["changes"] = CVariant(CVariant::VariantTypeArray);
+  result["changes"].reserve(changes.size());
+  for (const auto& change : changes)
+  {
+    CVariant object(CVariant::VariantTypeObject);
+    object["type"] = change.mediaType;
+    object["id"] = change.id;
+    switch (change.action)
+    {
+      case CDatabase::JournalChange::Action::ADDED:
+        object["action"] = "added";
+        break;
+      case CDatabase::JournalChange::Action::REMOVED:
+        object["action"] = "removed";
+        break;
+      default:
+        object["action"] = "updated";
+        break;
+    }
+    result["changes"].push_back(std::move(object));
+  }
+
+  // the client has to retrieve everything, the changes made meanwhile follow the current cursor
+  result["cursor"] = known ? cursor : database.GetJournalCursor();
+  result["more"] = more;
+  result["resync"] = !known;
+}
@@ -14,6 +14,7 @@
 #include <memory>
 #include <set>
 
+class CDatabase;
 class CFileItem;
 class CFileItemList;
 class CThumbLoader;
@@ -52,6 +53,12 @@ namespace JSONRPC
                                CThumbLoader* thumbLoader = nullptr);
 
     static bool FillFileItemList(const CVariant &parameterObject, CFileItemList &list);
+
+    /*!
+     \brief Fill the result of the *Library.GetChanges methods from the change journal of the
+     given (open) database.
+     */
+    static void HandleJournalChanges(CDatabase& database, const CVariant& parameterObject, CVariant& result);
   private:
     static void Sort(CFileItemList &items, const CVariant& parameterObject);
     static bool GetField(const std::string& field,
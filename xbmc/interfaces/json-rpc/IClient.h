@@ -10,6 +10,8 @@
 
 namespace JSONRPC
 {
+  class CPropertySubscription;
+
   class IClient
   {
   public:
@@ -17,5 +19,14 @@ namespace JSONRPC
     virtual int GetPermissionFlags() = 0;
     virtual int GetAnnouncementFlags() = 0;
     virtual bool SetAnnouncementFlags(int flags) = 0;
+
+    /*!
+     \brief Replaces the property subscription of the client (see JSONRPC.Subscribe)
+     \return False if the client can't be notified about property changes
+     */
+    virtual bool SetPropertySubscription(const CPropertySubscription& subscription)
+    {
+      return false;
+    }
   };
 }
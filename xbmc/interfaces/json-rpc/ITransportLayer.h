@@ -31,5 +31,12 @@ namespace JSONRPC
     virtual bool PrepareDownload(const char *path, CVariant &details, std::string &protocol) = 0;
     virtual bool Download(const char *path, CVariant &result) = 0;
     virtual int GetCapabilities() = 0;
+
+    /*!
+     \brief Whether requests coming through this transport layer are trusted
+     enough to skip the expensive parts of the parameter validation
+     (like checking "enum" values)
+     */
+    virtual bool UseLightValidation() { return false; }
   };
 }
@@ -10,6 +10,7 @@
 
 #include "FileItem.h"
 #include "GUIUserMessages.h"
+#include "PropertySubscription.h"
 #include "ServiceBroker.h"
 #include "ServiceDescription.h"
 #include "TextureDatabase.h"
@@ -31,6 +32,7 @@
 #include "utils/Variant.h"
 #include "utils/log.h"
 
+#include <chrono>
 #include <string.h>
 
 using namespace KODI;
@@ -239,9 +241,49 @@ JSONRPC_STATUS CJSONRPC::NotifyAll(const std::string &method, ITransportLayer *t
   return ACK;
 }
 
+JSONRPC_STATUS CJSONRPC::Subscribe(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant& parameterObject, CVariant &result)
+{
+  CPropertySubscription subscription;
+  subscription.Set(parameterObject);
+
+  // Send the current values back so that only changes have to be notified
+  CVariant values;
+  CPropertySubscription::GetValues(subscription, transport, client, values);
+
+  CVariant changes;
+  subscription.Update(values, std::chrono::steady_clock::now(), changes);
+
+  if (!client->SetPropertySubscription(subscription))
+    return FailedToExecute;
+
+  result = subscription.GetLastValues();
+  return OK;
+}
+
+JSONRPC_STATUS CJSONRPC::Unsubscribe(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant& parameterObject, CVariant &result)
+{
+  if (!client->SetPropertySubscription(CPropertySubscription()))
+    return FailedToExecute;
+
+  return ACK;
+}
+
 std::string CJSONRPC::MethodCall(const std::string &inputString, ITransportLayer *transport, IClient *client)
 {
-  CVariant inputroot, outputroot, result;
+  CVariant outputroot;
+  std::string str;
+  if (MethodCall(inputString, transport, client, outputroot))
+    CJSONVariantWriter::Write(outputroot, str, CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_jsonOutputCompact);
+
+  return str;
+}
+
+bool CJSONRPC::MethodCall(const std::string& inputString,
+                          ITransportLayer* transport,
+                          IClient* client,
+                          CVariant& outputroot)
+{
+  CVariant inputroot;
   bool hasResponse = false;
 
   CLog::Log(LOGDEBUG, LOGJSONRPC, "JSONRPC: Incoming request: {}", inputString);
@@ -280,11 +322,7 @@ std::string CJSONRPC::MethodCall(const std::string &inputString, ITransportLayer
     hasResponse = true;
   }
 
-  std::string str;
-  if (hasResponse)
-    CJSONVariantWriter::Write(outputroot, str, CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_jsonOutputCompact);
-
-  return str;
+  return hasResponse;
 }
 
 bool CJSONRPC::HandleMethodCall(const CVariant& request, CVariant& response, ITransportLayer *transport, IClient *client)
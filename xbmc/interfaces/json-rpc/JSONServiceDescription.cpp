@@ -20,6 +20,7 @@
 #include "PlayerOperations.h"
 #include "PlaylistOperations.h"
 #include "ProfilesOperations.h"
+#include "ServiceBroker.h"
 #include "ServiceDescription.h"
 #include "SettingsOperations.h"
 #include "SystemOperations.h"
@@ -30,7 +31,9 @@
 #include "utils/StringUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
 #include <memory>
+#include <mutex>
 
 using namespace JSONRPC;
 
@@ -38,6 +41,8 @@ std::map<std::string, CVariant> CJSONServiceDescription::m_notifications = std::
 CJSONServiceDescription::CJsonRpcMethodMap CJSONServiceDescription::m_actionMap;
 std::map<std::string, JSONSchemaTypeDefinitionPtr> CJSONServiceDescription::m_types = std::map<std::string, JSONSchemaTypeDefinitionPtr>();
 CJSONServiceDescription::IncompleteSchemaDefinitionMap CJSONServiceDescription::m_incompleteDefinitions = CJSONServiceDescription::IncompleteSchemaDefinitionMap();
+std::map<std::string, CJSONServiceDescription::ValidationStats> CJSONServiceDescription::m_validationStats;
+CCriticalSection CJSONServiceDescription::m_validationStatsSection;
 
 // clang-format off
 
@@ -50,6 +55,8 @@ JsonRpcMethodMap CJSONServiceDescription::m_methodMaps[] = {
   { "JSONRPC.GetConfiguration",                     CJSONRPC::GetConfiguration },
   { "JSONRPC.SetConfiguration",                     CJSONRPC::SetConfiguration },
   { "JSONRPC.NotifyAll",                            CJSONRPC::NotifyAll },
+  { "JSONRPC.Subscribe",                            CJSONRPC::Subscribe },
+  { "JSONRPC.Unsubscribe",                          CJSONRPC::Unsubscribe },
 
 // Player
   { "Player.GetActivePlayers",                      CPlayerOperations::GetActivePlayers },
@@ -114,6 +121,7 @@ JsonRpcMethodMap CJSONServiceDescription::m_methodMaps[] = {
   { "AudioLibrary.GetGenres",                       CAudioLibrary::GetGenres },
   { "AudioLibrary.GetRoles",                        CAudioLibrary::GetRoles },
   { "AudioLibrary.GetSources",                      CAudioLibrary::GetSources },
+  { "AudioLibrary.GetChanges",                      CAudioLibrary::GetChanges },
   { "AudioLibrary.GetAvailableArtTypes",            CAudioLibrary::GetAvailableArtTypes },
   { "AudioLibrary.GetAvailableArt",                 CAudioLibrary::GetAvailableArt },
   { "AudioLibrary.SetArtistDetails",                CAudioLibrary::SetArtistDetails },
@@ -128,6 +136,7 @@ JsonRpcMethodMap CJSONServiceDescription::m_methodMaps[] = {
 // Video Library
   { "VideoLibrary.GetGenres",                       CVideoLibrary::GetGenres },
   { "VideoLibrary.GetTags",                         CVideoLibrary::GetTags },
+  { "VideoLibrary.GetChanges",                      CVideoLibrary::GetChanges },
   { "VideoLibrary.GetAvailableArtTypes",            CVideoLibrary::GetAvailableArtTypes },
   { "VideoLibrary.GetAvailableArt",                 CVideoLibrary::GetAvailableArt },
   { "VideoLibrary.GetMovies",                       CVideoLibrary::GetMovies },
@@ -612,6 +621,16 @@ bool JSONSchemaTypeDefinition::Parse(const CVariant &value, bool isParameter /*
       if (approved)
         enums.push_back(*enumItr);
     }
+
+    // Index the enum values if they are all strings
+    // so that values can be looked up by name
+    stringEnums.clear();
+    if (std::all_of(enums.begin(), enums.end(),
+                    [](const CVariant& enumValue) { return enumValue.isString(); }))
+    {
+      for (const auto& enumValue : enums)
+        stringEnums.insert(enumValue.asString());
+    }
   }
 
   if (type != ObjectValue)
@@ -662,11 +681,28 @@ bool JSONSchemaTypeDefinition::Parse(const CVariant &value, bool isParameter /*
 
 JSONRPC_STATUS JSONSchemaTypeDefinition::Check(const CVariant& value,
                                                CVariant& outputValue,
-                                               CVariant& errorData) const
+                                               CVariant& errorData,
+                                               bool lightValidation /* = false */) const
+{
+  JSONRPC_STATUS status = checkValue(value, outputValue, errorData, lightValidation);
+
+  // The error data is only filled in when the value is invalid because most
+  // calls are valid. If an extended type already filled it in we keep it.
+  if (status != OK && !errorData.isMember("type"))
+  {
+    if (!name.empty())
+      errorData["name"] = name;
+    SchemaValueTypeToJson(type, errorData["type"]);
+  }
+
+  return status;
+}
+
+JSONRPC_STATUS JSONSchemaTypeDefinition::checkValue(const CVariant& value,
+                                                    CVariant& outputValue,
+                                                    CVariant& errorData,
+                                                    bool lightValidation) const
 {
-  if (!name.empty())
-    errorData["name"] = name;
-  SchemaValueTypeToJson(type, errorData["type"]);
   std::string errorMessage;
 
   // Let's check the type of the provided parameter
@@ -690,7 +726,7 @@ JSONRPC_STATUS JSONSchemaTypeDefinition::Check(const CVariant& value,
     {
       CVariant dummyError;
       CVariant testOutput = outputValue;
-      if (unionTypes.at(unionIndex)->Check(value, testOutput, dummyError) == OK)
+      if (unionTypes.at(unionIndex)->Check(value, testOutput, dummyError, lightValidation) == OK)
       {
         ok = true;
         outputValue = testOutput;
@@ -712,7 +748,8 @@ JSONRPC_STATUS JSONSchemaTypeDefinition::Check(const CVariant& value,
   {
     for (unsigned int extendsIndex = 0; extendsIndex < extends.size(); extendsIndex++)
     {
-      JSONRPC_STATUS status = extends.at(extendsIndex)->Check(value, outputValue, errorData);
+      JSONRPC_STATUS status =
+          extends.at(extendsIndex)->Check(value, outputValue, errorData, lightValidation);
 
       if (status != OK)
       {
@@ -759,13 +796,16 @@ JSONRPC_STATUS JSONSchemaTypeDefinition::Check(const CVariant& value,
       JSONSchemaTypeDefinitionPtr itemType = items.at(0);
 
       // Loop through all array elements
+      outputValue.reserve(value.size());
       for (unsigned int arrayIndex = 0; arrayIndex < value.size(); arrayIndex++)
       {
         CVariant temp;
-        JSONRPC_STATUS status = itemType->Check(value[arrayIndex], temp, errorData["property"]);
-        outputValue.push_back(temp);
+        CVariant itemError;
+        JSONRPC_STATUS status = itemType->Check(value[arrayIndex], temp, itemError, lightValidation);
+        outputValue.push_back(std::move(temp));
         if (status != OK)
         {
+          errorData["property"] = std::move(itemError);
           CLog::Log(LOGDEBUG, "JSONRPC: Array element at index {} does not match in type {}",
                     arrayIndex, name);
           errorMessage =
@@ -800,9 +840,11 @@ JSONRPC_STATUS JSONSchemaTypeDefinition::Check(const CVariant& value,
       unsigned int arrayIndex;
       for (arrayIndex = 0; arrayIndex < std::min(items.size(), (size_t)value.size()); arrayIndex++)
       {
-        JSONRPC_STATUS status = items.at(arrayIndex)->Check(value[arrayIndex], outputValue[arrayIndex], errorData["property"]);
+        CVariant itemError;
+        JSONRPC_STATUS status = items.at(arrayIndex)->Check(value[arrayIndex], outputValue[arrayIndex], itemError, lightValidation);
         if (status != OK)
         {
+          errorData["property"] = std::move(itemError);
           CLog::Log(
               LOGDEBUG,
               "JSONRPC: Array element at index {} does not match with items schema in type {}",
@@ -822,7 +864,7 @@ JSONRPC_STATUS JSONSchemaTypeDefinition::Check(const CVariant& value,
           for (unsigned int additionalIndex = 0; additionalIndex < additionalItems.size(); additionalIndex++)
           {
             CVariant dummyError;
-            if (additionalItems.at(additionalIndex)->Check(value[arrayIndex], outputValue[arrayIndex], dummyError) == OK)
+            if (additionalItems.at(additionalIndex)->Check(value[arrayIndex], outputValue[arrayIndex], dummyError, lightValidation) == OK)
             {
               ok = true;
               break;
@@ -844,7 +886,8 @@ JSONRPC_STATUS JSONSchemaTypeDefinition::Check(const CVariant& value,
     }
 
     // If every array element is unique we need to check each one
-    if (uniqueItems)
+    // (skipped for light validation as it is quadratic in the number of items)
+    if (uniqueItems && !lightValidation)
     {
       for (unsigned int checkingIndex = 0; checkingIndex < outputValue.size(); checkingIndex++)
       {
@@ -879,9 +922,11 @@ JSONRPC_STATUS JSONSchemaTypeDefinition::Check(const CVariant& value,
     {
       if (value.isMember(propertiesIterator->second->name))
       {
-        JSONRPC_STATUS status = propertiesIterator->second->Check(value[propertiesIterator->second->name], outputValue[propertiesIterator->second->name], errorData["property"]);
+        CVariant propertyError;
+        JSONRPC_STATUS status = propertiesIterator->second->Check(value[propertiesIterator->second->name], outputValue[propertiesIterator->second->name], propertyError, lightValidation);
         if (status != OK)
         {
+          errorData["property"] = std::move(propertyError);
           CLog::Log(LOGDEBUG, "JSONRPC: Invalid property \"{}\" in type {}",
                     propertiesIterator->second->name, name);
           return status;
@@ -922,9 +967,11 @@ JSONRPC_STATUS JSONSchemaTypeDefinition::Check(const CVariant& value,
             continue;
           }
 
-          JSONRPC_STATUS status = additionalProperties->Check(value[iter->first], outputValue[iter->first], errorData["property"]);
+          CVariant propertyError;
+          JSONRPC_STATUS status = additionalProperties->Check(value[iter->first], outputValue[iter->first], propertyError, lightValidation);
           if (status != OK)
           {
+            errorData["property"] = std::move(propertyError);
             CLog::Log(LOGDEBUG, "JSONRPC: Invalid additional property \"{}\" in type {}",
                       iter->first, name);
             return status;
@@ -947,16 +994,23 @@ JSONRPC_STATUS JSONSchemaTypeDefinition::Check(const CVariant& value,
   // It's neither an array nor an object
 
   // If it can only take certain values ("enum")
-  // we need to check against those
-  if (!enums.empty())
+  // we need to check against those (unless it's
+  // a light validation)
+  if (!enums.empty() && !lightValidation)
   {
     bool valid = false;
-    for (const auto& enumItr : enums)
+    if (!stringEnums.empty())
+      valid = value.isString() &&
+              stringEnums.find(std::string_view(value.c_str(), value.size())) != stringEnums.end();
+    else
     {
-      if (enumItr == value)
+      for (const auto& enumItr : enums)
       {
-        valid = true;
-        break;
+        if (enumItr == value)
+        {
+          valid = true;
+          break;
+        }
       }
     }
 
@@ -1290,6 +1344,7 @@ JsonRpcMethod::JsonRpcMethod()
     method(NULL),
     description(),
     parameters(),
+    defaultParameters(CVariant::VariantTypeObject),
     returns(new JSONSchemaTypeDefinition())
 { }
 
@@ -1348,6 +1403,11 @@ bool JsonRpcMethod::Parse(const CVariant &value)
         return false;
       }
       parameters.push_back(param);
+
+      // Remember the default value of optional parameters so that
+      // they don't have to be looked up for every call
+      if (param->optional)
+        defaultParameters[param->name] = param->defaultValue;
     }
   }
 
@@ -1369,20 +1429,29 @@ JSONRPC_STATUS JsonRpcMethod::Check(const CVariant &requestParameters, ITranspor
     {
       methodCall = method;
 
+      // Start with the default values of all optional parameters
+      // which are then overwritten by the provided parameters
+      if (!parameters.empty())
+        outputParameters = defaultParameters;
+
+      const bool lightValidation = transport->UseLightValidation();
+
       // Count the number of actually handled (present)
       // parameters
       unsigned int handled = 0;
       CVariant errorData = CVariant(CVariant::VariantTypeObject);
-      errorData["method"] = name;
 
       // Loop through all the parameters to check
       for (unsigned int i = 0; i < parameters.size(); i++)
       {
         // Evaluate the current parameter
-        JSONRPC_STATUS status = checkParameter(requestParameters, parameters.at(i), i, outputParameters, handled, errorData);
+        JSONRPC_STATUS status = checkParameter(requestParameters, parameters.at(i), i,
+                                               lightValidation, outputParameters, handled,
+                                               errorData);
         if (status != OK)
         {
           // Return the error data object in the outputParameters reference
+          errorData["method"] = name;
           outputParameters = errorData;
           return status;
         }
@@ -1391,6 +1460,7 @@ JSONRPC_STATUS JsonRpcMethod::Check(const CVariant &requestParameters, ITranspor
       // Check if there were unnecessary parameters
       if (handled < requestParameters.size())
       {
+        errorData["method"] = name;
         errorData["message"] = "Too many parameters";
         outputParameters = errorData;
         return InvalidParams;
@@ -1440,6 +1510,7 @@ bool JsonRpcMethod::parseReturn(const CVariant &value)
 JSONRPC_STATUS JsonRpcMethod::checkParameter(const CVariant& requestParameters,
                                              const JSONSchemaTypeDefinitionPtr& type,
                                              unsigned int position,
+                                             bool lightValidation,
                                              CVariant& outputParameters,
                                              unsigned int& handled,
                                              CVariant& errorData)
@@ -1447,23 +1518,30 @@ JSONRPC_STATUS JsonRpcMethod::checkParameter(const CVariant& requestParameters,
   // Let's check if the parameter has been provided
   if (ParameterExists(requestParameters, type->name, position))
   {
-    // Get the parameter
-    CVariant parameterValue = GetParameter(requestParameters, type->name, position);
+    // Get the parameter (without copying it)
+    const CVariant& parameterValue = IsValueMember(requestParameters, type->name)
+                                         ? requestParameters[type->name]
+                                         : requestParameters[position];
+
+    // Replace the default value of the parameter
+    CVariant& outputValue = outputParameters[type->name];
+    outputValue = CVariant();
 
     // Evaluate the type of the parameter
-    JSONRPC_STATUS status = type->Check(parameterValue, outputParameters[type->name], errorData["stack"]);
+    CVariant parameterError;
+    JSONRPC_STATUS status = type->Check(parameterValue, outputValue, parameterError, lightValidation);
     if (status != OK)
+    {
+      errorData["stack"] = std::move(parameterError);
       return status;
+    }
 
     // The parameter was present and valid
     handled++;
   }
-  // If the parameter has not been provided but is optional
-  // we can use its default value
-  else if (type->optional)
-    outputParameters[type->name] = type->defaultValue;
   // The parameter is required but has not been provided => invalid
-  else
+  // (optional parameters already have their default value)
+  else if (!type->optional)
   {
     errorData["stack"]["name"] = type->name;
     SchemaValueTypeToJson(type->type, errorData["stack"]["type"]);
@@ -1487,6 +1565,9 @@ void CJSONServiceDescription::Cleanup()
   m_actionMap.clear();
   m_types.clear();
   m_incompleteDefinitions.clear();
+
+  std::unique_lock<CCriticalSection> lock(m_validationStatsSection);
+  m_validationStats.clear();
 }
 
 bool CJSONServiceDescription::prepareDescription(std::string &description, CVariant &descriptionObject, std::string &name)
@@ -1972,10 +2053,41 @@ JSONRPC_STATUS CJSONServiceDescription::Print(CVariant &result, ITransportLayer
 JSONRPC_STATUS CJSONServiceDescription::CheckCall(const char* const method, const CVariant &requestParameters, ITransportLayer *transport, IClient *client, bool notification, MethodCall &methodCall, CVariant &outputParameters)
 {
   CJsonRpcMethodMap::JsonRpcMethodIterator iter = m_actionMap.find(method);
-  if (iter != m_actionMap.end())
+  if (iter == m_actionMap.end())
+    return MethodNotFound;
+
+  if (!CServiceBroker::GetLogging().CanLogComponent(LOGJSONRPC))
     return iter->second.Check(requestParameters, transport, client, notification, methodCall, outputParameters);
 
-  return MethodNotFound;
+  // Measure how long the validation takes for the debug log
+  const auto start = std::chrono::steady_clock::now();
+  JSONRPC_STATUS status = iter->second.Check(requestParameters, transport, client, notification, methodCall, outputParameters);
+  const auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - start);
+
+  ValidationStats stats;
+  {
+    std::unique_lock<CCriticalSection> lock(m_validationStatsSection);
+    ValidationStats& methodStats = m_validationStats[iter->second.name];
+    methodStats.calls++;
+    methodStats.total += duration;
+    methodStats.maximum = std::max(methodStats.maximum, duration);
+    stats = methodStats;
+  }
+
+  CLog::Log(LOGDEBUG, LOGJSONRPC,
+            "JSONRPC: Validated parameters of {} in {} us (average {} us, maximum {} us over {} "
+            "calls)",
+            iter->second.name, duration.count(), stats.total.count() / stats.calls,
+            stats.maximum.count(), stats.calls);
+
+  return status;
+}
+
+std::map<std::string, CJSONServiceDescription::ValidationStats> CJSONServiceDescription::GetValidationStats()
+{
+  std::unique_lock<CCriticalSection> lock(m_validationStatsSection);
+  return m_validationStats;
 }
 
 JSONSchemaTypeDefinitionPtr CJSONServiceDescription::GetType(const std::string &identification)
@@ -9,10 +9,14 @@
 #pragma once
 
 #include "JSONUtils.h"
+#include "threads/CriticalSection.h"
 #include "utils/Variant.h"
 
+#include <chrono>
 #include <limits>
+#include <map>
 #include <memory>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -37,7 +41,18 @@ namespace JSONRPC
     JSONSchemaTypeDefinition();
 
     bool Parse(const CVariant &value, bool isParameter = false);
-    JSONRPC_STATUS Check(const CVariant& value, CVariant& outputValue, CVariant& errorData) const;
+    /*!
+     \brief Checks the given value against the type definition
+     \param value Value to check
+     \param outputValue Checked value with default values for missing optional properties
+     \param errorData Details about the error (only filled in if the value is invalid)
+     \param lightValidation Whether to skip the checks of "enum" and "uniqueItems"
+     \return OK if the value is valid otherwise InvalidParams
+     */
+    JSONRPC_STATUS Check(const CVariant& value,
+                         CVariant& outputValue,
+                         CVariant& errorData,
+                         bool lightValidation = false) const;
     void Print(bool isParameter, bool isGlobal, bool printDefault, bool printDescriptions, CVariant &output) const;
     void ResolveReference();
 
@@ -147,6 +162,12 @@ namespace JSONRPC
      */
     std::vector<CVariant> enums;
 
+    /*!
+     \brief Index of the allowed values if all
+     of them are strings
+     */
+    std::set<std::string, std::less<>> stringEnums;
+
     /*!
      \brief List of possible values in an array
      */
@@ -211,6 +232,12 @@ namespace JSONRPC
      \brief Type definition for additional properties
      */
     JSONSchemaTypeDefinitionPtr additionalProperties;
+
+  private:
+    JSONRPC_STATUS checkValue(const CVariant& value,
+                              CVariant& outputValue,
+                              CVariant& errorData,
+                              bool lightValidation) const;
   };
 
   /*!
@@ -259,6 +286,10 @@ namespace JSONRPC
      \brief List of accepted parameters
      */
     std::vector<JSONSchemaTypeDefinitionPtr> parameters;
+    /*!
+     \brief Default values of all optional parameters
+     */
+    CVariant defaultParameters;
     /*!
      \brief Definition of the return value
      */
@@ -270,6 +301,7 @@ namespace JSONRPC
     static JSONRPC_STATUS checkParameter(const CVariant& requestParameters,
                                          const JSONSchemaTypeDefinitionPtr& type,
                                          unsigned int position,
+                                         bool lightValidation,
                                          CVariant& outputParameters,
                                          unsigned int& handled,
                                          CVariant& errorData);
@@ -387,6 +419,23 @@ namespace JSONRPC
 
     static JSONSchemaTypeDefinitionPtr GetType(const std::string &identification);
 
+    /*!
+     \brief Time spent validating the parameters of a method (only
+     measured while JSON-RPC debug logging is enabled)
+     */
+    struct ValidationStats
+    {
+      unsigned int calls = 0;
+      std::chrono::microseconds total{0};
+      std::chrono::microseconds maximum{0};
+    };
+
+    /*!
+     \brief Gets the validation stats of all methods which have been called
+     \return Map of the method names to their validation stats
+     */
+    static std::map<std::string, ValidationStats> GetValidationStats();
+
     static void ResolveReferences();
     static void Cleanup();
 
@@ -438,5 +487,8 @@ namespace JSONRPC
 
     typedef std::map<std::string, std::vector<IncompleteSchemaDefinition> > IncompleteSchemaDefinitionMap;
     static IncompleteSchemaDefinitionMap m_incompleteDefinitions;
+
+    static std::map<std::string, ValidationStats> m_validationStats;
+    static CCriticalSection m_validationStatsSection;
   };
 }
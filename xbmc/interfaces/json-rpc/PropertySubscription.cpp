@@ -0,0 +1,186 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "PropertySubscription.h"
+
+#include "PlayerOperations.h"
+#include "XBMCOperations.h"
+
+#include <algorithm>
+
+using namespace JSONRPC;
+
+namespace
+{
+constexpr const char* PLAYER = "player";
+constexpr const char* INFOLABELS = "infolabels";
+constexpr const char* INFOBOOLEANS = "infobooleans";
+
+void ReadStrings(const CVariant& values, std::set<std::string>& strings)
+{
+  strings.clear();
+  for (auto it = values.begin_array(); it != values.end_array(); ++it)
+    strings.insert(it->asString());
+}
+
+bool UpdateGroup(const CVariant& values,
+                 const std::set<std::string>& keys,
+                 CVariant& lastValues,
+                 CVariant& changes)
+{
+  bool changed = false;
+  for (const auto& key : keys)
+  {
+    const CVariant& value = values[key];
+    CVariant& lastValue = lastValues[key];
+    if ((value.isNull() && lastValue.isNull()) || value == lastValue)
+      continue;
+
+    lastValue = value;
+    changes[key] = value;
+    changed = true;
+  }
+
+  return changed;
+}
+} // unnamed namespace
+
+void CPropertySubscription::Set(const CVariant& parameterObject)
+{
+  ReadStrings(parameterObject["playerproperties"], m_playerProperties);
+  ReadStrings(parameterObject["infolabels"], m_infoLabels);
+  ReadStrings(parameterObject["infobooleans"], m_infoBooleans);
+  m_interval = std::chrono::milliseconds(
+      parameterObject["interval"].asInteger(DEFAULT_INTERVAL.count()));
+
+  // the id of the player is always sent along with its properties
+  if (!m_playerProperties.empty())
+    m_playerProperties.insert("playerid");
+
+  m_lastUpdate = {};
+  m_lastValues = CVariant(CVariant::VariantTypeObject);
+}
+
+bool CPropertySubscription::IsEmpty() const
+{
+  return m_playerProperties.empty() && m_infoLabels.empty() && m_infoBooleans.empty();
+}
+
+bool CPropertySubscription::IsDue(std::chrono::steady_clock::time_point now) const
+{
+  return !IsEmpty() && now - m_lastUpdate >= m_interval;
+}
+
+void CPropertySubscription::Add(const CPropertySubscription& subscription)
+{
+  m_playerProperties.insert(subscription.m_playerProperties.begin(),
+                            subscription.m_playerProperties.end());
+  m_infoLabels.insert(subscription.m_infoLabels.begin(), subscription.m_infoLabels.end());
+  m_infoBooleans.insert(subscription.m_infoBooleans.begin(), subscription.m_infoBooleans.end());
+  m_interval = std::min(m_interval, subscription.m_interval);
+}
+
+bool CPropertySubscription::Update(const CVariant& values,
+                                   std::chrono::steady_clock::time_point now,
+                                   CVariant& changes)
+{
+  m_lastUpdate = now;
+  changes = CVariant(CVariant::VariantTypeObject);
+
+  bool changed = false;
+  if (!m_playerProperties.empty())
+  {
+    CVariant groupChanges(CVariant::VariantTypeObject);
+    if (UpdateGroup(values[PLAYER], m_playerProperties, m_lastValues[PLAYER], groupChanges))
+    {
+      changes[PLAYER] = std::move(groupChanges);
+      changed = true;
+    }
+  }
+  if (!m_infoLabels.empty())
+  {
+    CVariant groupChanges(CVariant::VariantTypeObject);
+    if (UpdateGroup(values[INFOLABELS], m_infoLabels, m_lastValues[INFOLABELS], groupChanges))
+    {
+      changes[INFOLABELS] = std::move(groupChanges);
+      changed = true;
+    }
+  }
+  if (!m_infoBooleans.empty())
+  {
+    CVariant groupChanges(CVariant::VariantTypeObject);
+    if (UpdateGroup(values[INFOBOOLEANS], m_infoBooleans, m_lastValues[INFOBOOLEANS],
+                    groupChanges))
+    {
+      changes[INFOBOOLEANS] = std::move(groupChanges);
+      changed = true;
+    }
+  }
+
+  return changed;
+}
+
+void CPropertySubscription::GetValues(const CPropertySubscription& subscription,
+                                      ITransportLayer* transport,
+                                      IClient* client,
+                                      CVariant& values)
+{
+  values = CVariant(CVariant::VariantTypeObject);
+
+  if (!subscription.m_playerProperties.empty())
+  {
+    CVariant players;
+    CPlayerOperations::GetActivePlayers("Player.GetActivePlayers", transport, client,
+                                        CVariant(), players);
+    if (!players.empty())
+    {
+      CVariant& player = values[PLAYER];
+      player["playerid"] = players[0]["playerid"];
+
+      // retrieve the properties one by one because not all of them are
+      // available for every player
+      CVariant parameters(CVariant::VariantTypeObject);
+      parameters["playerid"] = players[0]["playerid"];
+      for (const auto& property : subscription.m_playerProperties)
+      {
+        if (property == "playerid")
+          continue;
+
+        parameters["properties"] = CVariant(CVariant::VariantTypeArray);
+        parameters["properties"].push_back(property);
+
+        CVariant result;
+        if (CPlayerOperations::GetProperties("Player.GetProperties", transport, client,
+                                             parameters, result) == OK)
+          player[property] = std::move(result[property]);
+      }
+    }
+  }
+
+  if (!subscription.m_infoLabels.empty())
+  {
+    CVariant parameters(CVariant::VariantTypeObject);
+    parameters["labels"] = CVariant(CVariant::VariantTypeArray);
+    for (const auto& label : subscription.m_infoLabels)
+      parameters["labels"].push_back(label);
+
+    CXBMCOperations::GetInfoLabels("XBMC.GetInfoLabels", transport, client, parameters,
+                                   values[INFOLABELS]);
+  }
+
+  if (!subscription.m_infoBooleans.empty())
+  {
+    CVariant parameters(CVariant::VariantTypeObject);
+    parameters["booleans"] = CVariant(CVariant::VariantTypeArray);
+    for (const auto& boolean : subscription.m_infoBooleans)
+      parameters["booleans"].push_back(boolean);
+
+    CXBMCOperations::GetInfoBooleans("XBMC.GetInfoBooleans", transport, client, parameters,
+                                     values[INFOBOOLEANS]);
+  }
+}
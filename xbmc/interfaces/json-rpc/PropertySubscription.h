@@ -0,0 +1,90 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "utils/Variant.h"
+
+#include <chrono>
+#include <set>
+#include <string>
+
+namespace JSONRPC
+{
+  class IClient;
+  class ITransportLayer;
+
+  /*!
+   \ingroup jsonrpc
+   \brief Player properties, info labels and info booleans a client has subscribed to
+   (see JSONRPC.Subscribe).
+
+   Instead of polling Player.GetProperties or XBMC.GetInfoLabels the client is sent the
+   values which have changed since the last notification, at most once per interval.
+   The values are grouped into "player", "infolabels" and "infobooleans" objects.
+   */
+  class CPropertySubscription
+  {
+  public:
+    CPropertySubscription() = default;
+
+    /*!
+     \brief Sets up the subscription from the (checked) parameters of JSONRPC.Subscribe
+     */
+    void Set(const CVariant& parameterObject);
+
+    bool IsEmpty() const;
+
+    /*!
+     \brief Whether the interval of the subscription has passed since the last update
+     */
+    bool IsDue(std::chrono::steady_clock::time_point now) const;
+
+    /*!
+     \brief Adds the properties of the given subscription to this one
+     */
+    void Add(const CPropertySubscription& subscription);
+
+    /*!
+     \brief Compares the given values with the ones from the last update
+     \param values Current values as retrieved by GetValues()
+     \param now Time of the update
+     \param changes Subscribed values which have changed since the last update
+     \return True if any of the subscribed values have changed
+     */
+    bool Update(const CVariant& values, std::chrono::steady_clock::time_point now, CVariant& changes);
+
+    /*!
+     \brief Gets the subscribed values as of the last update
+     */
+    const CVariant& GetLastValues() const { return m_lastValues; }
+
+    /*!
+     \brief Retrieves the current values of everything in the given subscription
+     \param subscription Subscription (of usually several clients) to retrieve the values for
+     \param transport Transport layer used to retrieve the values
+     \param client Client used to retrieve the values
+     \param values Current values
+     */
+    static void GetValues(const CPropertySubscription& subscription,
+                          ITransportLayer* transport,
+                          IClient* client,
+                          CVariant& values);
+
+    static constexpr std::chrono::milliseconds DEFAULT_INTERVAL{500};
+
+  private:
+    std::set<std::string> m_playerProperties;
+    std::set<std::string> m_infoLabels;
+    std::set<std::string> m_infoBooleans;
+    std::chrono::milliseconds m_interval = DEFAULT_INTERVAL;
+
+    std::chrono::steady_clock::time_point m_lastUpdate;
+    CVariant m_lastValues;
+  };
+}
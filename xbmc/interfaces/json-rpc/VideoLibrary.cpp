@@ -13,8 +13,10 @@
 #include "PVROperations.h"
 #include "ServiceBroker.h"
 #include "Util.h"
+#include "XBDateTime.h"
 #include "imagefiles/ImageFileURL.h"
 #include "messaging/ApplicationMessenger.h"
+#include "utils/DatabaseColumns.h"
 #include "utils/SortUtils.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
@@ -23,10 +25,111 @@
 #include "video/VideoDbUrl.h"
 #include "video/VideoLibraryQueue.h"
 
+#include <algorithm>
+#include <cstdlib>
 #include <memory>
 
 using namespace JSONRPC;
 
+namespace
+{
+enum class ColumnFormat
+{
+  STRING,
+  INTEGER,
+  FLOAT,
+  DATETIME,
+  DATE,
+  YEAR,
+};
+
+struct ColumnProperty
+{
+  const char* name;
+  Field field;
+  ColumnFormat format;
+};
+
+// movie properties which can be serialized straight from movie_view, formatted the same way as
+// CVideoInfoTag::Serialize() does
+constexpr ColumnProperty MOVIE_COLUMN_PROPERTIES[] = {
+    {"title", FieldTitle, ColumnFormat::STRING},
+    {"originaltitle", FieldOriginalTitle, ColumnFormat::STRING},
+    {"sorttitle", FieldSortTitle, ColumnFormat::STRING},
+    {"plot", FieldPlot, ColumnFormat::STRING},
+    {"plotoutline", FieldPlotOutline, ColumnFormat::STRING},
+    {"tagline", FieldTagline, ColumnFormat::STRING},
+    {"mpaa", FieldMPAA, ColumnFormat::STRING},
+    {"trailer", FieldTrailer, ColumnFormat::STRING},
+    {"playcount", FieldPlaycount, ColumnFormat::INTEGER},
+    {"top250", FieldTop250, ColumnFormat::INTEGER},
+    {"userrating", FieldUserRating, ColumnFormat::INTEGER},
+    {"rating", FieldRating, ColumnFormat::FLOAT},
+    {"lastplayed", FieldLastPlayed, ColumnFormat::DATETIME},
+    {"dateadded", FieldDateAdded, ColumnFormat::DATETIME},
+    {"premiered", FieldYear, ColumnFormat::DATE},
+    {"year", FieldYear, ColumnFormat::YEAR},
+};
+
+const ColumnProperty* GetMovieColumnProperty(const std::string& name)
+{
+  for (const auto& property : MOVIE_COLUMN_PROPERTIES)
+  {
+    if (name == property.name)
+      return &property;
+  }
+  return nullptr;
+}
+
+std::string GetColumnString(const CDatabaseColumns& columns, size_t row, Field field)
+{
+  if (columns.GetType(field) == CDatabaseColumns::Type::STRING)
+    return columns.GetString(row, field);
+  if (columns.IsNull(row, field))
+    return "";
+  return std::to_string(columns.GetInteger(row, field));
+}
+
+CVariant GetColumnValue(const CDatabaseColumns& columns, size_t row, const ColumnProperty& property)
+{
+  switch (property.format)
+  {
+    case ColumnFormat::STRING:
+      return GetColumnString(columns, row, property.field);
+    case ColumnFormat::INTEGER:
+      return static_cast<int>(columns.GetInteger(row, property.field));
+    case ColumnFormat::FLOAT:
+      return static_cast<float>(columns.GetDouble(row, property.field));
+    case ColumnFormat::DATETIME:
+    {
+      CDateTime dateTime;
+      dateTime.SetFromDBDateTime(GetColumnString(columns, row, property.field));
+      return dateTime.IsValid() ? dateTime.GetAsDBDateTime() : StringUtils::Empty;
+    }
+    case ColumnFormat::DATE:
+    case ColumnFormat::YEAR:
+    {
+      // the premiered column either holds a date or only the year
+      const std::string premiered = GetColumnString(columns, row, property.field);
+      if (premiered.size() == 4)
+      {
+        if (property.format == ColumnFormat::DATE)
+          return StringUtils::Empty;
+        return std::max(0, static_cast<int>(std::strtol(premiered.c_str(), nullptr, 10)));
+      }
+
+      CDateTime date;
+      date.SetFromDBDate(premiered);
+      if (property.format == ColumnFormat::DATE)
+        return date.IsValid() ? date.GetAsDBDate() : StringUtils::Empty;
+      return date.IsValid() ? date.GetYear() : 0;
+    }
+  }
+
+  return CVariant::ConstNullVariant;
+}
+} // unnamed namespace
+
 JSONRPC_STATUS CVideoLibrary::GetMovies(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant &parameterObject, CVariant &result)
 {
   CVideoDatabase videodatabase;
@@ -77,6 +180,10 @@ JSONRPC_STATUS CVideoLibrary::GetMovies(const std::string &method, ITransportLay
   if (setID < 0)
     setID = 0;
 
+  if (GetMoviesFromColumns(videodatabase, videoUrl.ToString(), genreID, year, setID, sorting,
+                           parameterObject, result))
+    return OK;
+
   CFileItemList items;
   if (!videodatabase.GetMoviesNav(videoUrl.ToString(), items, genreID, year, -1, -1, -1, -1, setID, -1, sorting, RequiresAdditionalDetails(MediaTypeMovie, parameterObject)))
     return InvalidParams;
@@ -534,6 +641,16 @@ namespace
   };
 }
 
+JSONRPC_STATUS CVideoLibrary::GetChanges(const std::string& method, ITransportLayer* transport, IClient* client, const CVariant& parameterObject, CVariant& result)
+{
+  CVideoDatabase videodatabase;
+  if (!videodatabase.Open())
+    return InternalError;
+
+  HandleJournalChanges(videodatabase, parameterObject, result);
+  return OK;
+}
+
 JSONRPC_STATUS CVideoLibrary::GetAvailableArtTypes(const std::string& method, ITransportLayer* transport, IClient* client, const CVariant& parameterObject, CVariant& result)
 {
   std::string mediaType;
@@ -1157,6 +1274,71 @@ JSONRPC_STATUS CVideoLibrary::HandleItems(const char *idProperty, const char *re
   return OK;
 }
 
+bool CVideoLibrary::GetMoviesFromColumns(CVideoDatabase& videodatabase,
+                                         const std::string& baseDir,
+                                         int genreID,
+                                         int year,
+                                         int setID,
+                                         const SortDescription& sorting,
+                                         const CVariant& parameterObject,
+                                         CVariant& result)
+{
+  std::vector<const ColumnProperty*> properties;
+  FieldList fields{FieldTitle};
+  const CVariant& requested = parameterObject["properties"];
+  if (requested.isArray())
+  {
+    for (auto it = requested.begin_array(); it != requested.end_array(); ++it)
+    {
+      const ColumnProperty* property = GetMovieColumnProperty(it->asString());
+      if (property == nullptr)
+        return false;
+
+      properties.emplace_back(property);
+      fields.emplace_back(property->field);
+    }
+  }
+
+  // same filters as CVideoDatabase::GetMoviesNav()
+  CVideoDbUrl videoUrl;
+  if (!videoUrl.FromString(baseDir))
+    return false;
+  if (genreID > 0)
+    videoUrl.AddOption("genreid", genreID);
+  else if (year > 0)
+    videoUrl.AddOption("year", year);
+  else if (setID > 0)
+    videoUrl.AddOption("setid", setID);
+
+  CDatabaseColumns columns;
+  int total = 0;
+  if (!videodatabase.GetMoviesByWhere(videoUrl.ToString(), CDatabase::Filter(), fields, columns,
+                                      total, sorting))
+    return false;
+
+  const int size = std::max(total, static_cast<int>(columns.Size()));
+  int start, end;
+  HandleLimits(parameterObject, result, size, start, end);
+
+  CVariant& movies = result["movies"];
+  movies.reserve(columns.Size());
+  for (size_t row = 0; row < columns.Size(); ++row)
+  {
+    CVariant movie(CVariant::VariantTypeObject);
+    const int64_t id = columns.GetInteger(row, FieldId);
+    if (id > 0)
+      movie["movieid"] = static_cast<int>(id);
+
+    for (const auto* property : properties)
+      movie[property->name] = GetColumnValue(columns, row, *property);
+
+    movie["label"] = columns.GetString(row, FieldTitle);
+    movies.push_back(std::move(movie));
+  }
+
+  return true;
+}
+
 JSONRPC_STATUS CVideoLibrary::RemoveVideo(const CVariant &parameterObject)
 {
   CVideoDatabase videodatabase;
@@ -49,6 +49,7 @@ namespace JSONRPC
 
     static JSONRPC_STATUS GetGenres(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant &parameterObject, CVariant &result);
     static JSONRPC_STATUS GetTags(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant &parameterObject, CVariant &result);
+    static JSONRPC_STATUS GetChanges(const std::string& method, ITransportLayer* transport, IClient* client, const CVariant& parameterObject, CVariant& result);
     static JSONRPC_STATUS GetAvailableArtTypes(const std::string& method, ITransportLayer* transport, IClient* client, const CVariant& parameterObject, CVariant& result);
     static JSONRPC_STATUS GetAvailableArt(const std::string& method, ITransportLayer* transport, IClient* client, const CVariant& parameterObject, CVariant& result);
 
@@ -89,6 +90,20 @@ namespace JSONRPC
   private:
     static int RequiresAdditionalDetails(const MediaType& mediaType, const CVariant &parameterObject);
     static JSONRPC_STATUS HandleItems(const char *idProperty, const char *resultName, CFileItemList &items, const CVariant &parameterObject, CVariant &result, bool limit = true);
+    /*!
+     \brief Serialize the movies straight from the database columns without creating a CFileItem
+     for every movie.
+     \return false if one of the requested properties can't be read from the columns or the
+     database has to fall back to CFileItems, in which case GetMoviesNav() has to be used.
+     */
+    static bool GetMoviesFromColumns(CVideoDatabase& videodatabase,
+                                     const std::string& baseDir,
+                                     int genreID,
+                                     int year,
+                                     int setID,
+                                     const SortDescription& sorting,
+                                     const CVariant& parameterObject,
+                                     CVariant& result);
     static JSONRPC_STATUS RemoveVideo(const CVariant &parameterObject);
     static void UpdateVideoTag(const CVariant& parameterObject,
                                CVideoInfoTag& details,
@@ -0,0 +1,221 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "interfaces/json-rpc/IClient.h"
+#include "interfaces/json-rpc/ITransportLayer.h"
+#include "interfaces/json-rpc/JSONServiceDescription.h"
+#include "utils/JSONVariantParser.h"
+#include "utils/Variant.h"
+
+#include <gtest/gtest.h>
+
+using namespace JSONRPC;
+
+namespace
+{
+class CTestTransportLayer : public ITransportLayer
+{
+public:
+  explicit CTestTransportLayer(bool lightValidation) : m_lightValidation(lightValidation) {}
+
+  bool PrepareDownload(const char* path, CVariant& details, std::string& protocol) override
+  {
+    return false;
+  }
+  bool Download(const char* path, CVariant& result) override { return false; }
+  int GetCapabilities() override { return Response; }
+  bool UseLightValidation() override { return m_lightValidation; }
+
+private:
+  bool m_lightValidation;
+};
+
+class CTestClient : public IClient
+{
+public:
+  int GetPermissionFlags() override { return OPERATION_PERMISSION_ALL; }
+  int GetAnnouncementFlags() override { return 0; }
+  bool SetAnnouncementFlags(int flags) override { return true; }
+};
+
+JSONRPC_STATUS TestMethod(const std::string& method,
+                          ITransportLayer* transport,
+                          IClient* client,
+                          const CVariant& parameterObject,
+                          CVariant& result)
+{
+  return OK;
+}
+
+JSONSchemaTypeDefinition ParseType(const std::string& json)
+{
+  CVariant value;
+  EXPECT_TRUE(CJSONVariantParser::Parse(json, value));
+
+  JSONSchemaTypeDefinition type;
+  EXPECT_TRUE(type.Parse(value));
+  return type;
+}
+
+JsonRpcMethod ParseMethod(const std::string& json)
+{
+  CVariant value;
+  EXPECT_TRUE(CJSONVariantParser::Parse(json, value));
+
+  JsonRpcMethod method;
+  method.name = "Test.Method";
+  method.method = TestMethod;
+  EXPECT_TRUE(method.Parse(value));
+  return method;
+}
+
+const std::string METHOD = R"({
+  "params": [
+    { "name": "playerid", "type": "integer", "minimum": 0, "required": true },
+    { "name": "properties", "type": "array", "uniqueItems": true,
+      "items": { "type": "string", "enum": [ "time", "speed", "position" ] } },
+    { "name": "limits", "type": "object",
+      "properties": { "start": { "type": "integer", "default": 0 },
+                      "end": { "type": "integer", "default": -1 } } }
+  ]
+})";
+} // unnamed namespace
+
+TEST(TestJSONServiceDescription, CheckEnum)
+{
+  const JSONSchemaTypeDefinition type =
+      ParseType(R"({ "type": "string", "enum": [ "time", "speed", "position" ] })");
+  EXPECT_EQ(3u, type.stringEnums.size());
+
+  CVariant output;
+  CVariant errorData;
+  EXPECT_EQ(OK, type.Check(CVariant("speed"), output, errorData));
+  EXPECT_EQ("speed", output.asString());
+  EXPECT_TRUE(errorData.isNull());
+
+  EXPECT_EQ(InvalidParams, type.Check(CVariant("size"), output, errorData));
+  EXPECT_EQ("string", errorData["type"].asString());
+  EXPECT_TRUE(errorData.isMember("message"));
+
+  // enum values are not checked for a light validation
+  errorData = CVariant();
+  EXPECT_EQ(OK, type.Check(CVariant("size"), output, errorData, true));
+  EXPECT_TRUE(errorData.isNull());
+}
+
+TEST(TestJSONServiceDescription, CheckObjectDefaults)
+{
+  const JSONSchemaTypeDefinition type = ParseType(R"({ "type": "object",
+    "properties": { "start": { "type": "integer", "default": 0 },
+                    "end": { "type": "integer", "default": -1, "minimum": -1 } },
+    "additionalProperties": false })");
+
+  CVariant value(CVariant::VariantTypeObject);
+  value["end"] = 10;
+
+  CVariant output;
+  CVariant errorData;
+  ASSERT_EQ(OK, type.Check(value, output, errorData));
+  EXPECT_EQ(0, output["start"].asInteger());
+  EXPECT_EQ(10, output["end"].asInteger());
+
+  value["end"] = -2;
+  ASSERT_EQ(InvalidParams, type.Check(value, output, errorData));
+  EXPECT_EQ("end", errorData["property"]["name"].asString());
+  EXPECT_EQ("integer", errorData["property"]["type"].asString());
+}
+
+TEST(TestJSONServiceDescription, CheckMethodDefaults)
+{
+  const JsonRpcMethod method = ParseMethod(METHOD);
+  EXPECT_EQ(2u, method.defaultParameters.size());
+
+  CTestTransportLayer transport(false);
+  CTestClient client;
+  MethodCall methodCall = nullptr;
+
+  CVariant request;
+  ASSERT_TRUE(CJSONVariantParser::Parse(R"({ "playerid": 1, "limits": { "end": 5 } })", request));
+
+  CVariant output;
+  ASSERT_EQ(OK, method.Check(request, &transport, &client, false, methodCall, output));
+  EXPECT_EQ(TestMethod, methodCall);
+  EXPECT_EQ(1, output["playerid"].asInteger());
+  EXPECT_TRUE(output["properties"].isArray());
+  EXPECT_TRUE(output["properties"].empty());
+  EXPECT_EQ(0, output["limits"]["start"].asInteger());
+  EXPECT_EQ(5, output["limits"]["end"].asInteger());
+
+  // the cached defaults are not changed by a call
+  EXPECT_EQ(-1, method.defaultParameters["limits"]["end"].asInteger());
+
+  // parameters by position
+  ASSERT_TRUE(CJSONVariantParser::Parse(R"([ 2, [ "time", "speed" ] ])", request));
+  output = CVariant();
+  ASSERT_EQ(OK, method.Check(request, &transport, &client, false, methodCall, output));
+  EXPECT_EQ(2, output["playerid"].asInteger());
+  EXPECT_EQ(2u, output["properties"].size());
+  EXPECT_EQ(-1, output["limits"]["end"].asInteger());
+}
+
+TEST(TestJSONServiceDescription, CheckMethodErrors)
+{
+  const JsonRpcMethod method = ParseMethod(METHOD);
+
+  CTestTransportLayer transport(false);
+  CTestClient client;
+  MethodCall methodCall = nullptr;
+  CVariant output;
+
+  // missing required parameter
+  CVariant request(CVariant::VariantTypeObject);
+  ASSERT_EQ(InvalidParams, method.Check(request, &transport, &client, false, methodCall, output));
+  EXPECT_EQ("Test.Method", output["method"].asString());
+  EXPECT_EQ("playerid", output["stack"]["name"].asString());
+  EXPECT_EQ("Missing parameter", output["stack"]["message"].asString());
+
+  // duplicate array items
+  ASSERT_TRUE(
+      CJSONVariantParser::Parse(R"({ "playerid": 1, "properties": [ "time", "time" ] })", request));
+  output = CVariant();
+  ASSERT_EQ(InvalidParams, method.Check(request, &transport, &client, false, methodCall, output));
+  EXPECT_EQ("Test.Method", output["method"].asString());
+  EXPECT_EQ("properties", output["stack"]["name"].asString());
+
+  // unknown parameters
+  ASSERT_TRUE(CJSONVariantParser::Parse(R"({ "playerid": 1, "foo": 1 })", request));
+  output = CVariant();
+  ASSERT_EQ(InvalidParams, method.Check(request, &transport, &client, false, methodCall, output));
+  EXPECT_EQ("Too many parameters", output["message"].asString());
+}
+
+TEST(TestJSONServiceDescription, CheckMethodLightValidation)
+{
+  const JsonRpcMethod method = ParseMethod(METHOD);
+
+  CTestTransportLayer transport(true);
+  CTestClient client;
+  MethodCall methodCall = nullptr;
+
+  CVariant request;
+  ASSERT_TRUE(
+      CJSONVariantParser::Parse(R"({ "playerid": 1, "properties": [ "time", "time" ] })", request));
+
+  CVariant output;
+  ASSERT_EQ(OK, method.Check(request, &transport, &client, false, methodCall, output));
+  EXPECT_EQ(2u, output["properties"].size());
+
+  // types and ranges are still checked
+  ASSERT_TRUE(CJSONVariantParser::Parse(R"({ "playerid": -1 })", request));
+  output = CVariant();
+  EXPECT_EQ(InvalidParams, method.Check(request, &transport, &client, false, methodCall, output));
+
+  ASSERT_TRUE(CJSONVariantParser::Parse(R"({ "playerid": "1" })", request));
+  output = CVariant();
+  EXPECT_EQ(InvalidParams, method.Check(request, &transport, &client, false, methodCall, output));
+}
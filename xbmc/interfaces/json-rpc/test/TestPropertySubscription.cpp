@@ -0,0 +1,116 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "interfaces/json-rpc/PropertySubscription.h"
+#include "utils/JSONVariantParser.h"
+#include "utils/Variant.h"
+
+#include <gtest/gtest.h>
+
+using namespace JSONRPC;
+using namespace std::chrono_literals;
+
+namespace
+{
+CPropertySubscription Subscribe(const std::string& json)
+{
+  CVariant parameters;
+  EXPECT_TRUE(CJSONVariantParser::Parse(json, parameters));
+
+  CPropertySubscription subscription;
+  subscription.Set(parameters);
+  return subscription;
+}
+
+CVariant Values(const std::string& json)
+{
+  CVariant values;
+  EXPECT_TRUE(CJSONVariantParser::Parse(json, values));
+  return values;
+}
+} // unnamed namespace
+
+TEST(TestPropertySubscription, Empty)
+{
+  CPropertySubscription subscription;
+  EXPECT_TRUE(subscription.IsEmpty());
+  EXPECT_FALSE(subscription.IsDue(std::chrono::steady_clock::now()));
+
+  subscription = Subscribe(R"({ "infolabels": [ "Player.Title" ] })");
+  EXPECT_FALSE(subscription.IsEmpty());
+}
+
+TEST(TestPropertySubscription, UpdateChanges)
+{
+  CPropertySubscription subscription =
+      Subscribe(R"({ "playerproperties": [ "speed", "time" ],
+                     "infolabels": [ "Player.Title" ], "interval": 200 })");
+
+  const auto now = std::chrono::steady_clock::now();
+  EXPECT_TRUE(subscription.IsDue(now));
+
+  CVariant changes;
+  ASSERT_TRUE(subscription.Update(
+      Values(R"({ "player": { "playerid": 1, "speed": 1, "time": 10, "type": "video" },
+                  "infolabels": { "Player.Title": "A", "System.Time": "12:00" } })"),
+      now, changes));
+  EXPECT_EQ(1, changes["player"]["playerid"].asInteger());
+  EXPECT_EQ(10, changes["player"]["time"].asInteger());
+  EXPECT_EQ("A", changes["infolabels"]["Player.Title"].asString());
+  // values which haven't been subscribed to are left out
+  EXPECT_FALSE(changes["player"].isMember("type"));
+  EXPECT_FALSE(changes["infolabels"].isMember("System.Time"));
+
+  EXPECT_FALSE(subscription.IsDue(now + 100ms));
+  EXPECT_TRUE(subscription.IsDue(now + 200ms));
+
+  // only changed values are reported
+  ASSERT_TRUE(subscription.Update(
+      Values(R"({ "player": { "playerid": 1, "speed": 1, "time": 11 },
+                  "infolabels": { "Player.Title": "A" } })"),
+      now + 200ms, changes));
+  EXPECT_EQ(1u, changes.size());
+  EXPECT_EQ(1u, changes["player"].size());
+  EXPECT_EQ(11, changes["player"]["time"].asInteger());
+
+  EXPECT_FALSE(subscription.Update(
+      Values(R"({ "player": { "playerid": 1, "speed": 1, "time": 11 },
+                  "infolabels": { "Player.Title": "A" } })"),
+      now + 400ms, changes));
+  EXPECT_TRUE(changes.empty());
+
+  // the player has stopped
+  ASSERT_TRUE(subscription.Update(Values(R"({ "infolabels": { "Player.Title": "" } })"),
+                                  now + 600ms, changes));
+  EXPECT_TRUE(changes["player"]["playerid"].isNull());
+  EXPECT_TRUE(changes["player"]["time"].isNull());
+  EXPECT_EQ("", changes["infolabels"]["Player.Title"].asString());
+
+  const CVariant& lastValues = subscription.GetLastValues();
+  EXPECT_TRUE(lastValues["player"]["speed"].isNull());
+  EXPECT_EQ("", lastValues["infolabels"]["Player.Title"].asString());
+}
+
+TEST(TestPropertySubscription, Add)
+{
+  CPropertySubscription properties;
+  properties.Add(Subscribe(R"({ "infolabels": [ "Player.Title" ], "interval": 1000 })"));
+  properties.Add(Subscribe(R"({ "infobooleans": [ "Player.Paused" ], "interval": 200 })"));
+
+  const auto now = std::chrono::steady_clock::now();
+  CVariant changes;
+  ASSERT_TRUE(properties.Update(
+      Values(R"({ "infolabels": { "Player.Title": "A" },
+                  "infobooleans": { "Player.Paused": true } })"),
+      now, changes));
+  EXPECT_EQ("A", changes["infolabels"]["Player.Title"].asString());
+  EXPECT_TRUE(changes["infobooleans"]["Player.Paused"].asBoolean());
+
+  // the shortest interval is used
+  EXPECT_TRUE(properties.IsDue(now + 200ms));
+}
@@ -126,5 +126,10 @@ namespace XBMCAddon
       XFILE::CPluginDirectory::SetProperty(handle, key, value);
     }
 
+    void invalidateDirectoryCache(int handle, const String& tag)
+    {
+      XFILE::CPluginDirectory::InvalidateCache(handle, tag);
+    }
+
   }
 }
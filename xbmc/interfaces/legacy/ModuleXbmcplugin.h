@@ -435,11 +435,49 @@ namespace XBMCAddon
     /// ~~~~~~~~~~~~~
     ///
     setProperty(...);
-    ///@}
 #else
     void setProperty(int handle, const char* key, const String& value);
 #endif
 
+#ifdef DOXYGEN_SHOULD_USE_THIS
+    ///
+    /// \ingroup python_xbmcplugin
+    /// @brief \python_func{ xbmcplugin.invalidateDirectoryCache(handle[, tag]) }
+    /// Removes cached directory listings of this plugin.
+    ///
+    /// Listings are only cached if the plugin sets the `cache.ttl` container
+    /// property (in seconds) before calling endOfDirectory(). The optional
+    /// `cache.stale` property defines how long an expired listing may still
+    /// be shown while it is refreshed in the background and `cache.tag`
+    /// groups listings for invalidation. Listings of different urls which set
+    /// the same `cache.key` share one cached listing, e.g. when the urls only
+    /// differ by tracking or session parameters.
+    ///
+    /// @param handle      integer - handle the plugin was started with.
+    /// @param tag         [opt] string - only remove listings cached with
+    ///                    this `cache.tag`. All listings are removed if empty.
+    ///
+    ///
+    /// ------------------------------------------------------------------------
+    /// @python_v22 New function added.
+    ///
+    /// **Example:**
+    /// ~~~~~~~~~~~~~{.py}
+    /// ..
+    /// xbmcplugin.setProperty(int(sys.argv[1]), 'cache.ttl', '3600')
+    /// xbmcplugin.setProperty(int(sys.argv[1]), 'cache.tag', 'watchlist')
+    /// xbmcplugin.setProperty(int(sys.argv[1]), 'cache.key', 'watchlist/page1')
+    /// ..
+    /// xbmcplugin.invalidateDirectoryCache(int(sys.argv[1]), 'watchlist')
+    /// ..
+    /// ~~~~~~~~~~~~~
+    ///
+    invalidateDirectoryCache(...);
+    ///@}
+#else
+    void invalidateDirectoryCache(int handle, const String& tag = emptyString);
+#endif
+
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
     SWIG_CONSTANT2(int, SORT_METHOD_NONE, static_cast<int>(SortMethod::NONE));
     SWIG_CONSTANT2(int, SORT_METHOD_LABEL, static_cast<int>(SortMethod::LABEL));
@@ -52,6 +52,11 @@
   "environ['SSL_CERT_FILE'] = 'system/certs/cacert.pem'\n" \
   ""
 
+#define RUNSCRIPT_WARMSTART \
+        "" \
+        "import xbmcaddon, xbmcgui, xbmcplugin, xbmcvfs\n" \
+        ""
+
 #define RUNSCRIPT_POSTSCRIPT \
         "print('-->Python Interpreter Initialized<--')\n" \
         ""
@@ -117,3 +122,8 @@ const char* CAddonPythonInvoker::getInitializationScript() const
 {
   return RUNSCRIPT_COMPLIANT;
 }
+
+const char* CAddonPythonInvoker::getWarmStartScript() const
+{
+  return RUNSCRIPT_WARMSTART;
+}
@@ -21,4 +21,5 @@ public:
 protected:
   // overrides of CPythonInvoker
   const char* getInitializationScript() const override;
+  const char* getWarmStartScript() const override;
 };
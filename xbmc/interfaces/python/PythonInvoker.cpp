@@ -45,6 +45,7 @@
 
 #include <cassert>
 #include <iterator>
+#include <set>
 
 #ifdef TARGET_WINDOWS
 extern "C" FILE* fopen_utf8(const char* _Filename, const char* _Mode);
@@ -185,6 +186,8 @@ bool CPythonInvoker::execute(const std::string& script, std::vector<std::wstring
     m_languageHook->RegisterMe();
 
     onInitialization();
+    if (IsReuseable())
+      onWarmStart();
     setState(InvokerStateInitialized);
 
     if (realFilename == m_sourceFile)
@@ -280,6 +283,10 @@ bool CPythonInvoker::execute(const std::string& script, std::vector<std::wstring
             scriptDir);
   PyObject* module = PyImport_AddModule("__main__");
   PyObject* moduleDict = PyModule_GetDict(module);
+  // add-ons which only set reuselanguageinvoker rely on their globals surviving
+  // between invocations, only the interpreters of an opt-in pool start clean
+  if (!newInterp && m_addon != nullptr && m_addon->ExtraInfo().contains("languageinvokerpool"))
+    onReuse(moduleDict);
 
   // we need to check if we was asked to abort before we had inited
   bool stopping = false;
@@ -631,6 +638,48 @@ void CPythonInvoker::onInitialization()
   }
 }
 
+void CPythonInvoker::onWarmStart()
+{
+  // the interpreter is kept alive across invocations so pay for the imports once
+  const char* warmStartScript = getWarmStartScript();
+  if (warmStartScript != nullptr && strlen(warmStartScript) > 0)
+  {
+    if (PyRun_SimpleString(warmStartScript) == -1)
+    {
+      CLog::Log(LOGWARNING, "CPythonInvoker({}, {}): warm start failed", GetId(), m_sourceFile);
+      PyErr_Clear();
+    }
+  }
+}
+
+void CPythonInvoker::onReuse(void* moduleDict)
+{
+  // start every invocation with clean globals, the imported modules stay warm
+  static const std::set<std::string> keep = {"__builtins__", "__name__", "__doc__",
+                                             "__loader__", "__spec__", "__package__"};
+
+  PyObject* dict = static_cast<PyObject*>(moduleDict);
+  PyObject* keys = PyDict_Keys(dict);
+  if (keys == nullptr)
+  {
+    PyErr_Clear();
+    return;
+  }
+
+  for (Py_ssize_t index = 0; index < PyList_Size(keys); index++)
+  {
+    PyObject* key = PyList_GetItem(keys, index);
+    const char* name = PyUnicode_Check(key) ? PyUnicode_AsUTF8(key) : nullptr;
+    if (name == nullptr || !keep.contains(name))
+      PyDict_DelItem(dict, key);
+  }
+  Py_DECREF(keys);
+  PyErr_Clear();
+
+  CLog::Log(LOGDEBUG, "CPythonInvoker({}, {}): reset globals of reused interpreter", GetId(),
+            m_sourceFile);
+}
+
 void CPythonInvoker::onPythonModuleInitialization(void* moduleDict)
 {
   if (m_addon.get() == NULL || moduleDict == NULL)
@@ -41,7 +41,12 @@ protected:
 
   // custom virtual methods
   virtual const char* getInitializationScript() const = 0;
+  // script run once when a reusable interpreter is created to warm it up
+  virtual const char* getWarmStartScript() const { return nullptr; }
   virtual void onInitialization();
+  virtual void onWarmStart();
+  // actually a PyObject* like in onPythonModuleInitialization()
+  virtual void onReuse(void* moduleDict);
   // actually a PyObject* but don't wanna draw Python.h include into the header
   virtual void onPythonModuleInitialization(void* moduleDict);
   virtual void onDeinitialization();
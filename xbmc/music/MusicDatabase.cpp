@@ -24,6 +24,7 @@
 #include "addons/AddonSystemSettings.h"
 #include "addons/Scraper.h"
 #include "addons/kodi-dev-kit/include/kodi/c-api/addon-instance/audiodecoder.h"
+#include "dbwrappers/FullTextQuery.h"
 #include "dbwrappers/dataset.h"
 #include "dialogs/GUIDialogKaiToast.h"
 #include "dialogs/GUIDialogProgress.h"
@@ -92,6 +93,18 @@ namespace
 constexpr unsigned int RECENTLY_PLAYED_LIMIT = 25;
 constexpr size_t MIN_FULL_SEARCH_LENGTH = 3;
 
+const CDatabase::FullTextIndex SONG_TITLE_INDEX{"song_fts", "song", "idSong", {"strTitle"}};
+const CDatabase::FullTextIndex ALBUM_TITLE_INDEX{"album_fts", "album", "idAlbum", {"strAlbum"}};
+const CDatabase::FullTextIndex ARTIST_NAME_INDEX{"artist_fts", "artist", "idArtist",
+                                                 {"strArtist"}};
+
+// tables whose changes are recorded for clients syncing the library
+const CDatabase::JournaledTable JOURNALED_TABLES[] = {
+    {"artist", "idArtist", MediaTypeArtist},
+    {"album", "idAlbum", MediaTypeAlbum},
+    {"song", "idSong", MediaTypeSong},
+};
+
 void AnnounceRemove(const std::string& content, int id)
 {
   CVariant data;
@@ -251,6 +264,9 @@ void CMusicDatabase::CreateTables()
 
   CLog::Log(LOGINFO, "create removed_link table");
   m_pDS->exec("CREATE TABLE removed_link (idArtist INTEGER, idMedia INTEGER, idRole INTEGER)");
+
+  CLog::Log(LOGINFO, "create changelog table");
+  CreateJournalTable();
 }
 
 void CMusicDatabase::CreateAnalytics()
@@ -407,6 +423,17 @@ void CMusicDatabase::CreateAnalytics()
               "END");
   CreateRemovedLinkTriggers(); // DELETE ON song_artist and album_artist tables
 
+  // Triggers recording the changes for clients syncing the library
+  CLog::Log(LOGINFO, "create change journal triggers");
+  for (const auto& table : JOURNALED_TABLES)
+    CreateJournalTriggers(table);
+
+  // Full text indices used by Search()
+  CLog::Log(LOGINFO, "create full text indices");
+  CreateFullTextIndex(SONG_TITLE_INDEX);
+  CreateFullTextIndex(ALBUM_TITLE_INDEX);
+  CreateFullTextIndex(ARTIST_NAME_INDEX);
+
   // Create native functions stored in DB (MySQL/MariaDB only)
   CreateNativeDBFunctions();
 
@@ -1037,6 +1064,7 @@ int CMusicDatabase::AddSong(const int idSong,
 {
   int idNew = -1;
   std::string strSQL;
+  PrimaryReads primaryReads(*this);
   try
   {
     // We need at least the title
@@ -1393,6 +1421,7 @@ int CMusicDatabase::AddAlbum(const std::string& strAlbum,
                              CAlbum::ReleaseType releaseType)
 {
   std::string strSQL;
+  PrimaryReads primaryReads(*this);
   try
   {
     if (nullptr == m_pDB)
@@ -1692,6 +1721,7 @@ bool CMusicDatabase::HasAlbumBeenScraped(int idAlbum) const
 int CMusicDatabase::AddGenre(std::string& strGenre)
 {
   std::string strSQL;
+  PrimaryReads primaryReads(*this);
   try
   {
     StringUtils::Trim(strGenre);
@@ -1801,6 +1831,7 @@ int CMusicDatabase::AddArtist(const std::string& strArtist,
      clear any sortname currently held.
   */
 
+  PrimaryReads primaryReads(*this);
   try
   {
     if (nullptr == m_pDB)
@@ -1845,6 +1876,7 @@ int CMusicDatabase::AddArtist(const std::string& strArtist,
                               bool bScrapedMBID /* = false*/)
 {
   std::string strSQL;
+  PrimaryReads primaryReads(*this);
   try
   {
     if (nullptr == m_pDB)
@@ -2452,6 +2484,7 @@ int CMusicDatabase::AddRole(const std::string& strRole)
   int idRole = -1;
   std::string strSQL;
 
+  PrimaryReads primaryReads(*this);
   try
   {
     if (nullptr == m_pDB)
@@ -3027,6 +3060,7 @@ bool CMusicDatabase::GetIsAlbumArtist(int idArtist, CFileItem* item) const
 int CMusicDatabase::AddPath(const std::string& strPath1)
 {
   std::string strSQL;
+  PrimaryReads primaryReads(*this);
   try
   {
     std::string strPath(strPath1);
@@ -3486,7 +3520,15 @@ bool CMusicDatabase::SearchArtists(const std::string& search, CFileItemList& art
 
     std::string strVariousArtists = g_localizeStrings.Get(340).c_str();
     std::string strSQL;
-    if (search.size() >= MIN_FULL_SEARCH_LENGTH)
+    Filter filter;
+    if (search.size() >= MIN_FULL_SEARCH_LENGTH &&
+        AppendFullTextFilter(filter, ARTIST_NAME_INDEX, "artist.idArtist",
+                             CFullTextQuery(search)))
+    {
+      filter.AppendWhere(PrepareSQL("strArtist <> '%s'", strVariousArtists.c_str()));
+      BuildSQL("SELECT artist.* FROM artist ", filter, strSQL);
+    }
+    else if (search.size() >= MIN_FULL_SEARCH_LENGTH)
       strSQL = PrepareSQL("SELECT * FROM artist "
                           "WHERE (strArtist LIKE '%s%%' OR strArtist LIKE '%% %s%%') "
                           "AND strArtist <> '%s' ",
@@ -4133,7 +4175,15 @@ bool CMusicDatabase::SearchSongs(const std::string& search, CFileItemList& items
       return false;
 
     std::string strSQL;
-    if (search.size() >= MIN_FULL_SEARCH_LENGTH)
+    Filter filter;
+    if (search.size() >= MIN_FULL_SEARCH_LENGTH &&
+        AppendFullTextFilter(filter, SONG_TITLE_INDEX, "songview.idSong",
+                             CFullTextQuery(search)))
+    {
+      filter.limit = "1000";
+      BuildSQL("SELECT songview.* FROM songview ", filter, strSQL);
+    }
+    else if (search.size() >= MIN_FULL_SEARCH_LENGTH)
       strSQL = PrepareSQL("SELECT * FROM songview "
                           "WHERE strTitle LIKE '%s%%' or strTitle LIKE '%% %s%%' LIMIT 1000",
                           search.c_str(), search.c_str());
@@ -4176,7 +4226,12 @@ bool CMusicDatabase::SearchAlbums(const std::string& search, CFileItemList& albu
       return false;
 
     std::string strSQL;
-    if (search.size() >= MIN_FULL_SEARCH_LENGTH)
+    Filter filter;
+    if (search.size() >= MIN_FULL_SEARCH_LENGTH &&
+        AppendFullTextFilter(filter, ALBUM_TITLE_INDEX, "albumview.idAlbum",
+                             CFullTextQuery(search)))
+      BuildSQL("SELECT albumview.* FROM albumview ", filter, strSQL);
+    else if (search.size() >= MIN_FULL_SEARCH_LENGTH)
       strSQL = PrepareSQL("SELECT * FROM albumview "
                           "WHERE strAlbum LIKE '%s%%' OR strAlbum LIKE '%% %s%%'",
                           search.c_str(), search.c_str());
@@ -4682,6 +4737,11 @@ int CMusicDatabase::Cleanup(CGUIDialogProgress* progressDialog /*= nullptr*/)
     ret = ERROR_REORG_OTHER;
     goto error;
   }
+  if (!PruneJournal())
+  {
+    ret = ERROR_REORG_OTHER;
+    goto error;
+  }
 
   // commit transaction
   if (progressDialog)
@@ -9431,6 +9491,9 @@ void CMusicDatabase::UpdateTables(int version)
   if (version < 83)
     m_pDS->exec("ALTER TABLE song ADD strVideoURL TEXT");
 
+  if (version < 85)
+    CreateJournalTable();
+
   // Set the version of tag scanning required.
   // Not every schema change requires the tags to be rescanned, set to the highest schema version
   // that needs this. Forced rescanning (of music files that have not changed since they were
@@ -9451,7 +9514,7 @@ void CMusicDatabase::UpdateTables(int version)
 
 int CMusicDatabase::GetSchemaVersion() const
 {
-  return 83;
+  return 85;
 }
 
 int CMusicDatabase::GetMusicNeedsTagScan()
@@ -14,10 +14,13 @@
 #include "network/Network.h"
 #include "settings/AdvancedSettings.h"
 #include "settings/SettingsComponent.h"
+#include "utils/JSONVariantWriter.h"
 #include "utils/Variant.h"
 #include "utils/log.h"
 #include "websocket/WebSocketManager.h"
 
+#include <algorithm>
+#include <map>
 #include <mutex>
 #include <stdio.h>
 #include <stdlib.h>
@@ -54,10 +57,18 @@ static const bdaddr_t bt_bdaddr_local = {{0, 0, 0, 0xff, 0xff, 0xff}};
 using namespace JSONRPC;
 
 #define RECEIVEBUFFER 4096
+#define SENDBUFFER 32768
 
 namespace
 {
 constexpr size_t maxBufferLength = 64 * 1024;
+
+// how often the values of subscribed properties are compared
+constexpr auto subscriptionTick = 100ms;
+
+// how many bytes of announcements are buffered before they are sent without waiting for the end
+// of the batch
+constexpr size_t maxPendingAnnouncements = SENDBUFFER;
 }
 
 CTCPServer *CTCPServer::ServerInstance = NULL;
@@ -115,6 +126,11 @@ void CTCPServer::Process()
     struct timeval  to     = {1, 0};
     FD_ZERO(&rfds);
 
+    // wake up regularly to push the changes of subscribed properties
+    if (std::any_of(m_connections.begin(), m_connections.end(),
+                    [](const CTCPClient* connection) { return !connection->m_subscription.IsEmpty(); }))
+      to = {0, static_cast<long>(std::chrono::microseconds(subscriptionTick).count())};
+
     for (auto& it : m_servers)
     {
       FD_SET(it, &rfds);
@@ -212,11 +228,74 @@ void CTCPServer::Process()
         }
       }
     }
+
+    UpdateSubscriptions();
   }
 
   Deinitialize();
 }
 
+void CTCPServer::UpdateSubscriptions()
+{
+  const auto now = std::chrono::steady_clock::now();
+
+  // Collect everything the due subscriptions need so that every value is only
+  // retrieved once per tick for all clients with the same permissions
+  std::map<int, std::pair<CPropertySubscription, std::vector<CTCPClient*>>> groups;
+  for (auto* connection : m_connections)
+  {
+    if (!connection->m_subscription.IsDue(now))
+      continue;
+
+    auto& group = groups[connection->GetPermissionFlags()];
+    group.first.Add(connection->m_subscription);
+    group.second.push_back(connection);
+  }
+
+  for (auto& [permissions, group] : groups)
+  {
+    // the values are retrieved on behalf of one of the clients so that
+    // every client only sees what it's allowed to ask for itself
+    CVariant values;
+    CPropertySubscription::GetValues(group.first, this, group.second.front(), values);
+    SendSubscriptionChanges(group.second, values, now);
+  }
+}
+
+void CTCPServer::SendSubscriptionChanges(const std::vector<CTCPClient*>& clients,
+                                         const CVariant& values,
+                                         std::chrono::steady_clock::time_point now)
+{
+  const bool compact =
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_jsonOutputCompact;
+
+  // Clients which subscribed to the same properties get the same
+  // changes so only serialize them again if they are different
+  CVariant lastChanges;
+  std::string str;
+  for (auto* client : clients)
+  {
+    CVariant changes;
+    if (!client->m_subscription.Update(values, now, changes))
+      continue;
+
+    if (str.empty() || changes != lastChanges)
+    {
+      CVariant notification;
+      notification["jsonrpc"] = "2.0";
+      notification["method"] = "JSONRPC.OnPropertiesChanged";
+      notification["params"]["sender"] = "xbmc";
+      notification["params"]["data"] = changes;
+
+      if (!CJSONVariantWriter::Write(notification, str, compact))
+        continue;
+      lastChanges = std::move(changes);
+    }
+
+    client->Send(str.c_str(), str.size());
+  }
+}
+
 bool CTCPServer::PrepareDownload(const char *path, CVariant &details, std::string &protocol)
 {
   return false;
@@ -240,18 +319,43 @@ void CTCPServer::Announce(ANNOUNCEMENT::AnnouncementFlag flag,
   if (m_connections.empty())
     return;
 
+  // serialise once for all clients and send with the rest of the batch
   std::string str = IJSONRPCAnnouncer::AnnouncementToJSONRPC(flag, sender, message, data, CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_jsonOutputCompact);
+  m_pendingAnnouncementsSize += str.size();
+  m_pendingAnnouncements.emplace_back(flag, std::move(str));
 
-  for (unsigned int i = 0; i < m_connections.size(); i++)
+  if (m_pendingAnnouncementsSize >= maxPendingAnnouncements)
+    FlushAnnouncements();
+}
+
+void CTCPServer::FlushAnnouncements()
+{
+  if (m_pendingAnnouncements.empty())
+    return;
+
+  std::vector<const std::string*> announcements;
+  announcements.reserve(m_pendingAnnouncements.size());
+  for (CTCPClient* client : m_connections)
   {
+    int flags;
     {
-      std::unique_lock lock(m_connections[i]->m_critSection);
-      if ((m_connections[i]->GetAnnouncementFlags() & flag) == 0)
-        continue;
+      std::unique_lock lock(client->m_critSection);
+      flags = client->GetAnnouncementFlags();
     }
 
-    m_connections[i]->Send(str.c_str(), str.size());
+    announcements.clear();
+    for (const auto& [flag, str] : m_pendingAnnouncements)
+    {
+      if ((flags & flag) != 0)
+        announcements.push_back(&str);
+    }
+
+    if (!announcements.empty())
+      client->SendAnnouncements(announcements);
   }
+
+  m_pendingAnnouncements.clear();
+  m_pendingAnnouncementsSize = 0;
 }
 
 bool CTCPServer::Initialize()
@@ -541,6 +645,12 @@ bool CTCPServer::CTCPClient::SetAnnouncementFlags(int flags)
   return true;
 }
 
+bool CTCPServer::CTCPClient::SetPropertySubscription(const CPropertySubscription& subscription)
+{
+  m_subscription = subscription;
+  return true;
+}
+
 void CTCPServer::CTCPClient::Send(const char *data, unsigned int size)
 {
   unsigned int sent = 0;
@@ -551,6 +661,48 @@ void CTCPServer::CTCPClient::Send(const char *data, unsigned int size)
   } while (sent < size);
 }
 
+void CTCPServer::CTCPClient::SendAnnouncements(const std::vector<const std::string*>& announcements)
+{
+  if (announcements.size() == 1)
+  {
+    Send(announcements.front()->c_str(), announcements.front()->size());
+    return;
+  }
+
+  // the notifications are read from the stream one JSON object after the other
+  size_t size = 0;
+  for (const std::string* announcement : announcements)
+    size += announcement->size();
+
+  std::string str;
+  str.reserve(size);
+  for (const std::string* announcement : announcements)
+    str += *announcement;
+
+  Send(str.c_str(), str.size());
+}
+
+void CTCPServer::CTCPClient::SendResponse(const CVariant& response)
+{
+  // keep announcements from ending up in the middle of the response while it is sent in chunks
+  std::unique_lock lock(m_critSection);
+
+  CJSONVariantStreamWriter writer(
+      response, CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_jsonOutputCompact);
+  char buffer[SENDBUFFER];
+  size_t size;
+  while ((size = writer.Read(buffer, sizeof(buffer))) > 0)
+    Send(buffer, static_cast<unsigned int>(size));
+
+  if (writer.HasError())
+  {
+    CLog::Log(LOGERROR, "JSONRPC Server: Failed to serialize the response");
+    // the client can't make sense of the rest of the stream anymore, the closed connection is
+    // cleaned up by the server
+    shutdown(m_socket, SHUT_RDWR);
+  }
+}
+
 void CTCPServer::CTCPClient::PushBuffer(CTCPServer *host, const char *buffer, int length)
 {
   m_new = false;
@@ -614,8 +766,9 @@ void CTCPServer::CTCPClient::PushBuffer(CTCPServer *host, const char *buffer, in
       }
       if (m_beginBrackets > 0 && m_endBrackets > 0 && m_beginBrackets == m_endBrackets)
       {
-        std::string line = CJSONRPC::MethodCall(m_buffer, host, this);
-        Send(line.c_str(), line.size());
+        CVariant response;
+        if (CJSONRPC::MethodCall(m_buffer, host, this, response))
+          SendResponse(response);
         m_beginChar = m_beginBrackets = m_endBrackets = 0;
         m_buffer.clear();
       }
@@ -641,6 +794,7 @@ void CTCPServer::CTCPClient::Copy(const CTCPClient& client)
   m_cliaddr           = client.m_cliaddr;
   m_addrlen           = client.m_addrlen;
   m_announcementflags = client.m_announcementflags;
+  m_subscription      = client.m_subscription;
   m_beginBrackets     = client.m_beginBrackets;
   m_endBrackets       = client.m_endBrackets;
   m_beginChar         = client.m_beginChar;
@@ -695,6 +849,26 @@ void CTCPServer::CWebSocketClient::Send(const char *data, unsigned int size)
     CTCPClient::Send(frames.at(index)->GetFrameData(), (unsigned int)frames.at(index)->GetFrameLength());
 }
 
+void CTCPServer::CWebSocketClient::SendAnnouncements(
+    const std::vector<const std::string*>& announcements)
+{
+  // every notification is a websocket message of its own
+  for (const std::string* announcement : announcements)
+    Send(announcement->c_str(), announcement->size());
+}
+
+void CTCPServer::CWebSocketClient::SendResponse(const CVariant& response)
+{
+  // a websocket message is sent as a whole
+  std::string str;
+  if (CJSONVariantWriter::Write(
+          response, str,
+          CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_jsonOutputCompact))
+    Send(str.c_str(), str.size());
+  else
+    CLog::Log(LOGERROR, "WebSocket: Failed to serialize the response");
+}
+
 void CTCPServer::CWebSocketClient::PushBuffer(CTCPServer *host, const char *buffer, int length)
 {
   bool send;
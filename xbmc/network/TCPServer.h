@@ -11,10 +11,14 @@
 #include "interfaces/json-rpc/IClient.h"
 #include "interfaces/json-rpc/IJSONRPCAnnouncer.h"
 #include "interfaces/json-rpc/ITransportLayer.h"
+#include "interfaces/json-rpc/PropertySubscription.h"
 #include "threads/CriticalSection.h"
 #include "threads/Thread.h"
 #include "websocket/WebSocket.h"
 
+#include <chrono>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include <sys/socket.h>
@@ -40,12 +44,14 @@ namespace JSONRPC
                   const std::string& sender,
                   const std::string& message,
                   const CVariant& data) override;
+    void FlushAnnouncements() override;
 
   protected:
     void Process() override;
   private:
     CTCPServer(int port, bool nonlocal);
     bool Initialize();
+    void UpdateSubscriptions();
     bool InitializeBlue();
     bool InitializeTCP();
     void Deinitialize();
@@ -63,8 +69,11 @@ namespace JSONRPC
       int GetPermissionFlags() override;
       int GetAnnouncementFlags() override;
       bool SetAnnouncementFlags(int flags) override;
+      bool SetPropertySubscription(const CPropertySubscription& subscription) override;
 
       virtual void Send(const char *data, unsigned int size);
+      virtual void SendAnnouncements(const std::vector<const std::string*>& announcements);
+      virtual void SendResponse(const CVariant& response);
       virtual void PushBuffer(CTCPServer *host, const char *buffer, int length);
       virtual void Disconnect();
 
@@ -75,6 +84,7 @@ namespace JSONRPC
       sockaddr_storage m_cliaddr;
       socklen_t m_addrlen;
       CCriticalSection m_critSection;
+      CPropertySubscription m_subscription;
 
     protected:
       void Copy(const CTCPClient& client);
@@ -96,6 +106,8 @@ namespace JSONRPC
       ~CWebSocketClient() override;
 
       void Send(const char *data, unsigned int size) override;
+      void SendAnnouncements(const std::vector<const std::string*>& announcements) override;
+      void SendResponse(const CVariant& response) override;
       void PushBuffer(CTCPServer *host, const char *buffer, int length) override;
       void Disconnect() override;
 
@@ -107,7 +119,17 @@ namespace JSONRPC
       std::string m_buffer;
     };
 
+    void SendSubscriptionChanges(const std::vector<CTCPClient*>& clients,
+                                 const CVariant& values,
+                                 std::chrono::steady_clock::time_point now);
+
     std::vector<CTCPClient*> m_connections;
+    /*!
+     \brief The serialised announcements of the current batch with their flag, sent to the
+     clients by FlushAnnouncements().
+     */
+    std::vector<std::pair<ANNOUNCEMENT::AnnouncementFlag, std::string>> m_pendingAnnouncements;
+    size_t m_pendingAnnouncementsSize = 0;
     std::vector<SOCKET> m_servers;
     int m_port;
     bool m_nonlocal;
@@ -36,6 +36,7 @@
 #include <inttypes.h>
 
 #define MAX_POST_BUFFER_SIZE 2048
+#define STREAM_BLOCK_SIZE 32768
 
 #define PAGE_FILE_NOT_FOUND \
   "<html><head><title>File not found</title></head><body>File not found</body></html>"
@@ -356,6 +357,10 @@ MHD_RESULT CWebServer::HandleRequest(const std::shared_ptr<IHTTPRequestHandler>&
       ret = CreateMemoryDownloadResponse(handler, response);
       break;
 
+    case HTTPStreamDownload:
+      ret = CreateStreamDownloadResponse(handler, response);
+      break;
+
     case HTTPError:
       ret =
           CreateErrorResponse(request.connection, responseDetails.status, request.method, response);
@@ -913,6 +918,27 @@ MHD_RESULT CWebServer::CreateFileDownloadResponse(
   return MHD_YES;
 }
 
+MHD_RESULT CWebServer::CreateStreamDownloadResponse(
+    const std::shared_ptr<IHTTPRequestHandler>& handler, struct MHD_Response*& response) const
+{
+  // mhd keeps its own reference to the request handler until it is done with the response
+  auto context = std::make_unique<std::shared_ptr<IHTTPRequestHandler>>(handler);
+
+  response = MHD_create_response_from_callback(MHD_SIZE_UNKNOWN, STREAM_BLOCK_SIZE,
+                                               &CWebServer::StreamReaderCallback, context.get(),
+                                               &CWebServer::StreamReaderFreeCallback);
+  if (response == nullptr)
+  {
+    m_logger->error("failed to create a HTTP response for {} to be streamed",
+                    handler->GetRequest().pathUrl);
+    return MHD_NO;
+  }
+
+  context.release(); // ownership was passed to mhd
+
+  return MHD_YES;
+}
+
 MHD_RESULT CWebServer::CreateErrorResponse(struct MHD_Connection* connection,
                                            int responseType,
                                            HTTPMethod method,
@@ -1114,6 +1140,29 @@ void CWebServer::ContentReaderFreeCallback(void* cls)
     GetLogger()->debug("[OUT] done");
 }
 
+ssize_t CWebServer::StreamReaderCallback(void* cls, uint64_t pos, char* buf, size_t max)
+{
+  const auto* handler = static_cast<std::shared_ptr<IHTTPRequestHandler>*>(cls);
+  if (handler == nullptr || *handler == nullptr)
+    return MHD_CONTENT_READER_END_WITH_ERROR;
+
+  const ssize_t written = (*handler)->ReadResponseData(buf, max);
+  if (CServiceBroker::GetLogging().CanLogComponent(LOGWEBSERVER))
+    GetLogger()->debug("[OUT] streamed {} bytes from {}", written, pos);
+
+  if (written == 0)
+    return MHD_CONTENT_READER_END_OF_STREAM;
+  if (written < 0)
+    return MHD_CONTENT_READER_END_WITH_ERROR;
+
+  return written;
+}
+
+void CWebServer::StreamReaderFreeCallback(void* cls)
+{
+  delete static_cast<std::shared_ptr<IHTTPRequestHandler>*>(cls);
+}
+
 static Logger GetMhdLogger()
 {
   return CServiceBroker::GetLogging().GetLogger("libmicrohttpd");
@@ -13,13 +13,27 @@
 #include "interfaces/json-rpc/JSONRPC.h"
 #include "interfaces/json-rpc/JSONServiceDescription.h"
 #include "network/httprequesthandler/HTTPRequestHandlerUtils.h"
+#include "settings/AdvancedSettings.h"
+#include "settings/SettingsComponent.h"
 #include "utils/FileUtils.h"
 #include "utils/JSONVariantWriter.h"
 #include "utils/Variant.h"
 #include "utils/log.h"
 
+#include <algorithm>
+#include <cstring>
+#include <string_view>
+
 #define MAX_HTTP_POST_SIZE 65536
 
+CHTTPJsonRpcHandler::CHTTPJsonRpcHandler() = default;
+
+CHTTPJsonRpcHandler::CHTTPJsonRpcHandler(const HTTPRequest& request) : IHTTPRequestHandler(request)
+{
+}
+
+CHTTPJsonRpcHandler::~CHTTPJsonRpcHandler() = default;
+
 bool CHTTPJsonRpcHandler::CanHandleRequest(const HTTPRequest &request) const
 {
   return (request.pathUrl.compare("/jsonrpc") == 0);
@@ -72,10 +86,21 @@ MHD_RESULT CHTTPJsonRpcHandler::HandleRequest()
 
   if (isRequest)
   {
-    m_responseData = JSONRPC::CJSONRPC::MethodCall(m_requestData, &m_transportLayer, &client);
+    if (JSONRPC::CJSONRPC::MethodCall(m_requestData, &m_transportLayer, &client, m_responseValue))
+      m_responseWriter = std::make_unique<CJSONVariantStreamWriter>(
+          m_responseValue,
+          CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_jsonOutputCompact);
 
     if (!jsonpCallback.empty())
-      m_responseData = jsonpCallback + "(" + m_responseData + ");";
+      m_jsonpCallback = jsonpCallback + "(";
+
+    m_requestData.clear();
+
+    m_response.type = HTTPStreamDownload;
+    m_response.status = MHD_HTTP_OK;
+    m_response.contentType = "application/json";
+
+    return MHD_YES;
   }
   else if (jsonpCallback.empty())
   {
@@ -118,6 +143,45 @@ HttpResponseRanges CHTTPJsonRpcHandler::GetResponseData() const
   return ranges;
 }
 
+ssize_t CHTTPJsonRpcHandler::ReadResponseData(char* buffer, size_t size)
+{
+  // the opening of the JSONP callback
+  if (m_jsonpOffset < m_jsonpCallback.size())
+  {
+    const size_t length = std::min(size, m_jsonpCallback.size() - m_jsonpOffset);
+    std::memcpy(buffer, m_jsonpCallback.data() + m_jsonpOffset, length);
+    m_jsonpOffset += length;
+    return static_cast<ssize_t>(length);
+  }
+
+  if (m_responseWriter && !m_responseWriter->IsDone())
+  {
+    const size_t length = m_responseWriter->Read(buffer, size);
+    if (m_responseWriter->HasError())
+    {
+      CServiceBroker::GetLogging()
+          .GetLogger("CHTTPJsonRpcHandler")
+          ->error("failed to serialize the JSON-RPC response");
+      return -1;
+    }
+    if (length > 0)
+      return static_cast<ssize_t>(length);
+  }
+
+  // and its closing
+  if (!m_jsonpCallback.empty())
+  {
+    m_jsonpCallback.clear();
+    static constexpr std::string_view closing = ");";
+    if (size < closing.size())
+      return -1;
+    closing.copy(buffer, closing.size());
+    return static_cast<ssize_t>(closing.size());
+  }
+
+  return 0;
+}
+
 bool CHTTPJsonRpcHandler::appendPostData(const char *data, size_t size)
 {
   if (m_requestData.size() + size > MAX_HTTP_POST_SIZE)
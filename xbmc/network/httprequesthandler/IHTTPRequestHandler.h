@@ -60,7 +60,9 @@ typedef enum HTTPResponseType
   HTTPMemoryDownloadFreeNoCopy,
   // creates a HTTP response from a buffer by copying followed by freeing the buffer
   // the buffer must have been malloc'ed and not new'ed
-  HTTPMemoryDownloadFreeCopy
+  HTTPMemoryDownloadFreeCopy,
+  // creates a HTTP response of unknown length which is filled in chunks by the request handler
+  HTTPStreamDownload
 } HTTPResponseType;
 
 typedef struct HTTPRequest
@@ -153,6 +155,14 @@ public:
    */
   virtual HttpResponseRanges GetResponseData() const { return HttpResponseRanges(); }
 
+  /*!
+   * \brief Fills the given buffer with the next part of the response data.
+   *
+   * \details This is only used if the response type is HTTPStreamDownload.
+   * \return Number of bytes written, 0 at the end of the response data or -1 on error.
+   */
+  virtual ssize_t ReadResponseData(char* buffer, size_t size) { return -1; }
+
   /*!
   * \brief Returns the URL to which the request should be redirected.
   *
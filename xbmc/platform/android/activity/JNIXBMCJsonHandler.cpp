@@ -63,6 +63,12 @@ int CJNIXBMCJsonHandler::CJNITransportLayer::GetCapabilities()
   return JSONRPC::Response;
 }
 
+bool CJNIXBMCJsonHandler::CJNITransportLayer::UseLightValidation()
+{
+  // requests only come from our own Java code
+  return true;
+}
+
 int CJNIXBMCJsonHandler::CJNIClient::GetPermissionFlags()
 {
   return JSONRPC::OPERATION_PERMISSION_ALL;
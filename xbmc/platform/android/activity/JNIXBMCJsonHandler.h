@@ -39,6 +39,7 @@ namespace jni
       bool PrepareDownload(const char *path, CVariant &details, std::string &protocol) override;
       bool Download(const char *path, CVariant &result) override;
       int GetCapabilities() override;
+      bool UseLightValidation() override;
     };
 
     class CJNIClient : public JSONRPC::IClient
@@ -126,6 +126,13 @@ bool CSMBDirectory::GetDirectory(const CURL& url, CFileItemList &items)
 
   for (size_t i=0; i<vecEntries.size(); i++)
   {
+    // stating every entry is slow, so pass on what we have so far
+    if (!ReportItems(items))
+    {
+      items.ClearItems();
+      return false;
+    }
+
     const CachedDirEntry& aDir = vecEntries[i];
 
     // We use UTF-8 internally, as does SMB
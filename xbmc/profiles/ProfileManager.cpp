@@ -358,6 +358,7 @@ bool CProfileManager::LoadProfile(unsigned int index)
   CServiceBroker::GetGUI()->GetWindowManager().SendMessage(msg);
 
   CUtil::DeleteDirectoryCache();
+  g_directoryCache.PrintStats();
   g_directoryCache.Clear();
 
   lock.unlock();
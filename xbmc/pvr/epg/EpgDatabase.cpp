@@ -9,6 +9,7 @@
 #include "EpgDatabase.h"
 
 #include "ServiceBroker.h"
+#include "dbwrappers/FullTextQuery.h"
 #include "dbwrappers/dataset.h"
 #include "pvr/epg/Epg.h"
 #include "pvr/epg/EpgInfoTag.h"
@@ -29,6 +30,12 @@
 using namespace dbiplus;
 using namespace PVR;
 
+namespace
+{
+const CDatabase::FullTextIndex EPG_TEXT_INDEX{
+    "epgtags_fts", "epgtags", "idBroadcast", {"sTitle", "sPlotOutline", "sPlot"}};
+} // unnamed namespace
+
 bool CPVREpgDatabase::Open()
 {
   std::unique_lock lock(m_critSection);
@@ -146,6 +153,15 @@ void CPVREpgDatabase::CreateAnalytics()
   std::unique_lock lock(m_critSection);
   m_pDS->exec("CREATE UNIQUE INDEX idx_epg_idEpg_iStartTime on epgtags(idEpg, iStartTime desc);");
   m_pDS->exec("CREATE INDEX idx_epg_iEndTime on epgtags(iEndTime);");
+
+  if (CreateFullTextIndex(EPG_TEXT_INDEX) && m_sqlite)
+  {
+    // tags replaced by one with the same start time don't fire the delete trigger
+    m_pDS->exec("CREATE TRIGGER tgrReplace_epgtags_fts BEFORE INSERT ON epgtags FOR EACH ROW BEGIN "
+                "DELETE FROM epgtags_fts WHERE rowid IN (SELECT idBroadcast FROM epgtags "
+                "WHERE idEpg = NEW.idEpg AND iStartTime = NEW.iStartTime); "
+                "END");
+  }
 }
 
 void CPVREpgDatabase::UpdateTables(int iVersion)
@@ -581,6 +597,7 @@ public:
   explicit CSearchTermConverter(const std::string& strSearchTerm) { Parse(strSearchTerm); }
 
   bool HasSearchTerm() const { return !m_fragments.empty(); }
+  bool HasOperators() const { return m_hasOperators; }
 
   std::string ToSQL(std::string_view strFieldName) const
   {
@@ -620,6 +637,7 @@ private:
         GetAndCutNextTerm(strParsedSearchTerm, strDummy);
         strFragment += " NOT ";
         bNextOR = false;
+        m_hasOperators = true;
       }
       else if (StringUtils::StartsWith(strParsedSearchTerm, "+") ||
                StringUtils::StartsWithNoCase(strParsedSearchTerm, "and"))
@@ -628,6 +646,7 @@ private:
         GetAndCutNextTerm(strParsedSearchTerm, strDummy);
         strFragment += " AND ";
         bNextOR = false;
+        m_hasOperators = true;
       }
       else if (StringUtils::StartsWith(strParsedSearchTerm, "|") ||
                StringUtils::StartsWithNoCase(strParsedSearchTerm, "or"))
@@ -636,6 +655,7 @@ private:
         GetAndCutNextTerm(strParsedSearchTerm, strDummy);
         strFragment += " OR ";
         bNextOR = false;
+        m_hasOperators = true;
       }
       else
       {
@@ -695,6 +715,7 @@ private:
   }
 
   std::vector<std::string> m_fragments;
+  bool m_hasOperators{false};
 };
 
 } // unnamed namespace
@@ -704,7 +725,7 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgDatabase::GetEpgTags(
 {
   std::unique_lock lock(m_critSection);
 
-  std::string strQuery = PrepareSQL("SELECT * FROM epgtags");
+  std::string strQuery = PrepareSQL("SELECT epgtags.* FROM epgtags ");
 
   Filter filter;
 
@@ -803,7 +824,15 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgDatabase::GetEpgTags(
   /////////////////////////////////////////////////////////////////////////////////////////////
 
   const CSearchTermConverter conv{searchData.m_strSearchTerm};
-  if (conv.HasSearchTerm())
+  std::vector<std::string> columns{"sTitle", "sPlotOutline"};
+  if (searchData.m_bSearchInDescription)
+    columns.emplace_back("sPlot");
+
+  // the full text index matches words instead of substrings and has no NOT operator
+  if (conv.HasSearchTerm() &&
+      (conv.HasOperators() ||
+       !AppendFullTextFilter(filter, EPG_TEXT_INDEX, "epgtags.idBroadcast",
+                             CFullTextQuery(searchData.m_strSearchTerm, false), columns)))
   {
     // title
     std::string strWhere = conv.ToSQL("sTitle");
@@ -66,7 +66,7 @@ namespace PVR
      * @brief Get the minimal database version that is required to operate correctly.
      * @return The minimal database version.
      */
-    int GetSchemaVersion() const override { return 20; }
+    int GetSchemaVersion() const override { return 21; }
 
     /*!
      * @brief Get the default sqlite database filename.
@@ -29,6 +29,7 @@ enum DEPTH_CULLING
 };
 
 class CGUIImage;
+class CGUIQuadBatch;
 class CGUITextLayout;
 
 class CRenderSystemBase
@@ -76,6 +77,17 @@ public:
 
   virtual std::string GetShaderPath(const std::string &filename) { return ""; }
 
+  /**
+   * Draw GUI texture quads that are still queued for batching. Needs to be called before
+   * drawing anything without the render system (e.g. video), which doesn't know about the queue.
+   */
+  virtual void FlushQuadBatch() {}
+
+  /**
+   * The batcher of GUI texture quads, nullptr if the render system doesn't batch
+   */
+  virtual const CGUIQuadBatch* GetQuadBatch() const { return nullptr; }
+
   void GetRenderVersion(unsigned int& major, unsigned int& minor) const;
   const std::string& GetRenderVendor() const { return m_RenderVendor; }
   const std::string& GetRenderRenderer() const { return m_RenderRenderer; }
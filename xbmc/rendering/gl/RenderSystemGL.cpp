@@ -22,6 +22,7 @@
 #include "utils/log.h"
 #include "windowing/WinSystem.h"
 
+#include <cstddef>
 #include <exception>
 
 #if defined(TARGET_LINUX)
@@ -30,7 +31,12 @@
 
 using namespace std::chrono_literals;
 
-CRenderSystemGL::CRenderSystemGL() : CRenderSystemBase()
+CRenderSystemGL::CRenderSystemGL()
+  : CRenderSystemBase(),
+    m_quadBatch([this](const CGUIQuadBatch::State& state,
+                       const std::vector<CGUIQuadBatch::Vertex>& vertices,
+                       const std::vector<uint16_t>& indices)
+                { DrawQuadBatch(state, vertices, indices); })
 {
 }
 
@@ -38,6 +44,9 @@ CRenderSystemGL::~CRenderSystemGL() = default;
 
 bool CRenderSystemGL::InitRenderSystem()
 {
+  m_quadBatch.SetEnabled(
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_guiBatchQuads);
+
   m_bVSync = false;
   m_bVsyncInit = false;
   m_maxTextureSize = 2048;
@@ -278,6 +287,8 @@ bool CRenderSystemGL::EndRender()
   if (!m_bRenderCreated)
     return false;
 
+  m_quadBatch.FrameEnd();
+
   return true;
 }
 
@@ -286,6 +297,8 @@ void CRenderSystemGL::InvalidateColorBuffer()
   if (!m_bRenderCreated)
     return;
 
+  m_quadBatch.Flush();
+
   /* clear is not affected by stipple pattern, so we can only clear on first frame */
   if (m_stereoMode == RENDER_STEREO_MODE_INTERLACED && m_stereoView == RENDER_STEREO_VIEW_RIGHT)
     return;
@@ -310,6 +323,8 @@ bool CRenderSystemGL::ClearBuffers(KODI::UTILS::COLOR::Color color)
   if (!m_bRenderCreated)
     return false;
 
+  m_quadBatch.Flush();
+
   /* clear is not affected by stipple pattern, so we can only clear on first frame */
   if(m_stereoMode == RENDER_STEREO_MODE_INTERLACED && m_stereoView == RENDER_STEREO_VIEW_RIGHT)
     return true;
@@ -400,6 +415,8 @@ void CRenderSystemGL::CaptureStateBlock()
   if (!m_bRenderCreated)
     return;
 
+  m_quadBatch.Flush();
+
   glMatrixProject.Push();
   glMatrixModview.Push();
   glMatrixTexture.Push();
@@ -431,6 +448,8 @@ void CRenderSystemGL::SetCameraPosition(const CPoint &camera, int screenWidth, i
   if (!m_bRenderCreated)
     return;
 
+  m_quadBatch.Flush();
+
   CPoint offset = camera - CPoint(screenWidth*0.5f, screenHeight*0.5f);
 
 
@@ -506,6 +525,8 @@ void CRenderSystemGL::SetViewPort(const CRect& viewPort)
   if (!m_bRenderCreated)
     return;
 
+  m_quadBatch.Flush();
+
   glScissor((GLint) viewPort.x1, (GLint) (m_height - viewPort.y1 - viewPort.Height()), (GLsizei) viewPort.Width(), (GLsizei) viewPort.Height());
   glViewport((GLint) viewPort.x1, (GLint) (m_height - viewPort.y1 - viewPort.Height()), (GLsizei) viewPort.Width(), (GLsizei) viewPort.Height());
   m_viewPort[0] = viewPort.x1;
@@ -540,6 +561,7 @@ void CRenderSystemGL::SetScissors(const CRect &rect)
 {
   if (!m_bRenderCreated)
     return;
+  m_quadBatch.Flush();
   GLint x1 = MathUtils::round_int(static_cast<double>(rect.x1));
   GLint y1 = MathUtils::round_int(static_cast<double>(rect.y1));
   GLint x2 = MathUtils::round_int(static_cast<double>(rect.x2));
@@ -554,6 +576,8 @@ void CRenderSystemGL::ResetScissors()
 
 void CRenderSystemGL::SetDepthCulling(DEPTH_CULLING culling)
 {
+  m_quadBatch.Flush();
+
   if (culling == DEPTH_CULLING_OFF)
   {
     glDisable(GL_DEPTH_TEST);
@@ -633,6 +657,8 @@ static const GLubyte stipple_3d[] = {
 
 void CRenderSystemGL::SetStereoMode(RENDER_STEREO_MODE mode, RENDER_STEREO_VIEW view)
 {
+  m_quadBatch.Flush();
+
   CRenderSystemBase::SetStereoMode(mode, view);
 
   glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
@@ -826,6 +852,10 @@ void CRenderSystemGL::ReleaseShaders()
 
 void CRenderSystemGL::EnableShader(ShaderMethodGL method)
 {
+  // everything drawn by GUI shaders has to end up on top of the queued quads
+  if (!m_quadBatch.IsFlushing())
+    m_quadBatch.Flush();
+
   m_method = method;
   if (m_pShader[m_method])
   {
@@ -846,6 +876,99 @@ void CRenderSystemGL::DisableShader()
   m_method = ShaderMethodGL::SM_DEFAULT;
 }
 
+void CRenderSystemGL::FlushQuadBatch()
+{
+  m_quadBatch.Flush();
+}
+
+void CRenderSystemGL::DrawQuadBatch(const CGUIQuadBatch::State& state,
+                                    const std::vector<CGUIQuadBatch::Vertex>& vertices,
+                                    const std::vector<uint16_t>& indices)
+{
+  using Vertex = CGUIQuadBatch::Vertex;
+
+  EnableShader(static_cast<ShaderMethodGL>(state.shader));
+
+  if (state.texture1)
+  {
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, state.texture1);
+  }
+  glActiveTexture(GL_TEXTURE0);
+  glBindTexture(GL_TEXTURE_2D, state.texture0);
+
+  if (state.blend)
+  {
+    glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE_MINUS_DST_ALPHA, GL_ONE);
+    glEnable(GL_BLEND);
+  }
+  else
+  {
+    glDisable(GL_BLEND);
+  }
+
+  GLint posLoc = ShaderGetPos();
+  GLint tex0Loc = ShaderGetCoord0();
+  GLint tex1Loc = ShaderGetCoord1();
+  GLint uniColLoc = ShaderGetUniCol();
+  GLint depthLoc = ShaderGetDepth();
+
+  GLuint vertexVBO;
+  GLuint indexVBO;
+
+  glGenBuffers(1, &vertexVBO);
+  glBindBuffer(GL_ARRAY_BUFFER, vertexVBO);
+  glBufferData(GL_ARRAY_BUFFER, sizeof(Vertex) * vertices.size(), vertices.data(),
+               GL_STREAM_DRAW);
+
+  glUniform1f(depthLoc, state.depth);
+
+  if (uniColLoc >= 0)
+  {
+    using namespace KODI::UTILS::GL;
+    glUniform4f(uniColLoc, GetChannelFromARGB(ColorChannel::R, state.color) / 255.0f,
+                GetChannelFromARGB(ColorChannel::G, state.color) / 255.0f,
+                GetChannelFromARGB(ColorChannel::B, state.color) / 255.0f,
+                GetChannelFromARGB(ColorChannel::A, state.color) / 255.0f);
+  }
+
+  if (state.texture1)
+  {
+    glVertexAttribPointer(tex1Loc, 2, GL_FLOAT, 0, sizeof(Vertex),
+                          reinterpret_cast<const GLvoid*>(offsetof(Vertex, u2)));
+    glEnableVertexAttribArray(tex1Loc);
+  }
+
+  glVertexAttribPointer(posLoc, 3, GL_FLOAT, 0, sizeof(Vertex),
+                        reinterpret_cast<const GLvoid*>(offsetof(Vertex, x)));
+  glEnableVertexAttribArray(posLoc);
+  glVertexAttribPointer(tex0Loc, 2, GL_FLOAT, 0, sizeof(Vertex),
+                        reinterpret_cast<const GLvoid*>(offsetof(Vertex, u1)));
+  glEnableVertexAttribArray(tex0Loc);
+
+  glGenBuffers(1, &indexVBO);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexVBO);
+  glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(uint16_t) * indices.size(), indices.data(),
+               GL_STREAM_DRAW);
+
+  glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(indices.size()), GL_UNSIGNED_SHORT, 0);
+
+  if (state.texture1)
+    glDisableVertexAttribArray(tex1Loc);
+
+  glDisableVertexAttribArray(posLoc);
+  glDisableVertexAttribArray(tex0Loc);
+
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+  glDeleteBuffers(1, &vertexVBO);
+  glDeleteBuffers(1, &indexVBO);
+
+  glEnable(GL_BLEND);
+
+  DisableShader();
+}
+
 GLint CRenderSystemGL::ShaderGetPos()
 {
   if (m_pShader[m_method])
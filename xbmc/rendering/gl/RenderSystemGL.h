@@ -9,6 +9,7 @@
 #pragma once
 
 #include "GLShader.h"
+#include "guilib/GUIQuadBatch.h"
 #include "rendering/RenderSystem.h"
 #include "utils/ColorUtils.h"
 #include "utils/Map.h"
@@ -105,6 +106,10 @@ public:
 
   std::string GetShaderPath(const std::string &filename) override;
 
+  void FlushQuadBatch() override;
+  const CGUIQuadBatch* GetQuadBatch() const override { return &m_quadBatch; }
+  CGUIQuadBatch& GetGUIQuadBatch() { return m_quadBatch; }
+
   void GetGLVersion(int& major, int& minor);
   void GetGLSLVersion(int& major, int& minor);
 
@@ -130,6 +135,9 @@ protected:
   void CalculateMaxTexturesize();
   void InitialiseShaders();
   void ReleaseShaders();
+  void DrawQuadBatch(const CGUIQuadBatch::State& state,
+                     const std::vector<CGUIQuadBatch::Vertex>& vertices,
+                     const std::vector<uint16_t>& indices);
 
   bool m_bVsyncInit = false;
   int m_width;
@@ -145,4 +153,6 @@ protected:
   std::map<ShaderMethodGL, std::unique_ptr<CGLShader>> m_pShader;
   ShaderMethodGL m_method = ShaderMethodGL::SM_DEFAULT;
   GLuint m_vertexArray = GL_NONE;
+
+  CGUIQuadBatch m_quadBatch;
 };
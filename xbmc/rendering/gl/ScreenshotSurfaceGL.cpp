@@ -11,6 +11,7 @@
 #include "ServiceBroker.h"
 #include "guilib/GUIComponent.h"
 #include "guilib/GUIWindowManager.h"
+#include "rendering/RenderSystem.h"
 #include "utils/Screenshot.h"
 #include "windowing/GraphicContext.h"
 
@@ -42,6 +43,8 @@ bool CScreenshotSurfaceGL::Capture()
 
   std::unique_lock lock(winsystem->GetGfxContext());
   gui->GetWindowManager().Render();
+  // draw any quads still batched up before reading back the buffer
+  CServiceBroker::GetRenderSystem()->FlushQuadBatch();
 
   glReadBuffer(GL_BACK);
 
@@ -24,6 +24,8 @@
 #include "utils/log.h"
 #include "windowing/GraphicContext.h"
 
+#include <cstddef>
+
 #if defined(TARGET_LINUX)
 #include "utils/EGLUtils.h"
 #endif
@@ -31,12 +33,19 @@
 using namespace std::chrono_literals;
 
 CRenderSystemGLES::CRenderSystemGLES()
- : CRenderSystemBase()
+  : CRenderSystemBase(),
+    m_quadBatch([this](const CGUIQuadBatch::State& state,
+                       const std::vector<CGUIQuadBatch::Vertex>& vertices,
+                       const std::vector<uint16_t>& indices)
+                { DrawQuadBatch(state, vertices, indices); })
 {
 }
 
 bool CRenderSystemGLES::InitRenderSystem()
 {
+  m_quadBatch.SetEnabled(
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_guiBatchQuads);
+
   GLint maxTextureSize;
 
   glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxTextureSize);
@@ -194,6 +203,8 @@ bool CRenderSystemGLES::EndRender()
   if (!m_bRenderCreated)
     return false;
 
+  m_quadBatch.FrameEnd();
+
   return true;
 }
 
@@ -202,6 +213,8 @@ void CRenderSystemGLES::InvalidateColorBuffer()
   if (!m_bRenderCreated)
     return;
 
+  m_quadBatch.Flush();
+
   // some platforms prefer a clear, instead of rendering over
   if (!CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_guiGeometryClear)
     ClearBuffers(0);
@@ -219,6 +232,8 @@ bool CRenderSystemGLES::ClearBuffers(KODI::UTILS::COLOR::Color color)
   if (!m_bRenderCreated)
     return false;
 
+  m_quadBatch.Flush();
+
   float r = KODI::UTILS::GL::GetChannelFromARGB(KODI::UTILS::GL::ColorChannel::R, color) / 255.0f;
   float g = KODI::UTILS::GL::GetChannelFromARGB(KODI::UTILS::GL::ColorChannel::G, color) / 255.0f;
   float b = KODI::UTILS::GL::GetChannelFromARGB(KODI::UTILS::GL::ColorChannel::B, color) / 255.0f;
@@ -295,6 +310,8 @@ void CRenderSystemGLES::CaptureStateBlock()
   if (!m_bRenderCreated)
     return;
 
+  m_quadBatch.Flush();
+
   glMatrixProject.Push();
   glMatrixModview.Push();
   glMatrixTexture.Push();
@@ -324,6 +341,8 @@ void CRenderSystemGLES::SetCameraPosition(const CPoint &camera, int screenWidth,
   if (!m_bRenderCreated)
     return;
 
+  m_quadBatch.Flush();
+
   CPoint offset = camera - CPoint(screenWidth*0.5f, screenHeight*0.5f);
 
   float w = (float)m_viewPort[2]*0.5f;
@@ -372,6 +391,8 @@ void CRenderSystemGLES::SetViewPort(const CRect& viewPort)
   if (!m_bRenderCreated)
     return;
 
+  m_quadBatch.Flush();
+
   glScissor((GLint) viewPort.x1, (GLint) (m_height - viewPort.y1 - viewPort.Height()), (GLsizei) viewPort.Width(), (GLsizei) viewPort.Height());
   glViewport((GLint) viewPort.x1, (GLint) (m_height - viewPort.y1 - viewPort.Height()), (GLsizei) viewPort.Width(), (GLsizei) viewPort.Height());
   m_viewPort[0] = viewPort.x1;
@@ -406,6 +427,7 @@ void CRenderSystemGLES::SetScissors(const CRect &rect)
 {
   if (!m_bRenderCreated)
     return;
+  m_quadBatch.Flush();
   GLint x1 = MathUtils::round_int(static_cast<double>(rect.x1));
   GLint y1 = MathUtils::round_int(static_cast<double>(rect.y1));
   GLint x2 = MathUtils::round_int(static_cast<double>(rect.x2));
@@ -420,6 +442,8 @@ void CRenderSystemGLES::ResetScissors()
 
 void CRenderSystemGLES::SetDepthCulling(DEPTH_CULLING culling)
 {
+  m_quadBatch.Flush();
+
   if (culling == DEPTH_CULLING_OFF)
   {
     glDisable(GL_DEPTH_TEST);
@@ -687,6 +711,10 @@ void CRenderSystemGLES::ReleaseShaders()
 
 void CRenderSystemGLES::EnableGUIShader(ShaderMethodGLES method)
 {
+  // everything drawn by GUI shaders has to end up on top of the queued quads
+  if (!m_quadBatch.IsFlushing())
+    m_quadBatch.Flush();
+
   m_method = method;
   if (m_pShader[m_method])
   {
@@ -707,6 +735,78 @@ void CRenderSystemGLES::DisableGUIShader()
   m_method = ShaderMethodGLES::SM_DEFAULT;
 }
 
+void CRenderSystemGLES::FlushQuadBatch()
+{
+  m_quadBatch.Flush();
+}
+
+void CRenderSystemGLES::DrawQuadBatch(const CGUIQuadBatch::State& state,
+                                      const std::vector<CGUIQuadBatch::Vertex>& vertices,
+                                      const std::vector<uint16_t>& indices)
+{
+  using Vertex = CGUIQuadBatch::Vertex;
+
+  EnableGUIShader(static_cast<ShaderMethodGLES>(state.shader));
+
+  if (state.texture1)
+  {
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, state.texture1);
+  }
+  glActiveTexture(GL_TEXTURE0);
+  glBindTexture(GL_TEXTURE_2D, state.texture0);
+
+  if (state.blend)
+  {
+    glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE_MINUS_DST_ALPHA, GL_ONE);
+    glEnable(GL_BLEND);
+  }
+  else
+  {
+    glDisable(GL_BLEND);
+  }
+
+  GLint posLoc = GUIShaderGetPos();
+  GLint tex0Loc = GUIShaderGetCoord0();
+  GLint tex1Loc = GUIShaderGetCoord1();
+  GLint uniColLoc = GUIShaderGetUniCol();
+  GLint depthLoc = GUIShaderGetDepth();
+
+  if (uniColLoc >= 0)
+  {
+    using namespace KODI::UTILS::GL;
+    glUniform4f(uniColLoc, GetChannelFromARGB(ColorChannel::R, state.color) / 255.0f,
+                GetChannelFromARGB(ColorChannel::G, state.color) / 255.0f,
+                GetChannelFromARGB(ColorChannel::B, state.color) / 255.0f,
+                GetChannelFromARGB(ColorChannel::A, state.color) / 255.0f);
+  }
+
+  glUniform1f(depthLoc, state.depth);
+
+  const char* data = reinterpret_cast<const char*>(vertices.data());
+  if (state.texture1)
+  {
+    glVertexAttribPointer(tex1Loc, 2, GL_FLOAT, 0, sizeof(Vertex), data + offsetof(Vertex, u2));
+    glEnableVertexAttribArray(tex1Loc);
+  }
+  glVertexAttribPointer(posLoc, 3, GL_FLOAT, 0, sizeof(Vertex), data + offsetof(Vertex, x));
+  glEnableVertexAttribArray(posLoc);
+  glVertexAttribPointer(tex0Loc, 2, GL_FLOAT, 0, sizeof(Vertex), data + offsetof(Vertex, u1));
+  glEnableVertexAttribArray(tex0Loc);
+
+  glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(indices.size()), GL_UNSIGNED_SHORT,
+                 indices.data());
+
+  if (state.texture1)
+    glDisableVertexAttribArray(tex1Loc);
+
+  glDisableVertexAttribArray(posLoc);
+  glDisableVertexAttribArray(tex0Loc);
+
+  glEnable(GL_BLEND);
+  DisableGUIShader();
+}
+
 GLint CRenderSystemGLES::GUIShaderGetPos()
 {
   if (m_pShader[m_method])
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "GLESShader.h"
+#include "guilib/GUIQuadBatch.h"
 #include "rendering/RenderSystem.h"
 #include "utils/ColorUtils.h"
 #include "utils/Map.h"
@@ -123,6 +124,10 @@ public:
 
   std::string GetShaderPath(const std::string& filename) override;
 
+  void FlushQuadBatch() override;
+  const CGUIQuadBatch* GetQuadBatch() const override { return &m_quadBatch; }
+  CGUIQuadBatch& GetGUIQuadBatch() { return m_quadBatch; }
+
   void InitialiseShaders();
   void ReleaseShaders();
   void EnableGUIShader(ShaderMethodGLES method);
@@ -148,6 +153,9 @@ protected:
   virtual void SetVSyncImpl(bool enable) = 0;
   virtual void PresentRenderImpl(bool rendered) = 0;
   void CalculateMaxTexturesize();
+  void DrawQuadBatch(const CGUIQuadBatch::State& state,
+                     const std::vector<CGUIQuadBatch::Vertex>& vertices,
+                     const std::vector<uint16_t>& indices);
 
   bool m_bVsyncInit{false};
   int m_width;
@@ -159,4 +167,6 @@ protected:
   ShaderMethodGLES m_method = ShaderMethodGLES::SM_DEFAULT;
 
   GLint      m_viewPort[4];
+
+  CGUIQuadBatch m_quadBatch;
 };
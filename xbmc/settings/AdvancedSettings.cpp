@@ -578,6 +578,7 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetFloat(pElement, "limiterrelease", m_limiterRelease, 0.001f, 100.0f);
     XMLUtils::GetUInt(pElement, "maxpassthroughoffsyncduration", m_maxPassthroughOffSyncDuration,
                       20, 80);
+    XMLUtils::GetUInt(pElement, "decodeahead", m_audioDecodeAhead, 0, 60);
     XMLUtils::GetBoolean(pElement, "allowmultichannelfloat", m_AllowMultiChannelFloat);
     XMLUtils::GetBoolean(pElement, "superviseaudiodelay", m_superviseAudioDelay);
   }
@@ -740,6 +741,8 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetInt(pElement, "fpsdetect", m_videoFpsDetect, 0, 2);
     XMLUtils::GetFloat(pElement, "maxtempo", m_maxTempo, 1.5, 2.1);
     XMLUtils::GetBoolean(pElement, "preferstereostream", m_videoPreferStereoStream);
+    XMLUtils::GetBoolean(pElement, "dmaupload", m_videoDmaUpload);
+    XMLUtils::GetBoolean(pElement, "prerendersubtitles", m_videoPrerenderSubtitles);
 
     // Store global display latency settings
     TiXmlElement* pVideoLatency = pElement->FirstChildElement("latency");
@@ -1164,6 +1167,9 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetString(pDatabase, "ciphers", m_databaseVideo.ciphers);
     XMLUtils::GetUInt(pDatabase, "connecttimeout", m_databaseVideo.connecttimeout, 1, 300);
     XMLUtils::GetBoolean(pDatabase, "compression", m_databaseVideo.compression);
+    XMLUtils::GetUInt(pDatabase, "poolsize", m_databaseVideo.poolsize, 0, 64);
+    XMLUtils::GetString(pDatabase, "replicahost", m_databaseVideo.replicahost);
+    XMLUtils::GetString(pDatabase, "replicaport", m_databaseVideo.replicaport);
   }
 
   pDatabase = pRootElement->FirstChildElement("musicdatabase");
@@ -1182,6 +1188,9 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetString(pDatabase, "ciphers", m_databaseMusic.ciphers);
     XMLUtils::GetUInt(pDatabase, "connecttimeout", m_databaseMusic.connecttimeout, 1, 300);
     XMLUtils::GetBoolean(pDatabase, "compression", m_databaseMusic.compression);
+    XMLUtils::GetUInt(pDatabase, "poolsize", m_databaseMusic.poolsize, 0, 64);
+    XMLUtils::GetString(pDatabase, "replicahost", m_databaseMusic.replicahost);
+    XMLUtils::GetString(pDatabase, "replicaport", m_databaseMusic.replicaport);
   }
 
   pDatabase = pRootElement->FirstChildElement("tvdatabase");
@@ -1200,6 +1209,9 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetString(pDatabase, "ciphers", m_databaseTV.ciphers);
     XMLUtils::GetUInt(pDatabase, "connecttimeout", m_databaseTV.connecttimeout, 1, 300);
     XMLUtils::GetBoolean(pDatabase, "compression", m_databaseTV.compression);
+    XMLUtils::GetUInt(pDatabase, "poolsize", m_databaseTV.poolsize, 0, 64);
+    XMLUtils::GetString(pDatabase, "replicahost", m_databaseTV.replicahost);
+    XMLUtils::GetString(pDatabase, "replicaport", m_databaseTV.replicaport);
   }
 
   pDatabase = pRootElement->FirstChildElement("epgdatabase");
@@ -1218,6 +1230,9 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetString(pDatabase, "ciphers", m_databaseEpg.ciphers);
     XMLUtils::GetUInt(pDatabase, "connecttimeout", m_databaseEpg.connecttimeout, 1, 300);
     XMLUtils::GetBoolean(pDatabase, "compression", m_databaseEpg.compression);
+    XMLUtils::GetUInt(pDatabase, "poolsize", m_databaseEpg.poolsize, 0, 64);
+    XMLUtils::GetString(pDatabase, "replicahost", m_databaseEpg.replicahost);
+    XMLUtils::GetString(pDatabase, "replicaport", m_databaseEpg.replicaport);
   }
 
   pElement = pRootElement->FirstChildElement("enablemultimediakeys");
@@ -1235,7 +1250,9 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetInt(pElement, "anisotropicfiltering", m_guiAnisotropicFiltering);
     XMLUtils::GetBoolean(pElement, "fronttobackrendering", m_guiFrontToBackRendering);
     XMLUtils::GetBoolean(pElement, "geometryclear", m_guiGeometryClear);
+    XMLUtils::GetBoolean(pElement, "batchquads", m_guiBatchQuads);
     XMLUtils::GetBoolean(pElement, "asynctextureupload", m_guiAsyncTextureUpload);
+    XMLUtils::GetBoolean(pElement, "parallelprocess", m_guiParallelProcess);
     XMLUtils::GetBoolean(pElement, "transparentvideolayout", m_guiVideoLayoutTransparent);
   }
 
@@ -34,6 +34,7 @@ class DatabaseSettings
 {
 public:
   static constexpr unsigned int DEFAULT_CONNECT_TIMEOUT = 5; // secs
+  static constexpr unsigned int DEFAULT_POOL_SIZE = 4; // idle connections kept for reuse
 
   DatabaseSettings() { Reset(); }
   void Reset()
@@ -51,6 +52,9 @@ public:
     ciphers.clear();
     connecttimeout = DEFAULT_CONNECT_TIMEOUT;
     compression = false;
+    poolsize = DEFAULT_POOL_SIZE;
+    replicahost.clear();
+    replicaport.clear();
   };
   std::string type;
   std::string host;
@@ -65,6 +69,9 @@ public:
   std::string ciphers;
   unsigned int connecttimeout{DEFAULT_CONNECT_TIMEOUT};
   bool compression;
+  unsigned int poolsize{DEFAULT_POOL_SIZE};
+  std::string replicahost; // read-only replica SELECTs are sent to
+  std::string replicaport;
 };
 
 struct TVShowRegexp
@@ -160,6 +167,7 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     float m_videoIgnorePercentAtEnd;
     float m_audioApplyDrc;
     unsigned int m_maxPassthroughOffSyncDuration = 50; // when 50 ms off adjust
+    unsigned int m_audioDecodeAhead = 0; // seconds of the next track to decode ahead of a transition
     bool m_AllowMultiChannelFloat = false; // Android only switch to be removed in v22
     bool m_superviseAudioDelay = false; // Android only to correct broken audio firmwares
 
@@ -176,6 +184,8 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     int  m_videoFpsDetect;
     float m_maxTempo;
     bool m_videoPreferStereoStream = false;
+    bool m_videoDmaUpload = false; // decode software frames into dma-buf buffers
+    bool m_videoPrerenderSubtitles = true; // render libass subtitles ahead on a worker thread
 
     std::string m_videoDefaultPlayer;
     float m_videoPlayCountMinimumPercent;
@@ -347,7 +357,9 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     int32_t m_guiAnisotropicFiltering{0};
     bool m_guiFrontToBackRendering{false};
     bool m_guiGeometryClear{true};
+    bool m_guiBatchQuads{true};
     bool m_guiAsyncTextureUpload{false};
+    bool m_guiParallelProcess{false};
     bool m_guiVideoLayoutTransparent{false};
 
     unsigned int m_addonPackageFolderSize;
@@ -7,6 +7,7 @@
  */
 
 #include "FileItem.h"
+#include "FileItemList.h"
 #include "ServiceBroker.h"
 #include "URL.h"
 #include "settings/AdvancedSettings.h"
@@ -139,3 +140,47 @@ TEST_P(TestFileItemMovieName, GetMovieName)
 }
 
 INSTANTIATE_TEST_SUITE_P(NameMovies, TestFileItemMovieName, ValuesIn(BaseNames));
+
+namespace
+{
+void AddSortedByLabel(CFileItemList& items, const std::vector<std::string>& labels)
+{
+  for (const std::string& label : labels)
+  {
+    auto item = std::make_shared<CFileItem>(label);
+    item->SetPath("/" + label);
+    items.Add(item);
+  }
+  items.Sort(SortByLabel, SortOrderAscending);
+}
+
+std::vector<std::string> Labels(const CFileItemList& items)
+{
+  std::vector<std::string> labels;
+  for (const auto& item : items)
+    labels.emplace_back(item->GetLabel());
+  return labels;
+}
+} // unnamed namespace
+
+TEST(TestFileItemList, Merge)
+{
+  CFileItemList items;
+  CFileItemList batch;
+  AddSortedByLabel(batch, {"f", "B", "d"});
+  items.Merge(batch);
+  EXPECT_EQ(SortByLabel, items.GetSortMethod());
+  EXPECT_EQ(std::vector<std::string>({"B", "d", "f"}), Labels(items));
+
+  CFileItemList nextBatch;
+  AddSortedByLabel(nextBatch, {"g", "c", "a", "Track 10", "e", "Track 2"});
+  items.Merge(nextBatch);
+  EXPECT_EQ(std::vector<std::string>({"a", "B", "c", "d", "e", "f", "g", "Track 2", "Track 10"}),
+            Labels(items));
+
+  // items sorted differently are appended
+  CFileItemList unsorted;
+  unsorted.Add(std::make_shared<CFileItem>("0"));
+  items.Merge(unsorted);
+  EXPECT_EQ("0", items.Get(items.Size() - 1)->GetLabel());
+}
@@ -0,0 +1,233 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "DatabaseColumns.h"
+
+#include "dbwrappers/qry_dat.h"
+#include "utils/StringUtils.h"
+#include "utils/Variant.h"
+#include "utils/log.h"
+
+#include <cstdlib>
+
+namespace
+{
+CDatabaseColumns::Type GetColumnType(const dbiplus::field_value& value)
+{
+  switch (value.get_fType())
+  {
+    using enum dbiplus::fType;
+    case ft_String:
+    case ft_WideString:
+    case ft_Object:
+    case ft_Char:
+    case ft_WChar:
+      return CDatabaseColumns::Type::STRING;
+    case ft_Boolean:
+    case ft_Short:
+    case ft_UShort:
+    case ft_Int:
+    case ft_UInt:
+    case ft_Int64:
+      return CDatabaseColumns::Type::INTEGER;
+    case ft_Float:
+    case ft_Double:
+    case ft_LongDouble:
+      return CDatabaseColumns::Type::DOUBLE;
+  }
+
+  return CDatabaseColumns::Type::STRING;
+}
+} // unnamed namespace
+
+bool CDatabaseColumns::Load(const MediaType& mediaType,
+                            const FieldList& fields,
+                            const dbiplus::result_set& resultSet,
+                            const DatabaseResults& order)
+{
+  Clear();
+
+  std::vector<const dbiplus::sql_record*> records;
+  records.reserve(order.size());
+  for (const auto& result : order)
+  {
+    const auto row = result.find(FieldRow);
+    if (row == result.end() || row->second.asUnsignedInteger() >= resultSet.records.size())
+      return false;
+
+    records.emplace_back(resultSet.records[row->second.asUnsignedInteger()]);
+  }
+
+  m_columnIndex.assign(FieldMax, -1);
+  m_columns.reserve(fields.size());
+  for (const Field field : fields)
+  {
+    const int index = DatabaseUtils::GetFieldIndex(field, mediaType);
+    if (index < 0 || static_cast<size_t>(index) >= resultSet.record_header.size())
+    {
+      CLog::Log(LOGERROR, "CDatabaseColumns: field {} is not part of the {} result", field,
+                mediaType);
+      Clear();
+      return false;
+    }
+
+    if (m_columnIndex[field] >= 0)
+      continue;
+
+    m_columnIndex[field] = static_cast<int>(m_columns.size());
+    Column& column = m_columns.emplace_back();
+
+    // the first value decides about the type of the column, the others are converted to it
+    for (const auto* record : records)
+    {
+      const dbiplus::field_value& value = record->at(index);
+      if (!value.get_isNull())
+      {
+        column.type = GetColumnType(value);
+        break;
+      }
+    }
+
+    column.nulls.reserve(records.size());
+    switch (column.type)
+    {
+      case Type::INTEGER:
+        column.integers.reserve(records.size());
+        break;
+      case Type::DOUBLE:
+        column.doubles.reserve(records.size());
+        break;
+      case Type::STRING:
+        column.strings.reserve(records.size());
+        break;
+      case Type::NONE:
+        break;
+    }
+
+    for (const auto* record : records)
+    {
+      const dbiplus::field_value& value = record->at(index);
+      const bool null = value.get_isNull();
+      column.nulls.push_back(null);
+      switch (column.type)
+      {
+        case Type::INTEGER:
+          column.integers.push_back(null ? 0 : value.get_asInt64());
+          break;
+        case Type::DOUBLE:
+          column.doubles.push_back(null ? 0.0 : value.get_asDouble());
+          break;
+        case Type::STRING:
+          column.strings.push_back(AddString(null ? std::string_view() : value.get_asString()));
+          break;
+        case Type::NONE:
+          break;
+      }
+    }
+  }
+
+  m_rows = records.size();
+  return true;
+}
+
+void CDatabaseColumns::Clear()
+{
+  m_columns.clear();
+  m_columnIndex.clear();
+  m_rows = 0;
+  m_stringIds.clear();
+  m_strings.clear();
+}
+
+bool CDatabaseColumns::HasField(Field field) const
+{
+  return GetColumn(field) != nullptr;
+}
+
+CDatabaseColumns::Type CDatabaseColumns::GetType(Field field) const
+{
+  const Column* column = GetColumn(field);
+  return column ? column->type : Type::NONE;
+}
+
+bool CDatabaseColumns::IsNull(size_t row, Field field) const
+{
+  const Column* column = GetColumn(field);
+  return column == nullptr || row >= m_rows || column->nulls[row];
+}
+
+int64_t CDatabaseColumns::GetInteger(size_t row, Field field) const
+{
+  const Column* column = GetColumn(field);
+  if (column == nullptr || row >= m_rows)
+    return 0;
+
+  switch (column->type)
+  {
+    case Type::INTEGER:
+      return column->integers[row];
+    case Type::DOUBLE:
+      return static_cast<int64_t>(column->doubles[row]);
+    case Type::STRING:
+      return std::strtoll(m_strings[column->strings[row]].c_str(), nullptr, 10);
+    case Type::NONE:
+      break;
+  }
+
+  return 0;
+}
+
+double CDatabaseColumns::GetDouble(size_t row, Field field) const
+{
+  const Column* column = GetColumn(field);
+  if (column == nullptr || row >= m_rows)
+    return 0.0;
+
+  switch (column->type)
+  {
+    case Type::INTEGER:
+      return static_cast<double>(column->integers[row]);
+    case Type::DOUBLE:
+      return column->doubles[row];
+    case Type::STRING:
+      return std::strtod(m_strings[column->strings[row]].c_str(), nullptr);
+    case Type::NONE:
+      break;
+  }
+
+  return 0.0;
+}
+
+const std::string& CDatabaseColumns::GetString(size_t row, Field field) const
+{
+  const Column* column = GetColumn(field);
+  if (column == nullptr || row >= m_rows || column->type != Type::STRING)
+    return StringUtils::Empty;
+
+  return m_strings[column->strings[row]];
+}
+
+const CDatabaseColumns::Column* CDatabaseColumns::GetColumn(Field field) const
+{
+  if (field < 0 || static_cast<size_t>(field) >= m_columnIndex.size() || m_columnIndex[field] < 0)
+    return nullptr;
+
+  return &m_columns[m_columnIndex[field]];
+}
+
+uint32_t CDatabaseColumns::AddString(std::string_view value)
+{
+  const auto it = m_stringIds.find(value);
+  if (it != m_stringIds.end())
+    return it->second;
+
+  const auto id = static_cast<uint32_t>(m_strings.size());
+  const std::string& stored = m_strings.emplace_back(value);
+  m_stringIds.emplace(stored, id);
+  return id;
+}
@@ -0,0 +1,92 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "utils/DatabaseUtils.h"
+
+#include <deque>
+#include <stdint.h>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace dbiplus
+{
+class result_set;
+}
+
+/*!
+ \brief Column oriented, read-only copy of some fields of a database query result.
+
+ Every field is stored in a single typed column (integers, floats or strings) instead of a
+ CVariant per value, and equal strings (genres, ratings, paths...) are only stored once. This keeps
+ large results compact and lets callers like JSON-RPC read values without creating a CFileItem per
+ row.
+ */
+class CDatabaseColumns
+{
+public:
+  enum class Type
+  {
+    NONE, ///< the column only contains NULL values
+    INTEGER,
+    DOUBLE,
+    STRING,
+  };
+
+  /*!
+   \brief Copy the given fields of a query result.
+   \param mediaType the media type used to look up the column of each field.
+   \param fields the fields to copy.
+   \param resultSet the result of the query.
+   \param order the rows to copy in this order, identified by their FieldRow. As returned by
+   SortUtils::SortFromDataset().
+   \return false if a field isn't part of the result.
+   */
+  bool Load(const MediaType& mediaType,
+            const FieldList& fields,
+            const dbiplus::result_set& resultSet,
+            const DatabaseResults& order);
+  void Clear();
+
+  size_t Size() const { return m_rows; }
+  bool HasField(Field field) const;
+  Type GetType(Field field) const;
+
+  bool IsNull(size_t row, Field field) const;
+  int64_t GetInteger(size_t row, Field field) const;
+  double GetDouble(size_t row, Field field) const;
+  const std::string& GetString(size_t row, Field field) const;
+
+  /*!
+   \brief Number of distinct strings stored for all columns.
+   */
+  size_t GetStringCount() const { return m_strings.size(); }
+
+private:
+  struct Column
+  {
+    Type type = Type::NONE;
+    std::vector<int64_t> integers;
+    std::vector<double> doubles;
+    std::vector<uint32_t> strings; ///< index into m_strings
+    std::vector<bool> nulls;
+  };
+
+  const Column* GetColumn(Field field) const;
+  uint32_t AddString(std::string_view value);
+
+  std::vector<Column> m_columns;
+  std::vector<int> m_columnIndex; ///< column of each Field, -1 if not loaded
+  size_t m_rows = 0;
+
+  std::deque<std::string> m_strings; ///< deque so that the keys of m_stringIds stay valid
+  std::unordered_map<std::string_view, uint32_t> m_stringIds;
+};
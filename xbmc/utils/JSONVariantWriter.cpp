@@ -8,78 +8,296 @@
 
 #include "JSONVariantWriter.h"
 
-#include "utils/Variant.h"
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstring>
 
 #include <nlohmann/json.hpp>
 
-void InternalWrite(nlohmann::json& writer, const CVariant& value)
+namespace
 {
-  switch (value.type())
+// the length of the UTF-8 sequence starting with the given byte if the sequence is well-formed,
+// otherwise 0
+size_t GetUtf8SequenceLength(const unsigned char* str, size_t length)
+{
+  const unsigned char c = str[0];
+  size_t size;
+  unsigned char min = 0x80;
+  unsigned char max = 0xBF;
+  if (c < 0x80)
+    return 1;
+  else if (c >= 0xC2 && c <= 0xDF)
+    size = 2;
+  else if (c >= 0xE0 && c <= 0xEF)
   {
-  case CVariant::VariantTypeInteger:
-    writer = value.asInteger();
-    break;
-  case CVariant::VariantTypeUnsignedInteger:
-    writer = value.asUnsignedInteger();
-    break;
-  case CVariant::VariantTypeDouble:
-    writer = value.asDouble();
-    break;
-  case CVariant::VariantTypeBoolean:
-    writer = value.asBoolean();
-    break;
-  case CVariant::VariantTypeString:
-    writer = std::string(value.c_str(), value.size());
-    break;
-  case CVariant::VariantTypeArray:
-    writer = nlohmann::json::array();
-
-    for (CVariant::const_iterator_array itr = value.begin_array(); itr != value.end_array(); ++itr)
-    {
-      nlohmann::json& o = writer.emplace_back();
-      InternalWrite(o, *itr);
-    }
+    size = 3;
+    if (c == 0xE0)
+      min = 0xA0; // overlong
+    else if (c == 0xED)
+      max = 0x9F; // surrogates
+  }
+  else if (c >= 0xF0 && c <= 0xF4)
+  {
+    size = 4;
+    if (c == 0xF0)
+      min = 0x90; // overlong
+    else if (c == 0xF4)
+      max = 0x8F; // above U+10FFFF
+  }
+  else
+    return 0;
+
+  if (length < size || str[1] < min || str[1] > max)
+    return 0;
+  for (size_t i = 2; i < size; ++i)
+  {
+    if (str[i] < 0x80 || str[i] > 0xBF)
+      return 0;
+  }
+
+  return size;
+}
+} // unnamed namespace
 
-    break;
-  case CVariant::VariantTypeObject:
-    writer = nlohmann::json::object();
+bool CJSONVariantWriter::Write(const CVariant &value, std::string& output, bool compact)
+{
+  CJSONVariantStreamWriter writer(value, compact);
 
-    for (CVariant::const_iterator_map itr = value.begin_map(); itr != value.end_map(); ++itr)
+  std::string json;
+  while (writer.WriteNext(json))
+    ;
+
+  if (writer.HasError())
+    return false;
+
+  output = std::move(json);
+  return true;
+}
+
+CJSONVariantStreamWriter::CJSONVariantStreamWriter(const CVariant& value, bool compact)
+  : m_compact(compact), m_next(&value)
+{
+}
+
+size_t CJSONVariantStreamWriter::Read(char* buffer, size_t size)
+{
+  while (m_pending.size() - m_pendingOffset < size && WriteNext(m_pending))
+    ;
+
+  if (m_error)
+    return 0;
+
+  const size_t length = std::min(size, m_pending.size() - m_pendingOffset);
+  std::memcpy(buffer, m_pending.data() + m_pendingOffset, length);
+  m_pendingOffset += length;
+
+  // drop what has been read so that the pending part never grows beyond one chunk and token
+  if (m_pendingOffset >= m_pending.size())
+  {
+    m_pending.clear();
+    m_pendingOffset = 0;
+  }
+  else if (m_pendingOffset >= size)
+  {
+    m_pending.erase(0, m_pendingOffset);
+    m_pendingOffset = 0;
+  }
+
+  return length;
+}
+
+bool CJSONVariantStreamWriter::WriteNext(std::string& output)
+{
+  if (m_done || m_error)
+    return false;
+
+  if (m_next != nullptr)
+  {
+    const CVariant* value = m_next;
+    m_next = nullptr;
+    WriteValue(*value, output);
+  }
+  else
+  {
+    Frame& frame = m_stack.back();
+    const bool isArray = frame.value->isArray();
+    if (isArray ? frame.array == frame.value->end_array() : frame.map == frame.value->end_map())
     {
-      nlohmann::json& o = writer[itr->first];
-      InternalWrite(o, itr->second);
+      m_stack.pop_back();
+      if (!m_compact)
+      {
+        output += '\n';
+        WriteIndent(output);
+      }
+      output += isArray ? ']' : '}';
     }
+    else
+    {
+      if (!frame.first)
+        output += ',';
+      frame.first = false;
 
-    break;
+      if (!m_compact)
+      {
+        output += '\n';
+        WriteIndent(output);
+      }
 
-  case CVariant::VariantTypeConstNull:
-  case CVariant::VariantTypeNull:
-  default:
-    writer = nullptr;
-    break;
+      if (isArray)
+        m_next = &*frame.array++;
+      else
+      {
+        if (!WriteString(frame.map->first.c_str(), frame.map->first.size(), output))
+          return false;
+        output += m_compact ? ":" : ": ";
+        m_next = &frame.map->second;
+        ++frame.map;
+      }
+    }
   }
+
+  if (m_error)
+    return false;
+
+  if (m_next == nullptr && m_stack.empty())
+    m_done = true;
+
+  return true;
 }
 
-bool CJSONVariantWriter::Write(const CVariant &value, std::string& output, bool compact)
+void CJSONVariantStreamWriter::WriteValue(const CVariant& value, std::string& output)
 {
-  try
+  switch (value.type())
   {
-    nlohmann::json json;
-    InternalWrite(json, value);
-
-    if (compact)
+    case CVariant::VariantTypeInteger:
+    case CVariant::VariantTypeUnsignedInteger:
     {
-      output = json.dump();
+      std::array<char, 24> buffer;
+      const auto result =
+          value.isInteger()
+              ? std::to_chars(buffer.data(), buffer.data() + buffer.size(), value.asInteger())
+              : std::to_chars(buffer.data(), buffer.data() + buffer.size(),
+                              value.asUnsignedInteger());
+      output.append(buffer.data(), static_cast<size_t>(result.ptr - buffer.data()));
+      break;
     }
-    else
+    case CVariant::VariantTypeDouble:
     {
-      output = json.dump(1, '\t');
+      const double number = value.asDouble();
+      if (!std::isfinite(number))
+      {
+        output += "null";
+        break;
+      }
+
+      // use the same shortest round-trip format as nlohmann::json
+      std::array<char, 64> buffer;
+      const char* end =
+          nlohmann::detail::to_chars(buffer.data(), buffer.data() + buffer.size(), number);
+      output.append(buffer.data(), static_cast<size_t>(end - buffer.data()));
+      break;
     }
+    case CVariant::VariantTypeBoolean:
+      output += value.asBoolean() ? "true" : "false";
+      break;
+    case CVariant::VariantTypeString:
+      WriteString(value.c_str(), value.size(), output);
+      break;
+    case CVariant::VariantTypeArray:
+      if (value.empty())
+        output += "[]";
+      else
+      {
+        output += '[';
+        m_stack.push_back({&value, value.begin_array(), {}});
+      }
+      break;
+    case CVariant::VariantTypeObject:
+      if (value.empty())
+        output += "{}";
+      else
+      {
+        output += '{';
+        m_stack.push_back({&value, {}, value.begin_map()});
+      }
+      break;
+
+    case CVariant::VariantTypeConstNull:
+    case CVariant::VariantTypeNull:
+    default:
+      output += "null";
+      break;
   }
-  catch (nlohmann::json::exception& e)
+}
+
+bool CJSONVariantStreamWriter::WriteString(const char* str, size_t length, std::string& output)
+{
+  static constexpr char HEX[] = "0123456789abcdef";
+
+  output += '"';
+  const auto* data = reinterpret_cast<const unsigned char*>(str);
+  size_t plain = 0; // start of the characters which don't need to be escaped
+  for (size_t i = 0; i < length;)
   {
-    return false;
+    const unsigned char c = data[i];
+    if (c >= 0x80)
+    {
+      const size_t size = GetUtf8SequenceLength(data + i, length - i);
+      if (size == 0)
+      {
+        m_error = true;
+        return false;
+      }
+      i += size;
+      continue;
+    }
+    if (c >= 0x20 && c != '"' && c != '\\')
+    {
+      ++i;
+      continue;
+    }
+
+    output.append(str + plain, i - plain);
+    switch (c)
+    {
+      case '"':
+        output += "\\\"";
+        break;
+      case '\\':
+        output += "\\\\";
+        break;
+      case '\b':
+        output += "\\b";
+        break;
+      case '\f':
+        output += "\\f";
+        break;
+      case '\n':
+        output += "\\n";
+        break;
+      case '\r':
+        output += "\\r";
+        break;
+      case '\t':
+        output += "\\t";
+        break;
+      default:
+        output += "\\u00";
+        output += HEX[c >> 4];
+        output += HEX[c & 0xF];
+        break;
+    }
+    plain = ++i;
   }
+  output.append(str + plain, length - plain);
+  output += '"';
 
   return true;
 }
+
+void CJSONVariantStreamWriter::WriteIndent(std::string& output) const
+{
+  output.append(m_stack.size(), '\t');
+}
@@ -8,9 +8,11 @@
 
 #pragma once
 
-#include <string>
+#include "utils/Variant.h"
 
-class CVariant;
+#include <stddef.h>
+#include <string>
+#include <vector>
 
 class CJSONVariantWriter
 {
@@ -19,3 +21,59 @@ public:
 
   static bool Write(const CVariant &value, std::string& output, bool compact);
 };
+
+/*!
+ \brief Serializes a CVariant to JSON piece by piece.
+
+ The JSON is written straight from the CVariant without building another tree or the whole JSON
+ string first, so a response can be handed to a socket or HTTP connection in chunks of bounded
+ size. The output is the same as the one of CJSONVariantWriter::Write().
+
+ The CVariant must not be changed or destroyed while it is being written.
+ */
+class CJSONVariantStreamWriter
+{
+public:
+  CJSONVariantStreamWriter(const CVariant& value, bool compact);
+
+  /*!
+   \brief Write the next part of the JSON into the given buffer.
+   \return the number of bytes written, 0 once the whole JSON has been written or on error.
+   */
+  size_t Read(char* buffer, size_t size);
+
+  /*!
+   \brief Append the next token (a value, bracket or key) of the JSON to the given string.
+   \return false once the whole JSON has been written or on error.
+   */
+  bool WriteNext(std::string& output);
+
+  bool IsDone() const { return m_done && m_pendingOffset >= m_pending.size(); }
+
+  /*!
+   \brief Whether a string could not be written because it isn't valid UTF-8.
+   */
+  bool HasError() const { return m_error; }
+
+private:
+  struct Frame
+  {
+    const CVariant* value;
+    CVariant::const_iterator_array array;
+    CVariant::const_iterator_map map;
+    bool first = true;
+  };
+
+  void WriteValue(const CVariant& value, std::string& output);
+  bool WriteString(const char* str, size_t length, std::string& output);
+  void WriteIndent(std::string& output) const;
+
+  bool m_compact;
+  const CVariant* m_next;
+  std::vector<Frame> m_stack;
+  bool m_done = false;
+  bool m_error = false;
+
+  std::string m_pending; ///< written but not yet read part of the JSON
+  size_t m_pendingOffset = 0;
+};
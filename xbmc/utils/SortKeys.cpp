@@ -0,0 +1,329 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "SortKeys.h"
+
+#include "ServiceBroker.h"
+#include "threads/Event.h"
+#include "utils/JobManager.h"
+#include "utils/StringUtils.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <thread>
+#include <unordered_map>
+
+namespace
+{
+// the class of a token is stored in the upper bits so that symbols sort above everything else and
+// numbers between the characters that collate before and after digits
+constexpr unsigned int CLASS_SHIFT = 61;
+constexpr uint64_t CLASS_SYMBOL = 0;
+constexpr uint64_t CLASS_BEFORE_DIGITS = 1;
+constexpr uint64_t CLASS_NUMBER = 2;
+constexpr uint64_t CLASS_AFTER_DIGITS = 3;
+constexpr uint64_t CLASS_UNRESOLVED = 4; ///< character which hasn't been replaced by its weight yet
+constexpr uint64_t VALUE_MASK = (uint64_t{1} << CLASS_SHIFT) - 1;
+
+// StringUtils::AlphaNumericCompare() only looks at up to 15 digits at a time
+constexpr size_t MAX_DIGITS = 15;
+
+// numbers leave room below them for the characters which collate between two digits
+constexpr unsigned int NUMBER_SHIFT = 11;
+constexpr uint64_t MAX_BETWEEN_DIGITS = (uint64_t{1} << NUMBER_SHIFT) - 1;
+
+constexpr uint64_t MakeToken(uint64_t tokenClass, uint64_t value)
+{
+  return (tokenClass << CLASS_SHIFT) | value;
+}
+
+constexpr bool IsDigit(wchar_t c)
+{
+  return c >= L'0' && c <= L'9';
+}
+
+constexpr bool IsSymbol(wchar_t c)
+{
+  // the ascii punctuation and symbols sorted above all other characters
+  return (c >= 32 && c < L'0') || (c > L'9' && c < L'A') || (c > L'Z' && c < L'a') ||
+         (c > L'z' && c < 128);
+}
+
+int Collate(wchar_t left, wchar_t right)
+{
+  const int64_t result = StringUtils::AlphaNumericCompare(std::wstring_view(&left, 1),
+                                                          std::wstring_view(&right, 1));
+  return result < 0 ? -1 : (result > 0 ? 1 : 0);
+}
+
+/*!
+ \brief Run tasks on the job manager and the calling thread.
+
+ The calling thread takes over every task which no worker has picked up yet, so it never waits for
+ a busy job manager and at most a few workers are used however many sorts run at the same time.
+ */
+void RunParallel(std::vector<std::function<void()>> tasks)
+{
+  struct State
+  {
+    std::vector<std::function<void()>> tasks;
+    std::atomic<size_t> next{0};
+    std::atomic<size_t> remaining;
+    CEvent done{true};
+  };
+
+  auto state = std::make_shared<State>();
+  state->tasks = std::move(tasks);
+  state->remaining = state->tasks.size();
+
+  // jobs which start after all tasks were taken only see the tasks of their own call, which are
+  // used up, and return right away
+  const auto run = [](const std::shared_ptr<State>& state)
+  {
+    for (size_t task = state->next++; task < state->tasks.size(); task = state->next++)
+    {
+      state->tasks[task]();
+      if (--state->remaining == 0)
+        state->done.Set();
+    }
+  };
+
+  const auto jobManager = CServiceBroker::GetJobManager();
+  for (size_t task = 1; jobManager && task < state->tasks.size(); ++task)
+    jobManager->Submit([state, run]() { run(state); }, CJob::PRIORITY_HIGH);
+
+  run(state);
+  state->done.Wait();
+}
+} // unnamed namespace
+
+void CSortKeys::Reserve(size_t items, size_t characters)
+{
+  m_items.reserve(items);
+  m_tokens.reserve(characters);
+}
+
+void CSortKeys::Add(std::wstring_view label,
+                    Special special /* = Special::NONE */,
+                    Folder folder /* = Folder::UNKNOWN */)
+{
+  const size_t offset = m_tokens.size();
+  for (size_t i = 0; i < label.size();)
+  {
+    const wchar_t c = label[i];
+    if (IsDigit(c))
+    {
+      uint64_t number = 0;
+      const size_t end = std::min(label.size(), i + MAX_DIGITS);
+      for (; i < end && IsDigit(label[i]); ++i)
+        number = number * 10 + static_cast<uint64_t>(label[i] - L'0');
+      m_tokens.emplace_back(MakeToken(CLASS_NUMBER, number << NUMBER_SHIFT));
+      continue;
+    }
+
+    if (IsSymbol(c))
+    {
+      m_tokens.emplace_back(MakeToken(CLASS_SYMBOL, static_cast<uint64_t>(c)));
+    }
+    else
+    {
+      m_tokens.emplace_back(MakeToken(CLASS_UNRESOLVED, static_cast<uint32_t>(c)));
+      m_resolved = false;
+    }
+    ++i;
+  }
+
+  m_items.push_back({static_cast<uint32_t>(offset), static_cast<uint32_t>(m_tokens.size() - offset),
+                     special, folder});
+}
+
+std::vector<uint32_t> CSortKeys::Sort(bool descending, bool ignoreFolders, size_t limit /* = 0 */)
+{
+  if (!m_resolved)
+    ResolveCollation();
+
+  m_descending = descending;
+  m_ignoreFolders = ignoreFolders;
+
+  std::vector<uint32_t> order(m_items.size());
+  std::iota(order.begin(), order.end(), 0);
+
+  const auto less = [this](uint32_t left, uint32_t right) { return Less(left, right); };
+
+  if (limit > 0 && limit < order.size())
+  {
+    std::partial_sort(order.begin(), order.begin() + limit, order.end(), less);
+    order.resize(limit);
+    return order;
+  }
+
+  const size_t threads = std::min<size_t>(std::thread::hardware_concurrency(),
+                                          order.size() / (PARALLEL_THRESHOLD / 2));
+  if (order.size() < PARALLEL_THRESHOLD || threads < 2)
+  {
+    std::sort(order.begin(), order.end(), less);
+    return order;
+  }
+
+  // sort chunks in parallel and merge neighbouring chunks until one is left
+  std::vector<size_t> bounds;
+  for (size_t chunk = 0; chunk <= threads; ++chunk)
+    bounds.emplace_back(order.size() * chunk / threads);
+
+  std::vector<std::function<void()>> tasks;
+  for (size_t chunk = 0; chunk < threads; ++chunk)
+  {
+    tasks.emplace_back([&order, &bounds, &less, chunk]() {
+      std::sort(order.begin() + bounds[chunk], order.begin() + bounds[chunk + 1], less);
+    });
+  }
+  RunParallel(std::move(tasks));
+
+  while (bounds.size() > 2)
+  {
+    std::vector<std::function<void()>> merges;
+    std::vector<size_t> merged{0};
+    for (size_t chunk = 0; chunk + 2 < bounds.size(); chunk += 2)
+    {
+      const auto first = order.begin() + bounds[chunk];
+      const auto middle = order.begin() + bounds[chunk + 1];
+      const auto last = order.begin() + bounds[chunk + 2];
+      merges.emplace_back([first, middle, last, &less]() {
+        std::inplace_merge(first, middle, last, less);
+      });
+      merged.emplace_back(bounds[chunk + 2]);
+    }
+    // an odd chunk out is merged in the next round
+    if (merged.back() != order.size())
+      merged.emplace_back(order.size());
+
+    RunParallel(std::move(merges));
+    bounds = std::move(merged);
+  }
+
+  return order;
+}
+
+std::vector<uint32_t> CSortKeys::Merge(size_t middle, bool descending, bool ignoreFolders)
+{
+  if (!m_resolved)
+    ResolveCollation();
+
+  m_descending = descending;
+  m_ignoreFolders = ignoreFolders;
+
+  std::vector<uint32_t> order(m_items.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::inplace_merge(order.begin(), order.begin() + std::min(middle, order.size()), order.end(),
+                     [this](uint32_t left, uint32_t right) { return Less(left, right); });
+  return order;
+}
+
+void CSortKeys::ResolveCollation()
+{
+  // collect the distinct characters and order them by the collation of
+  // StringUtils::AlphaNumericCompare(), so that comparing their rank gives the same result
+  std::unordered_map<wchar_t, uint64_t> weights;
+  for (wchar_t digit = L'0'; digit <= L'9'; ++digit)
+    weights.try_emplace(digit, 0);
+  for (const uint64_t token : m_tokens)
+  {
+    if ((token >> CLASS_SHIFT) == CLASS_UNRESOLVED)
+      weights.try_emplace(static_cast<wchar_t>(token & VALUE_MASK), 0);
+  }
+
+  std::vector<wchar_t> characters;
+  characters.reserve(weights.size());
+  for (const auto& weight : weights)
+    characters.emplace_back(weight.first);
+
+  // sort by code point first so that equally collating characters get a stable order
+  std::sort(characters.begin(), characters.end());
+  std::stable_sort(characters.begin(), characters.end(),
+                   [](wchar_t left, wchar_t right) { return Collate(left, right) < 0; });
+
+  // characters which collate equally share a rank
+  std::vector<uint64_t> ranks(characters.size());
+  std::array<uint64_t, 10> digitRanks;
+  uint64_t rank = 0;
+  for (size_t i = 0; i < characters.size(); ++i)
+  {
+    if (i > 0 && Collate(characters[i - 1], characters[i]) != 0)
+      ++rank;
+    ranks[i] = rank;
+    if (IsDigit(characters[i]))
+      digitRanks[characters[i] - L'0'] = rank;
+  }
+
+  for (size_t i = 0; i < characters.size(); ++i)
+  {
+    // AlphaNumericCompare() compares a character with the first digit of a number
+    if (ranks[i] < digitRanks.front())
+    {
+      weights[characters[i]] = MakeToken(CLASS_BEFORE_DIGITS, ranks[i]);
+    }
+    else if (ranks[i] > digitRanks.back())
+    {
+      weights[characters[i]] = MakeToken(CLASS_AFTER_DIGITS, ranks[i]);
+    }
+    else
+    {
+      // a character which collates with the digits (only possible with locale collation) goes
+      // right after the single digit number it follows, or equals the one it collates equal to.
+      // There is no consistent place relative to longer numbers: AlphaNumericCompare() has "10"
+      // before and "9" after a character collating between "1" and "2", though 9 < 10.
+      const auto digit = std::upper_bound(digitRanks.begin(), digitRanks.end(), ranks[i]) - 1;
+      const uint64_t between = std::min(ranks[i] - *digit, MAX_BETWEEN_DIGITS);
+      weights[characters[i]] = MakeToken(
+          CLASS_NUMBER,
+          (static_cast<uint64_t>(digit - digitRanks.begin()) << NUMBER_SHIFT) | between);
+    }
+  }
+
+  for (uint64_t& token : m_tokens)
+  {
+    if ((token >> CLASS_SHIFT) == CLASS_UNRESOLVED)
+      token = weights[static_cast<wchar_t>(token & VALUE_MASK)];
+  }
+
+  m_resolved = true;
+}
+
+bool CSortKeys::Less(uint32_t left, uint32_t right) const
+{
+  const Item& l = m_items[left];
+  const Item& r = m_items[right];
+
+  if (l.special != r.special)
+    return l.special == Special::ON_TOP || r.special == Special::ON_BOTTOM;
+
+  // items which are both on top or at the bottom keep their order
+  if (l.special == Special::NONE)
+  {
+    if (!m_ignoreFolders && l.folder != Folder::UNKNOWN && r.folder != Folder::UNKNOWN &&
+        l.folder != r.folder)
+      return l.folder == Folder::YES;
+
+    const uint64_t* leftToken = m_tokens.data() + l.offset;
+    const uint64_t* rightToken = m_tokens.data() + r.offset;
+    const uint32_t length = std::min(l.length, r.length);
+    for (uint32_t i = 0; i < length; ++i)
+    {
+      if (leftToken[i] != rightToken[i])
+        return (leftToken[i] < rightToken[i]) != m_descending;
+    }
+    if (l.length != r.length)
+      return (l.length < r.length) != m_descending;
+  }
+
+  return left < right;
+}
@@ -0,0 +1,95 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string_view>
+#include <vector>
+
+/*!
+ \brief Precomputed sort keys of a list of items.
+
+ Every sort label is split once into a contiguous array of tokens: numbers are stored as their
+ integer value and every other character as its collation weight. Comparing two keys then only
+ compares integers, but orders the labels exactly like StringUtils::AlphaNumericCompare() does.
+ The only exception are characters which a locale collates between two digits, for which
+ AlphaNumericCompare() isn't a consistent order to begin with.
+
+ The order is total (ties are broken by the position the item was added at), so sorting the keys
+ gives the same result as a stable sort, even when sorting in parallel or partially.
+ */
+class CSortKeys
+{
+public:
+  enum class Special
+  {
+    NONE,
+    ON_TOP,
+    ON_BOTTOM,
+  };
+
+  enum class Folder
+  {
+    UNKNOWN,
+    NO,
+    YES,
+  };
+
+  void Reserve(size_t items, size_t characters);
+
+  /*!
+   \brief Add the sort key of the next item.
+   \param label the sort label of the item.
+   \param special whether the item stays on top or at the bottom regardless of its label.
+   \param folder whether the item is a folder, folders are sorted first unless ignored.
+   */
+  void Add(std::wstring_view label, Special special = Special::NONE, Folder folder = Folder::UNKNOWN);
+
+  size_t Size() const { return m_items.size(); }
+
+  /*!
+   \brief Get the sorted order of the added items.
+   \param descending sort the labels in descending order.
+   \param ignoreFolders don't sort folders first.
+   \param limit only the first limit positions need to be sorted, 0 to sort all items.
+   \return the indices of the items in sorted order, only the first limit ones if set.
+   */
+  std::vector<uint32_t> Sort(bool descending, bool ignoreFolders, size_t limit = 0);
+
+  /*!
+   \brief Get the sorted order of the added items, of which the ones before middle and the ones
+   from middle on are sorted already.
+   \param middle the index of the first item of the second sorted run.
+   \param descending sort the labels in descending order.
+   \param ignoreFolders don't sort folders first.
+   \return the indices of the items in sorted order, equal items of the first run come first.
+   */
+  std::vector<uint32_t> Merge(size_t middle, bool descending, bool ignoreFolders);
+
+  // inputs of at least this many items are sorted on multiple threads
+  static constexpr size_t PARALLEL_THRESHOLD = 16384;
+
+private:
+  struct Item
+  {
+    uint32_t offset;
+    uint32_t length;
+    Special special;
+    Folder folder;
+  };
+
+  void ResolveCollation();
+  bool Less(uint32_t left, uint32_t right) const;
+
+  std::vector<Item> m_items;
+  std::vector<uint64_t> m_tokens;
+  bool m_resolved = true;
+  bool m_descending = false;
+  bool m_ignoreFolders = false;
+};
@@ -10,6 +10,7 @@
 
 #include "LangInfo.h"
 #include "SortFileItem.h"
+#include "SortKeys.h"
 #include "URL.h"
 #include "Util.h"
 #include "utils/CharsetConverter.h"
@@ -509,132 +510,6 @@ std::string ByBPM(SortAttribute attributes, const SortItem& values)
                              ByLabel(attributes, values));
 }
 
-bool preliminarySort(const SortItem &left, const SortItem &right, bool handleFolder, bool &result, std::wstring &labelLeft, std::wstring &labelRight)
-{
-  // make sure both items have the necessary data to do the sorting
-  SortItem::const_iterator itLeftSort, itRightSort;
-  if ((itLeftSort = left.find(FieldSort)) == left.end())
-  {
-    result = false;
-    return true;
-  }
-  if ((itRightSort = right.find(FieldSort)) == right.end())
-  {
-    result = true;
-    return true;
-  }
-
-  // look at special sorting behaviour
-  SortItem::const_iterator itLeft, itRight;
-  SortSpecial leftSortSpecial = SortSpecialNone;
-  SortSpecial rightSortSpecial = SortSpecialNone;
-  if ((itLeft = left.find(FieldSortSpecial)) != left.end() && itLeft->second.asInteger() <= (int64_t)SortSpecialOnBottom)
-    leftSortSpecial = (SortSpecial)itLeft->second.asInteger();
-  if ((itRight = right.find(FieldSortSpecial)) != right.end() && itRight->second.asInteger() <= (int64_t)SortSpecialOnBottom)
-    rightSortSpecial = (SortSpecial)itRight->second.asInteger();
-
-  // one has a special sort
-  if (leftSortSpecial != rightSortSpecial)
-  {
-    // left should be sorted on top
-    // or right should be sorted on bottom
-    // => left is sorted above right
-    if (leftSortSpecial == SortSpecialOnTop ||
-        rightSortSpecial == SortSpecialOnBottom)
-    {
-      result = true;
-      return true;
-    }
-
-    // otherwise right is sorted above left
-    result = false;
-    return true;
-  }
-  // both have either sort on top or sort on bottom -> leave as-is
-  else if (leftSortSpecial != SortSpecialNone)
-  {
-    result = false;
-    return true;
-  }
-
-  if (handleFolder)
-  {
-    itLeft = left.find(FieldFolder);
-    itRight = right.find(FieldFolder);
-    if (itLeft != left.end() && itRight != right.end() &&
-        itLeft->second.asBoolean() != itRight->second.asBoolean())
-    {
-      result = itLeft->second.asBoolean();
-      return true;
-    }
-  }
-
-  labelLeft = itLeftSort->second.asWideString();
-  labelRight = itRightSort->second.asWideString();
-
-  return false;
-}
-
-bool SorterAscending(const SortItem &left, const SortItem &right)
-{
-  bool result;
-  std::wstring labelLeft, labelRight;
-  if (preliminarySort(left, right, true, result, labelLeft, labelRight))
-    return result;
-
-  return StringUtils::AlphaNumericCompare(labelLeft, labelRight) < 0;
-}
-
-bool SorterDescending(const SortItem &left, const SortItem &right)
-{
-  bool result;
-  std::wstring labelLeft, labelRight;
-  if (preliminarySort(left, right, true, result, labelLeft, labelRight))
-    return result;
-
-  return StringUtils::AlphaNumericCompare(labelLeft, labelRight) > 0;
-}
-
-bool SorterIgnoreFoldersAscending(const SortItem &left, const SortItem &right)
-{
-  bool result;
-  std::wstring labelLeft, labelRight;
-  if (preliminarySort(left, right, false, result, labelLeft, labelRight))
-    return result;
-
-  return StringUtils::AlphaNumericCompare(labelLeft, labelRight) < 0;
-}
-
-bool SorterIgnoreFoldersDescending(const SortItem &left, const SortItem &right)
-{
-  bool result;
-  std::wstring labelLeft, labelRight;
-  if (preliminarySort(left, right, false, result, labelLeft, labelRight))
-    return result;
-
-  return StringUtils::AlphaNumericCompare(labelLeft, labelRight) > 0;
-}
-
-bool SorterIndirectAscending(const SortItemPtr &left, const SortItemPtr &right)
-{
-  return SorterAscending(*left, *right);
-}
-
-bool SorterIndirectDescending(const SortItemPtr &left, const SortItemPtr &right)
-{
-  return SorterDescending(*left, *right);
-}
-
-bool SorterIndirectIgnoreFoldersAscending(const SortItemPtr &left, const SortItemPtr &right)
-{
-  return SorterIgnoreFoldersAscending(*left, *right);
-}
-
-bool SorterIndirectIgnoreFoldersDescending(const SortItemPtr &left, const SortItemPtr &right)
-{
-  return SorterIgnoreFoldersDescending(*left, *right);
-}
-
 // clang-format off
 std::map<SortBy, SortUtils::SortPreparator> fillPreparators()
 {
@@ -989,82 +864,110 @@ void SortUtils::GetFieldsForSQLSort(const MediaType& mediaType,
 }
 
 
-void SortUtils::Sort(SortBy sortBy, SortOrder sortOrder, SortAttribute attributes, DatabaseResults& items, int limitEnd /* = -1 */, int limitStart /* = 0 */)
+namespace
+{
+SortItem& GetSortItem(SortItem& item)
+{
+  return item;
+}
+
+SortItem& GetSortItem(const SortItemPtr& item)
+{
+  return *item;
+}
+
+template<typename Items>
+void SortAndLimit(SortUtils::SortPreparator preparator,
+                  const Fields& sortingFields,
+                  SortOrder sortOrder,
+                  SortAttribute attributes,
+                  Items& items,
+                  int limitEnd,
+                  int limitStart)
 {
-  if (sortBy != SortByNone)
+  size_t begin = 0;
+  size_t end = items.size();
+  if (limitStart > 0 && static_cast<size_t>(limitStart) < items.size())
   {
-    // get the matching SortPreparator
-    SortPreparator preparator = getPreparator(sortBy);
-    if (preparator != NULL)
-    {
-      Fields sortingFields = GetFieldsForSorting(sortBy);
-
-      // Prepare the string used for sorting and store it under FieldSort
-      for (DatabaseResults::iterator item = items.begin(); item != items.end(); ++item)
-      {
-        // add all fields to the item that are required for sorting if they are currently missing
-        for (Fields::const_iterator field = sortingFields.begin(); field != sortingFields.end(); ++field)
-        {
-          if (!item->contains(*field))
-            item->insert(std::pair<Field, CVariant>(*field, CVariant::ConstNullVariant));
-        }
-
-        std::wstring sortLabel;
-        g_charsetConverter.utf8ToW(preparator(attributes, *item), sortLabel, false);
-        item->insert(std::pair<Field, CVariant>(FieldSort, CVariant(sortLabel)));
-      }
-
-      // Do the sorting
-      std::stable_sort(items.begin(), items.end(), getSorter(sortOrder, attributes));
-    }
+    begin = static_cast<size_t>(limitStart);
+    limitEnd -= limitStart;
   }
+  if (limitEnd > 0 && static_cast<size_t>(limitEnd) < items.size() - begin)
+    end = begin + static_cast<size_t>(limitEnd);
 
-  if (limitStart > 0 && (size_t)limitStart < items.size())
+  if (preparator == nullptr)
   {
-    items.erase(items.begin(), items.begin() + limitStart);
-    limitEnd -= limitStart;
+    items.erase(items.begin() + end, items.end());
+    items.erase(items.begin(), items.begin() + begin);
+    return;
   }
-  if (limitEnd > 0 && (size_t)limitEnd < items.size())
-    items.erase(items.begin() + limitEnd, items.end());
-}
 
-void SortUtils::Sort(SortBy sortBy, SortOrder sortOrder, SortAttribute attributes, SortItems& items, int limitEnd /* = -1 */, int limitStart /* = 0 */)
-{
-  if (sortBy != SortByNone)
+  CSortKeys keys;
+  keys.Reserve(items.size(), items.size() * 32);
+
+  // Prepare the string used for sorting, store it under FieldSort and turn it into a sort key
+  for (auto& entry : items)
   {
-    // get the matching SortPreparator
-    SortPreparator preparator = getPreparator(sortBy);
-    if (preparator != NULL)
+    SortItem& item = GetSortItem(entry);
+
+    // add all fields to the item that are required for sorting if they are currently missing
+    for (const Field field : sortingFields)
     {
-      Fields sortingFields = GetFieldsForSorting(sortBy);
-
-      // Prepare the string used for sorting and store it under FieldSort
-      for (SortItems::iterator item = items.begin(); item != items.end(); ++item)
-      {
-        // add all fields to the item that are required for sorting if they are currently missing
-        for (Fields::const_iterator field = sortingFields.begin(); field != sortingFields.end(); ++field)
-        {
-          if (!(*item)->contains(*field))
-            (*item)->insert(std::pair<Field, CVariant>(*field, CVariant::ConstNullVariant));
-        }
-
-        std::wstring sortLabel;
-        g_charsetConverter.utf8ToW(preparator(attributes, **item), sortLabel, false);
-        (*item)->insert(std::pair<Field, CVariant>(FieldSort, CVariant(sortLabel)));
-      }
-
-      // Do the sorting
-      std::stable_sort(items.begin(), items.end(), getSorterIndirect(sortOrder, attributes));
+      if (!item.contains(field))
+        item.insert(std::pair<Field, CVariant>(field, CVariant::ConstNullVariant));
     }
-  }
 
-  if (limitStart > 0 && (size_t)limitStart < items.size())
-  {
-    items.erase(items.begin(), items.begin() + limitStart);
-    limitEnd -= limitStart;
+    CSortKeys::Special special = CSortKeys::Special::NONE;
+    SortItem::const_iterator it = item.find(FieldSortSpecial);
+    if (it != item.end() && it->second.asInteger() == SortSpecialOnTop)
+      special = CSortKeys::Special::ON_TOP;
+    else if (it != item.end() && it->second.asInteger() == SortSpecialOnBottom)
+      special = CSortKeys::Special::ON_BOTTOM;
+
+    CSortKeys::Folder folder = CSortKeys::Folder::UNKNOWN;
+    if ((it = item.find(FieldFolder)) != item.end())
+      folder = it->second.asBoolean() ? CSortKeys::Folder::YES : CSortKeys::Folder::NO;
+
+    // an already existing sort label is kept
+    if ((it = item.find(FieldSort)) != item.end())
+    {
+      keys.Add(it->second.asWideString(), special, folder);
+      continue;
+    }
+
+    std::wstring sortLabel;
+    g_charsetConverter.utf8ToW(preparator(attributes, item), sortLabel, false);
+    keys.Add(sortLabel, special, folder);
+    item.insert(std::pair<Field, CVariant>(FieldSort, CVariant(std::move(sortLabel))));
   }
-  if (limitEnd > 0 && (size_t)limitEnd < items.size())
-    items.erase(items.begin() + limitEnd, items.end());
+
+  // Do the sorting, only up to the last item that is kept
+  const std::vector<uint32_t> order =
+      keys.Sort(sortOrder == SortOrderDescending, attributes & SortAttributeIgnoreFolders,
+                end < items.size() ? end : 0);
+
+  Items sorted;
+  sorted.reserve(end - begin);
+  for (size_t i = begin; i < end; ++i)
+    sorted.emplace_back(std::move(items[order[i]]));
+  items = std::move(sorted);
+}
+} // unnamed namespace
+
+void SortUtils::Sort(SortBy sortBy, SortOrder sortOrder, SortAttribute attributes, DatabaseResults& items, int limitEnd /* = -1 */, int limitStart /* = 0 */)
+{
+  // get the matching SortPreparator
+  const SortPreparator preparator = sortBy != SortByNone ? getPreparator(sortBy) : nullptr;
+  SortAndLimit(preparator, GetFieldsForSorting(sortBy), sortOrder, attributes, items, limitEnd,
+               limitStart);
+}
+
+void SortUtils::Sort(SortBy sortBy, SortOrder sortOrder, SortAttribute attributes, SortItems& items, int limitEnd /* = -1 */, int limitStart /* = 0 */)
+{
+  // get the matching SortPreparator
+  const SortPreparator preparator = sortBy != SortByNone ? getPreparator(sortBy) : nullptr;
+  SortAndLimit(preparator, GetFieldsForSorting(sortBy), sortOrder, attributes, items, limitEnd,
+               limitStart);
 }
 
 void SortUtils::Sort(const SortDescription &sortDescription, DatabaseResults& items)
@@ -1110,22 +1013,6 @@ const SortUtils::SortPreparator& SortUtils::getPreparator(SortBy sortBy)
   return m_preparators[SortByNone];
 }
 
-SortUtils::Sorter SortUtils::getSorter(SortOrder sortOrder, SortAttribute attributes)
-{
-  if (attributes & SortAttributeIgnoreFolders)
-    return sortOrder == SortOrderDescending ? SorterIgnoreFoldersDescending : SorterIgnoreFoldersAscending;
-
-  return sortOrder == SortOrderDescending ? SorterDescending : SorterAscending;
-}
-
-SortUtils::SorterIndirect SortUtils::getSorterIndirect(SortOrder sortOrder, SortAttribute attributes)
-{
-  if (attributes & SortAttributeIgnoreFolders)
-    return sortOrder == SortOrderDescending ? SorterIndirectIgnoreFoldersDescending : SorterIndirectIgnoreFoldersAscending;
-
-  return sortOrder == SortOrderDescending ? SorterIndirectDescending : SorterIndirectAscending;
-}
-
 const Fields& SortUtils::GetFieldsForSorting(SortBy sortBy)
 {
   std::map<SortBy, Fields>::const_iterator it = m_sortingFields.find(sortBy);
@@ -0,0 +1,114 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "dbwrappers/qry_dat.h"
+#include "utils/DatabaseColumns.h"
+#include "utils/Variant.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+class TestDatabaseColumns : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    const int columns = DatabaseUtils::GetFieldIndex(FieldRating, MediaTypeMovie) + 1;
+    m_resultSet.record_header.resize(columns);
+
+    AddMovie(1, "Movie A", "PG", 7.5);
+    AddMovie(2, "Movie B", "PG", 6.0);
+    AddMovie(3, "Movie C", "", 0.0, true);
+  }
+
+  void AddMovie(int id, const char* title, const char* mpaa, double rating, bool nulls = false)
+  {
+    auto* record = new dbiplus::sql_record(m_resultSet.record_header.size());
+    record->at(0) = dbiplus::field_value(id);
+    record->at(DatabaseUtils::GetFieldIndex(FieldTitle, MediaTypeMovie)) =
+        dbiplus::field_value(title);
+    record->at(DatabaseUtils::GetFieldIndex(FieldMPAA, MediaTypeMovie)) =
+        dbiplus::field_value(mpaa);
+
+    dbiplus::field_value& value =
+        record->at(DatabaseUtils::GetFieldIndex(FieldRating, MediaTypeMovie));
+    value = dbiplus::field_value(rating);
+    if (nulls)
+      value.set_isNull();
+
+    m_resultSet.records.emplace_back(record);
+  }
+
+  DatabaseResults Order(std::initializer_list<int> rows)
+  {
+    DatabaseResults order;
+    for (const int row : rows)
+    {
+      DatabaseResult result;
+      result[FieldRow] = row;
+      order.emplace_back(result);
+    }
+    return order;
+  }
+
+  dbiplus::result_set m_resultSet;
+};
+} // unnamed namespace
+
+TEST_F(TestDatabaseColumns, Load)
+{
+  CDatabaseColumns columns;
+  ASSERT_TRUE(columns.Load(MediaTypeMovie, {FieldId, FieldTitle, FieldMPAA, FieldRating},
+                           m_resultSet, Order({2, 0, 1})));
+
+  ASSERT_EQ(3u, columns.Size());
+  EXPECT_EQ(CDatabaseColumns::Type::INTEGER, columns.GetType(FieldId));
+  EXPECT_EQ(CDatabaseColumns::Type::STRING, columns.GetType(FieldTitle));
+  EXPECT_EQ(CDatabaseColumns::Type::DOUBLE, columns.GetType(FieldRating));
+
+  // rows are in the requested order
+  EXPECT_EQ(3, columns.GetInteger(0, FieldId));
+  EXPECT_EQ(1, columns.GetInteger(1, FieldId));
+  EXPECT_EQ(2, columns.GetInteger(2, FieldId));
+  EXPECT_EQ("Movie C", columns.GetString(0, FieldTitle));
+  EXPECT_EQ("Movie A", columns.GetString(1, FieldTitle));
+
+  EXPECT_TRUE(columns.IsNull(0, FieldRating));
+  EXPECT_DOUBLE_EQ(0.0, columns.GetDouble(0, FieldRating));
+  EXPECT_FALSE(columns.IsNull(1, FieldRating));
+  EXPECT_DOUBLE_EQ(7.5, columns.GetDouble(1, FieldRating));
+
+  // conversions between the column types
+  EXPECT_EQ(7, columns.GetInteger(1, FieldRating));
+  EXPECT_DOUBLE_EQ(2.0, columns.GetDouble(2, FieldId));
+  EXPECT_EQ("", columns.GetString(1, FieldId));
+}
+
+TEST_F(TestDatabaseColumns, StringsAreStoredOnce)
+{
+  CDatabaseColumns columns;
+  ASSERT_TRUE(columns.Load(MediaTypeMovie, {FieldTitle, FieldMPAA}, m_resultSet, Order({0, 1, 2})));
+
+  // three titles, "PG" and ""
+  EXPECT_EQ(5u, columns.GetStringCount());
+  EXPECT_EQ("PG", columns.GetString(0, FieldMPAA));
+  EXPECT_EQ("PG", columns.GetString(1, FieldMPAA));
+  EXPECT_EQ("", columns.GetString(2, FieldMPAA));
+}
+
+TEST_F(TestDatabaseColumns, MissingField)
+{
+  CDatabaseColumns columns;
+  EXPECT_FALSE(columns.HasField(FieldTitle));
+  EXPECT_FALSE(columns.Load(MediaTypeMovie, {FieldTitle, FieldAlbum}, m_resultSet, Order({0})));
+  EXPECT_EQ(0u, columns.Size());
+
+  // rows which aren't part of the result
+  EXPECT_FALSE(columns.Load(MediaTypeMovie, {FieldTitle}, m_resultSet, Order({3})));
+}
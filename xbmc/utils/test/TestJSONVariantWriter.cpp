@@ -149,3 +149,64 @@ TEST(TestJSONVariantWriter, CanWriteArray)
   ASSERT_TRUE(CJSONVariantWriter::Write(variant, str, false));
   ASSERT_STREQ("[\n\t{\n\t\t\"foo\": \"bar\"\n\t}\n]", str.c_str());
 }
+
+TEST(TestJSONVariantWriter, CanWriteCompact)
+{
+  CVariant variant(CVariant::VariantTypeObject);
+  variant["foo"].push_back(1);
+  variant["foo"].push_back(CVariant(CVariant::VariantTypeObject));
+  variant["bar"] = 0.5;
+  std::string str;
+  ASSERT_TRUE(CJSONVariantWriter::Write(variant, str, true));
+  ASSERT_STREQ("{\"bar\":0.5,\"foo\":[1,{}]}", str.c_str());
+}
+
+TEST(TestJSONVariantWriter, CanEscapeString)
+{
+  CVariant variant("\"quoted\" \\ \b\f\n\r\t \x01\x1f / \xc3\xa9");
+  std::string str;
+  ASSERT_TRUE(CJSONVariantWriter::Write(variant, str, true));
+  ASSERT_STREQ("\"\\\"quoted\\\" \\\\ \\b\\f\\n\\r\\t \\u0001\\u001f / \xc3\xa9\"", str.c_str());
+}
+
+TEST(TestJSONVariantWriter, FailsOnInvalidUtf8)
+{
+  CVariant variant(CVariant::VariantTypeArray);
+  variant.push_back("foo");
+  variant.push_back("\xc3");
+  std::string str = "unchanged";
+  ASSERT_FALSE(CJSONVariantWriter::Write(variant, str, true));
+  ASSERT_STREQ("unchanged", str.c_str());
+
+  variant[1] = "\xed\xa0\x80"; // surrogate
+  ASSERT_FALSE(CJSONVariantWriter::Write(variant, str, true));
+}
+
+TEST(TestJSONVariantWriter, CanStreamInChunks)
+{
+  CVariant variant(CVariant::VariantTypeObject);
+  for (int i = 0; i < 100; i++)
+  {
+    CVariant item(CVariant::VariantTypeObject);
+    item["id"] = i;
+    item["label"] = "item " + std::to_string(i);
+    variant["items"].push_back(item);
+  }
+
+  std::string expected;
+  ASSERT_TRUE(CJSONVariantWriter::Write(variant, expected, false));
+
+  CJSONVariantStreamWriter writer(variant, false);
+  std::string streamed;
+  char buffer[7];
+  size_t size;
+  while ((size = writer.Read(buffer, sizeof(buffer))) > 0)
+  {
+    ASSERT_LE(size, sizeof(buffer));
+    streamed.append(buffer, size);
+  }
+
+  EXPECT_TRUE(writer.IsDone());
+  EXPECT_FALSE(writer.HasError());
+  EXPECT_EQ(expected, streamed);
+}
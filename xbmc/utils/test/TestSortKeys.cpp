@@ -0,0 +1,143 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/SortKeys.h"
+#include "utils/StringUtils.h"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+std::vector<std::wstring> Sorted(const std::vector<std::wstring>& labels, bool descending = false)
+{
+  CSortKeys keys;
+  for (const auto& label : labels)
+    keys.Add(label);
+
+  std::vector<std::wstring> sorted;
+  for (const uint32_t index : keys.Sort(descending, false))
+    sorted.emplace_back(labels[index]);
+  return sorted;
+}
+
+std::vector<std::wstring> RandomLabels(size_t count)
+{
+  static const std::wstring characters = L"aAbBcCzZ09 -_.!~éÉü";
+  std::mt19937 random(42);
+  std::uniform_int_distribution<size_t> length(0, 8);
+  std::uniform_int_distribution<size_t> character(0, characters.size() - 1);
+
+  std::vector<std::wstring> labels(count);
+  for (auto& label : labels)
+  {
+    for (size_t i = length(random); i > 0; --i)
+      label += characters[character(random)];
+  }
+  return labels;
+}
+
+void ExpectSameOrderAsAlphaNumericCompare(const std::vector<std::wstring>& labels)
+{
+  std::vector<uint32_t> expected(labels.size());
+  std::iota(expected.begin(), expected.end(), 0);
+  std::stable_sort(expected.begin(), expected.end(), [&labels](uint32_t left, uint32_t right) {
+    return StringUtils::AlphaNumericCompare(labels[left], labels[right]) < 0;
+  });
+
+  CSortKeys keys;
+  for (const auto& label : labels)
+    keys.Add(label);
+
+  EXPECT_EQ(expected, keys.Sort(false, false));
+}
+} // unnamed namespace
+
+TEST(TestSortKeys, Numbers)
+{
+  const std::vector<std::wstring> sorted = Sorted({L"Track 10", L"Track 9", L"Track 1", L"Track"});
+  EXPECT_EQ(sorted, std::vector<std::wstring>({L"Track", L"Track 1", L"Track 9", L"Track 10"}));
+}
+
+TEST(TestSortKeys, SymbolsAndCase)
+{
+  const std::vector<std::wstring> sorted = Sorted({L"b", L"A", L"1", L"(a)", L"a"});
+  EXPECT_EQ(sorted, std::vector<std::wstring>({L"(a)", L"1", L"A", L"a", L"b"}));
+}
+
+TEST(TestSortKeys, Descending)
+{
+  // equal labels keep their order
+  CSortKeys keys;
+  keys.Add(L"b");
+  keys.Add(L"a");
+  keys.Add(L"B");
+  keys.Add(L"c");
+  EXPECT_EQ(keys.Sort(true, false), std::vector<uint32_t>({3, 0, 2, 1}));
+}
+
+TEST(TestSortKeys, SpecialAndFolders)
+{
+  CSortKeys keys;
+  keys.Add(L"a", CSortKeys::Special::ON_BOTTOM);
+  keys.Add(L"b", CSortKeys::Special::NONE, CSortKeys::Folder::NO);
+  keys.Add(L"c", CSortKeys::Special::NONE, CSortKeys::Folder::YES);
+  keys.Add(L"z", CSortKeys::Special::ON_TOP);
+  keys.Add(L"y", CSortKeys::Special::ON_TOP);
+
+  EXPECT_EQ(keys.Sort(false, false), std::vector<uint32_t>({3, 4, 2, 1, 0}));
+  EXPECT_EQ(keys.Sort(false, true), std::vector<uint32_t>({3, 4, 1, 2, 0}));
+  EXPECT_EQ(keys.Sort(true, true), std::vector<uint32_t>({3, 4, 2, 1, 0}));
+}
+
+TEST(TestSortKeys, Limit)
+{
+  CSortKeys keys;
+  for (const wchar_t* label : {L"e", L"d", L"c", L"b", L"a"})
+    keys.Add(label);
+
+  EXPECT_EQ(keys.Sort(false, false, 2), std::vector<uint32_t>({4, 3}));
+}
+
+TEST(TestSortKeys, Merge)
+{
+  CSortKeys keys;
+  for (const wchar_t* label : {L"c", L"e", L"Track 2"})
+    keys.Add(label);
+  keys.Add(L"z", CSortKeys::Special::ON_TOP);
+  for (const wchar_t* label : {L"a", L"c", L"d", L"Track 10"})
+    keys.Add(label);
+
+  // two runs sorted on their own, equal labels of the first run stay first
+  EXPECT_EQ(keys.Merge(3, false, false), std::vector<uint32_t>({3, 4, 0, 5, 6, 1, 2, 7}));
+}
+
+TEST(TestSortKeys, MatchesAlphaNumericCompare)
+{
+  ExpectSameOrderAsAlphaNumericCompare(RandomLabels(2000));
+  ExpectSameOrderAsAlphaNumericCompare(
+      {L"a1234567890123456789", L"a123456789012345", L"a1234567890123456x", L"a01", L"a1"});
+}
+
+TEST(TestSortKeys, DigitsAgainstCharacters)
+{
+  // a character is compared with the first digit of a number
+  ExpectSameOrderAsAlphaNumericCompare({L"a", L"5", L"\t", L"5a", L"a5", L"Z9", L"9Z", L"0",
+                                        L"00", L"z", L"\x01", L"1\t", L"10", L"\x01" L"0",
+                                        L"\xFF10", L"\xE9", L"9\xE9", L"_9", L"9_"});
+}
+
+TEST(TestSortKeys, Parallel)
+{
+  ExpectSameOrderAsAlphaNumericCompare(RandomLabels(CSortKeys::PARALLEL_THRESHOLD * 3 + 7));
+}
@@ -7,8 +7,14 @@
  */
 
 #include "utils/SortUtils.h"
+#include "utils/StringUtils.h"
 #include "utils/Variant.h"
 
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+
 #include <gtest/gtest.h>
 
 TEST(TestSortUtils, Sort_SortBy)
@@ -121,3 +127,66 @@ TEST(TestSortUtils, GetFieldsForSorting)
   EXPECT_EQ(FieldTrackNumber, *it);
   EXPECT_EQ((unsigned int)5, fields.size());
 }
+
+TEST(TestSortUtils, Sort_Limit)
+{
+  SortItems items;
+  for (const char* label : {"Track 10", "Track 2", "Track 1", "Track 3"})
+  {
+    items.emplace_back(std::make_shared<SortItem>());
+    (*items.back())[FieldLabel] = label;
+  }
+
+  SortUtils::Sort(SortByLabel, SortOrderAscending, SortAttributeNone, items, 3, 1);
+
+  ASSERT_EQ(2u, items.size());
+  EXPECT_EQ("Track 2", (*items.at(0))[FieldLabel].asString());
+  EXPECT_EQ("Track 3", (*items.at(1))[FieldLabel].asString());
+  EXPECT_EQ(L"Track 2", (*items.at(0))[FieldSort].asWideString());
+}
+
+// Compares the precomputed sort keys with sorting on the sort labels.
+// Run with --gtest_also_run_disabled_tests
+TEST(TestSortUtils, DISABLED_Benchmark)
+{
+  constexpr size_t COUNT = 100000;
+  std::mt19937 random(42);
+  std::uniform_int_distribution<int> track(1, 30);
+  std::uniform_int_distribution<int> word(0, 999);
+
+  SortItems items;
+  for (size_t i = 0; i < COUNT; ++i)
+  {
+    items.emplace_back(std::make_shared<SortItem>());
+    (*items.back())[FieldLabel] =
+        StringUtils::Format("Album {} - {:02} Song {}", word(random), track(random), word(random));
+  }
+
+  SortItems labelItems;
+  for (const auto& item : items)
+    labelItems.emplace_back(std::make_shared<SortItem>(*item));
+
+  auto start = std::chrono::steady_clock::now();
+  SortUtils::Sort(SortByLabel, SortOrderAscending, SortAttributeNone, items);
+  const auto keys = std::chrono::steady_clock::now() - start;
+
+  start = std::chrono::steady_clock::now();
+  for (auto& item : labelItems)
+    (*item)[FieldSort] = (*item)[FieldLabel].asWideString();
+  std::stable_sort(labelItems.begin(), labelItems.end(),
+                   [](const SortItemPtr& left, const SortItemPtr& right) {
+                     return StringUtils::AlphaNumericCompare(left->at(FieldSort).asWideString(),
+                                                             right->at(FieldSort).asWideString()) <
+                            0;
+                   });
+  const auto labels = std::chrono::steady_clock::now() - start;
+
+  for (size_t i = 0; i < COUNT; ++i)
+    EXPECT_EQ(items[i]->at(FieldSort).asWideString(), labelItems[i]->at(FieldSort).asWideString());
+
+  std::cout << "sorting " << COUNT << " items: sort keys "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(keys).count()
+            << "ms, sort labels "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(labels).count() << "ms"
+            << std::endl;
+}
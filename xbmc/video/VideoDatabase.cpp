@@ -19,6 +19,7 @@
 #include "VideoInfoScanner.h"
 #include "XBDateTime.h"
 #include "addons/AddonManager.h"
+#include "dbwrappers/FullTextQuery.h"
 #include "dbwrappers/dataset.h"
 #include "dialogs/GUIDialogExtendedProgressBar.h"
 #include "dialogs/GUIDialogKaiToast.h"
@@ -47,6 +48,7 @@
 #include "settings/SettingsComponent.h"
 #include "storage/MediaManager.h"
 #include "utils/ArtUtils.h"
+#include "utils/DatabaseColumns.h"
 #include "utils/FileUtils.h"
 #include "utils/GroupUtils.h"
 #include "utils/LabelFormatter.h"
@@ -78,6 +80,50 @@ using namespace KODI::MESSAGING;
 using namespace KODI::GUILIB;
 using namespace KODI::VIDEO;
 
+namespace
+{
+std::string GetColumn(int id)
+{
+  return StringUtils::Format("c{:02}", id);
+}
+
+// full text indices used by the search window
+const CDatabase::FullTextIndex MOVIE_TITLE_INDEX{
+    "movie_title_fts",
+    "movie",
+    "idMovie",
+    {GetColumn(VIDEODB_ID_TITLE), GetColumn(VIDEODB_ID_ORIGINALTITLE)}};
+const CDatabase::FullTextIndex TVSHOW_TITLE_INDEX{
+    "tvshow_title_fts", "tvshow", "idShow", {GetColumn(VIDEODB_ID_TV_TITLE)}};
+const CDatabase::FullTextIndex EPISODE_TITLE_INDEX{
+    "episode_title_fts", "episode", "idEpisode", {GetColumn(VIDEODB_ID_EPISODE_TITLE)}};
+const CDatabase::FullTextIndex MUSICVIDEO_TITLE_INDEX{
+    "musicvideo_title_fts", "musicvideo", "idMVideo", {GetColumn(VIDEODB_ID_MUSICVIDEO_TITLE)}};
+
+// tables whose changes are recorded for clients syncing the library
+const CDatabase::JournaledTable JOURNALED_TABLES[] = {
+    {"movie", "idMovie", MediaTypeMovie},
+    {"tvshow", "idShow", MediaTypeTvShow},
+    {"episode", "idEpisode", MediaTypeEpisode},
+    {"musicvideo", "idMVideo", MediaTypeMusicVideo},
+};
+
+// the tags to load the details for by media type and database id
+using DetailsTargets = std::map<std::string, std::map<int, std::vector<CVideoInfoTag*>>, std::less<>>;
+
+std::string JoinIds(const std::map<int, std::vector<CVideoInfoTag*>>& targets)
+{
+  std::string ids;
+  for (const auto& [id, _] : targets)
+  {
+    if (!ids.empty())
+      ids += ',';
+    ids += std::to_string(id);
+  }
+  return ids;
+}
+} // unnamed namespace
+
 //********************************************************************************************************************************
 CVideoDatabase::CVideoDatabase() = default;
 
@@ -217,6 +263,9 @@ void CVideoDatabase::CreateTables()
   CLog::Log(LOGINFO, "create videoversion table");
   m_pDS->exec("CREATE TABLE videoversion (idFile INTEGER PRIMARY KEY, idMedia INTEGER, media_type "
               "TEXT, itemType INTEGER, idType INTEGER)");
+
+  CLog::Log(LOGINFO, "create changelog table");
+  CreateJournalTable();
 }
 
 void CVideoDatabase::CreateLinkIndex(const char *table)
@@ -380,6 +429,26 @@ void CVideoDatabase::CreateAnalytics()
               "DELETE FROM streamdetails WHERE idFile=old.idFile; "
               "END");
 
+  CLog::Log(LOGINFO, "Creating change journal triggers");
+  for (const auto& table : JOURNALED_TABLES)
+    CreateJournalTriggers(table);
+  // the watched state and last played date of movies, episodes and music videos are stored with
+  // their file
+  m_pDS->exec("CREATE TRIGGER tgrJournalUpdate_files AFTER UPDATE ON files FOR EACH ROW BEGIN "
+              "INSERT INTO changelog (media_type, media_id, action) "
+              "SELECT 'movie', idMovie, 'update' FROM movie WHERE idFile=NEW.idFile; "
+              "INSERT INTO changelog (media_type, media_id, action) "
+              "SELECT 'episode', idEpisode, 'update' FROM episode WHERE idFile=NEW.idFile; "
+              "INSERT INTO changelog (media_type, media_id, action) "
+              "SELECT 'musicvideo', idMVideo, 'update' FROM musicvideo WHERE idFile=NEW.idFile; "
+              "END");
+
+  CLog::Log(LOGINFO, "Creating full text indices");
+  CreateFullTextIndex(MOVIE_TITLE_INDEX);
+  CreateFullTextIndex(TVSHOW_TITLE_INDEX);
+  CreateFullTextIndex(EPISODE_TITLE_INDEX);
+  CreateFullTextIndex(MUSICVIDEO_TITLE_INDEX);
+
   CreateViews();
 }
 
@@ -843,6 +912,7 @@ bool CVideoDatabase::GetSubPaths(const std::string &basepath, std::vector<std::p
 int CVideoDatabase::AddPath(const std::string& strPath, const std::string &parentPath /*= "" */, const CDateTime& dateAdded /* = CDateTime() */)
 {
   std::string strSQL;
+  PrimaryReads primaryReads(*this);
   try
   {
     int idPath = GetPathId(strPath);
@@ -1001,6 +1071,7 @@ int CVideoDatabase::AddFile(const std::string& strFileNameAndPath,
                             const CDateTime& lastPlayed /* = CDateTime() */)
 {
   std::string strSQL = "";
+  PrimaryReads primaryReads(*this);
   try
   {
     int idFile;
@@ -1657,6 +1728,7 @@ int CVideoDatabase::AddNewMusicVideo(CVideoInfoTag& details)
 //********************************************************************************************************************************
 int CVideoDatabase::AddToTable(const std::string& table, const std::string& firstField, const std::string& secondField, const std::string& value)
 {
+  PrimaryReads primaryReads(*this);
   try
   {
     if (nullptr == m_pDB)
@@ -1716,6 +1788,7 @@ int CVideoDatabase::AddRatings(int mediaId,
                                std::string_view defaultRating)
 {
   int ratingid = -1;
+  PrimaryReads primaryReads(*this);
   try
   {
     if (nullptr == m_pDB)
@@ -1841,6 +1914,7 @@ int CVideoDatabase::AddSet(const std::string& strSet,
   if (strSet.empty())
     return -1;
 
+  PrimaryReads primaryReads(*this);
   try
   {
     if (m_pDB == nullptr || m_pDS == nullptr)
@@ -1895,6 +1969,7 @@ int CVideoDatabase::AddTag(const std::string& name)
 
 int CVideoDatabase::AddActor(const std::string& name, const std::string& thumbURLs, const std::string &thumb)
 {
+  PrimaryReads primaryReads(*this);
   try
   {
     if (nullptr == m_pDB)
@@ -3407,6 +3482,7 @@ int CVideoDatabase::GetSeasonId(int showID, int season) const
 
 int CVideoDatabase::AddSeason(int showID, int season, const std::string& name /* = "" */)
 {
+  PrimaryReads primaryReads(*this);
   int seasonId = GetSeasonId(showID, season);
   if (seasonId < 0)
   {
@@ -3505,11 +3581,13 @@ bool CVideoDatabase::SetStreamDetailsForFileId(const CStreamDetails& details, in
 
   try
   {
-    m_pDS->exec(PrepareSQL("DELETE FROM streamdetails WHERE idFile = %i", idFile));
+    // the statements don't depend on each other, so they are sent as one batch
+    std::vector<std::string> queries;
+    queries.emplace_back(PrepareSQL("DELETE FROM streamdetails WHERE idFile = %i", idFile));
 
     for (int i=1; i<=details.GetVideoStreamCount(); i++)
     {
-      m_pDS->exec(PrepareSQL(
+      queries.emplace_back(PrepareSQL(
           "INSERT INTO streamdetails "
           "(idFile, iStreamType, strVideoCodec, fVideoAspect, iVideoWidth, iVideoHeight, "
           "iVideoDuration, strStereoMode, strVideoLanguage, strHdrType) "
@@ -3521,7 +3599,7 @@ bool CVideoDatabase::SetStreamDetailsForFileId(const CStreamDetails& details, in
     }
     for (int i=1; i<=details.GetAudioStreamCount(); i++)
     {
-      m_pDS->exec(PrepareSQL(
+      queries.emplace_back(PrepareSQL(
           "INSERT INTO streamdetails "
           "(idFile, iStreamType, strAudioCodec, iAudioChannels, strAudioLanguage) "
           "VALUES (%i,%i,'%s',%i,'%s')",
@@ -3530,11 +3608,11 @@ bool CVideoDatabase::SetStreamDetailsForFileId(const CStreamDetails& details, in
     }
     for (int i=1; i<=details.GetSubtitleStreamCount(); i++)
     {
-      m_pDS->exec(PrepareSQL("INSERT INTO streamdetails "
-                             "(idFile, iStreamType, strSubtitleLanguage) "
-                             "VALUES (%i,%i,'%s')",
-                             idFile, static_cast<int>(CStreamDetail::SUBTITLE),
-                             details.GetSubtitleLanguage(i).c_str()));
+      queries.emplace_back(PrepareSQL("INSERT INTO streamdetails "
+                                      "(idFile, iStreamType, strSubtitleLanguage) "
+                                      "VALUES (%i,%i,'%s')",
+                                      idFile, static_cast<int>(CStreamDetail::SUBTITLE),
+                                      details.GetSubtitleLanguage(i).c_str()));
     }
 
     // update the runtime information, if empty
@@ -3547,11 +3625,12 @@ bool CVideoDatabase::SetStreamDetailsForFileId(const CStreamDetails& details, in
 
       for (const auto& [type, id] : tables)
       {
-        std::string sql = PrepareSQL("update %s set c%02d=%d where idFile=%d and c%02d=''",
-                                     type.c_str(), id, details.GetVideoDuration(), idFile, id);
-        m_pDS->exec(sql);
+        queries.emplace_back(PrepareSQL("update %s set c%02d=%d where idFile=%d and c%02d=''",
+                                        type.c_str(), id, details.GetVideoDuration(), idFile, id));
       }
     }
+
+    m_pDS->exec_batch(queries);
     return true;
   }
   catch (...)
@@ -5254,6 +5333,150 @@ void CVideoDatabase::GetUniqueIDs(int media_id, const std::string &media_type, C
   }
 }
 
+void CVideoDatabase::GetDetailsForItems(std::vector<CVideoInfoTag>& details, int getDetails)
+{
+  getDetails &=
+      VideoDbDetailsCast | VideoDbDetailsTag | VideoDbDetailsRating | VideoDbDetailsUniqueID;
+  if (getDetails == VideoDbDetailsNone || !m_pDB || !m_pDS2)
+    return;
+
+  DetailsTargets targets;
+  DetailsTargets castTargets;
+  for (auto& tag : details)
+  {
+    if (tag.m_iDbId <= 0 || tag.m_type.empty())
+      continue;
+
+    targets[tag.m_type][tag.m_iDbId].emplace_back(&tag);
+    // the cast of an episode is its guest stars followed by the cast of the show
+    if (getDetails & VideoDbDetailsCast)
+    {
+      castTargets[tag.m_type][tag.m_iDbId].emplace_back(&tag);
+      if (tag.m_type == MediaTypeEpisode && tag.m_iIdShow > 0)
+        castTargets[MediaTypeTvShow][tag.m_iIdShow].emplace_back(&tag);
+    }
+  }
+
+  try
+  {
+    // std::map orders episode before tvshow as required for the cast of episodes
+    for (const auto& [mediaType, items] : castTargets)
+    {
+      m_pDS2->query(PrepareSQL("SELECT actor_link.media_id,"
+                               "  actor.name,"
+                               "  actor_link.role,"
+                               "  actor_link.cast_order,"
+                               "  actor.art_urls,"
+                               "  art.url "
+                               "FROM actor_link"
+                               "  JOIN actor ON"
+                               "    actor_link.actor_id=actor.actor_id"
+                               "  LEFT JOIN art ON"
+                               "    art.media_id=actor.actor_id AND art.media_type='actor' AND art.type='thumb' "
+                               "WHERE actor_link.media_type='%s' AND actor_link.media_id IN (%s) "
+                               "ORDER BY actor_link.media_id, actor_link.cast_order",
+                               mediaType.c_str(), JoinIds(items).c_str()));
+      while (!m_pDS2->eof())
+      {
+        const auto it = items.find(m_pDS2->fv(0).get_asInt());
+        if (it != items.end())
+        {
+          SActorInfo info;
+          info.strName = m_pDS2->fv(1).get_asString();
+          info.strRole = m_pDS2->fv(2).get_asString();
+          info.order = m_pDS2->fv(3).get_asInt();
+          info.thumbUrl.ParseFromData(m_pDS2->fv(4).get_asString());
+          info.thumb = m_pDS2->fv(5).get_asString();
+
+          for (CVideoInfoTag* tag : it->second)
+          {
+            // ignore identical actors (the show may have the guest stars of an episode as well)
+            if (std::ranges::none_of(tag->m_cast,
+                                     [&info](const SActorInfo& actor) {
+                                       return actor.strName == info.strName &&
+                                              actor.strRole == info.strRole;
+                                     }))
+              tag->m_cast.emplace_back(info);
+          }
+        }
+        m_pDS2->next();
+      }
+      m_pDS2->close();
+    }
+
+    for (const auto& [mediaType, items] : targets)
+    {
+      const std::string ids = JoinIds(items);
+
+      if (getDetails & VideoDbDetailsTag)
+      {
+        m_pDS2->query(PrepareSQL("SELECT tag_link.media_id, tag.name FROM tag INNER JOIN tag_link ON tag_link.tag_id = tag.tag_id "
+                                 "WHERE tag_link.media_type = '%s' AND tag_link.media_id IN (%s) "
+                                 "ORDER BY tag_link.media_id, tag.tag_id",
+                                 mediaType.c_str(), ids.c_str()));
+        while (!m_pDS2->eof())
+        {
+          const auto it = items.find(m_pDS2->fv(0).get_asInt());
+          if (it != items.end())
+          {
+            for (CVideoInfoTag* tag : it->second)
+              tag->m_tags.emplace_back(m_pDS2->fv(1).get_asString());
+          }
+          m_pDS2->next();
+        }
+        m_pDS2->close();
+      }
+
+      if (getDetails & VideoDbDetailsRating)
+      {
+        m_pDS2->query(PrepareSQL("SELECT media_id, rating_type, rating, votes FROM rating "
+                                 "WHERE media_type = '%s' AND media_id IN (%s)",
+                                 mediaType.c_str(), ids.c_str()));
+        while (!m_pDS2->eof())
+        {
+          const auto it = items.find(m_pDS2->fv(0).get_asInt());
+          if (it != items.end())
+          {
+            for (CVideoInfoTag* tag : it->second)
+              tag->m_ratings[m_pDS2->fv(1).get_asString()] =
+                  CRating(m_pDS2->fv(2).get_asFloat(), m_pDS2->fv(3).get_asInt());
+          }
+          m_pDS2->next();
+        }
+        m_pDS2->close();
+      }
+
+      if (getDetails & VideoDbDetailsUniqueID)
+      {
+        m_pDS2->query(PrepareSQL("SELECT media_id, type, value FROM uniqueid "
+                                 "WHERE media_type = '%s' AND media_id IN (%s)",
+                                 mediaType.c_str(), ids.c_str()));
+        while (!m_pDS2->eof())
+        {
+          const auto it = items.find(m_pDS2->fv(0).get_asInt());
+          if (it != items.end())
+          {
+            for (CVideoInfoTag* tag : it->second)
+              tag->SetUniqueID(m_pDS2->fv(2).get_asString(), m_pDS2->fv(1).get_asString());
+          }
+          m_pDS2->next();
+        }
+        m_pDS2->close();
+      }
+
+      for (const auto& [_, tags] : items)
+      {
+        for (CVideoInfoTag* tag : tags)
+          tag->m_parsedDetails |= getDetails;
+      }
+    }
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "failed for {} items", details.size());
+  }
+}
+
 bool CVideoDatabase::GetVideoSettings(const CFileItem &item, CVideoSettings &settings)
 {
   return GetVideoSettings(GetFileId(item), settings);
@@ -7002,11 +7225,13 @@ void CVideoDatabase::UpdateTables(int iVersion)
     // Copy current set title for existing sets
     m_pDS->exec("UPDATE sets SET strOriginalSet = strSet");
   }
+  if (iVersion < 138)
+    CreateJournalTable();
 }
 
 int CVideoDatabase::GetSchemaVersion() const
 {
-  return 136;
+  return 138;
 }
 
 bool CVideoDatabase::LookupByFolders(const std::string &path, bool shows)
@@ -8947,6 +9172,85 @@ bool CVideoDatabase::GetMoviesByWhere(const std::string& strBaseDir, const Filte
   return false;
 }
 
+bool CVideoDatabase::GetMoviesByWhere(const std::string& strBaseDir,
+                                      const Filter& filter,
+                                      FieldList fields,
+                                      CDatabaseColumns& results,
+                                      int& total,
+                                      const SortDescription& sortDescription /* = SortDescription() */)
+{
+  results.Clear();
+  total = -1;
+
+  // every movie would have to be checked against the locked sources
+  if (m_profileManager.GetMasterProfile().getLockMode() != LockMode::EVERYONE &&
+      !g_passwordManager.bMasterUser)
+    return false;
+
+  try
+  {
+    if (nullptr == m_pDB)
+      return false;
+    if (nullptr == m_pDS)
+      return false;
+
+    // parse the base path to get additional filters
+    CVideoDbUrl videoUrl;
+    Filter extFilter = filter;
+    SortDescription sorting = sortDescription;
+    if (!videoUrl.FromString(strBaseDir) || !GetFilter(videoUrl, extFilter, sorting))
+      return false;
+
+    // versions and extras are listed with their own labels and paths
+    const CUrlOptions::UrlOptions& options = videoUrl.GetOptions();
+    if (options.contains("videoversionid") || options.contains("assetType") ||
+        !extFilter.fields.empty())
+      return false;
+
+    std::string strSQL = "select %s from movie_view ";
+    std::string strSQLExtra;
+    if (!CDatabase::BuildSQL(strSQLExtra, extFilter, strSQLExtra))
+      return false;
+
+    // Apply the limiting directly here if there's no special sorting but limiting
+    if (extFilter.limit.empty() && sorting.sortBy == SortByNone &&
+        (sorting.limitStart > 0 || sorting.limitEnd > 0 ||
+         (sorting.limitStart == 0 && sorting.limitEnd == 0)))
+    {
+      total = GetSingleValueInt(PrepareSQL(strSQL, "COUNT(1)") + strSQLExtra, *m_pDS);
+      strSQLExtra += DatabaseUtils::BuildLimitClause(sorting.limitEnd, sorting.limitStart);
+    }
+
+    strSQL = PrepareSQL(strSQL, "*") + strSQLExtra;
+
+    const int iRowsFound = RunQuery(strSQL);
+    if (total < iRowsFound)
+      total = iRowsFound;
+
+    if (iRowsFound <= 0)
+      return iRowsFound == 0;
+
+    DatabaseResults order;
+    order.reserve(iRowsFound);
+    if (!SortUtils::SortFromDataset(sortDescription, MediaTypeMovie, *m_pDS, order))
+      return false;
+
+    if (std::find(fields.begin(), fields.end(), FieldId) == fields.end())
+      fields.emplace_back(FieldId);
+
+    const bool loaded = results.Load(MediaTypeMovie, fields, m_pDS->get_result_set(), order);
+
+    // cleanup
+    m_pDS->close();
+    return loaded;
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "failed");
+  }
+  return false;
+}
+
 bool CVideoDatabase::GetTvShowsNav(const std::string& strBaseDir, CFileItemList& items,
                                   int idGenre /* = -1 */, int idYear /* = -1 */, int idActor /* = -1 */, int idDirector /* = -1 */, int idStudio /* = -1 */, int idTag /* = -1 */,
                                   const SortDescription &sortDescription /* = SortDescription() */, int getDetails /* = VideoDbDetailsNone */)
@@ -10257,6 +10561,30 @@ int CVideoDatabase::GetMatchingMusicVideo(const std::string& strArtist, const st
   return -1;
 }
 
+void CVideoDatabase::QueryByName(const std::string& query,
+                                 const FullTextIndex& index,
+                                 const std::string& keyField,
+                                 const std::string& search,
+                                 const std::string& like,
+                                 std::string& sql)
+{
+  Filter filter;
+  const bool fullText = AppendFullTextFilter(filter, index, keyField, CFullTextQuery(search));
+  if (!fullText)
+    filter.AppendWhere(like);
+  BuildSQL(query, filter, sql);
+  m_pDS->query(sql);
+
+  // words only match from their start, look for titles containing the search anywhere if no
+  // title has a word starting with it
+  if (fullText && m_pDS->eof())
+  {
+    m_pDS->close();
+    BuildSQL(query, Filter(like), sql);
+    m_pDS->query(sql);
+  }
+}
+
 void CVideoDatabase::GetMoviesByName(const std::string& strSearch, CFileItemList& items)
 {
   std::string strSQL;
@@ -10268,20 +10596,22 @@ void CVideoDatabase::GetMoviesByName(const std::string& strSearch, CFileItemList
     if (nullptr == m_pDS)
       return;
 
+    std::string strQuery;
     if (m_profileManager.GetMasterProfile().getLockMode() != LockMode::EVERYONE &&
         !g_passwordManager.bMasterUser)
-      strSQL = PrepareSQL("SELECT movie.idMovie, movie.c%02d, path.strPath, movie.idSet FROM movie "
-                          "INNER JOIN files ON files.idFile=movie.idFile INNER JOIN path ON "
-                          "path.idPath=files.idPath "
-                          "WHERE movie.c%02d LIKE '%%%s%%' OR movie.c%02d LIKE '%%%s%%'",
-                          VIDEODB_ID_TITLE, VIDEODB_ID_TITLE, strSearch.c_str(),
-                          VIDEODB_ID_ORIGINALTITLE, strSearch.c_str());
+      strQuery = PrepareSQL("SELECT movie.idMovie, movie.c%02d, path.strPath, movie.idSet FROM movie "
+                            "INNER JOIN files ON files.idFile=movie.idFile INNER JOIN path ON "
+                            "path.idPath=files.idPath ",
+                            VIDEODB_ID_TITLE);
     else
-      strSQL = PrepareSQL("SELECT movie.idMovie,movie.c%02d, movie.idSet FROM movie WHERE "
-                          "movie.c%02d like '%%%s%%' OR movie.c%02d LIKE '%%%s%%'",
-                          VIDEODB_ID_TITLE, VIDEODB_ID_TITLE, strSearch.c_str(),
-                          VIDEODB_ID_ORIGINALTITLE, strSearch.c_str());
-    m_pDS->query( strSQL );
+      strQuery = PrepareSQL("SELECT movie.idMovie,movie.c%02d, movie.idSet FROM movie ",
+                            VIDEODB_ID_TITLE);
+
+    QueryByName(strQuery, MOVIE_TITLE_INDEX, "movie.idMovie", strSearch,
+                PrepareSQL("movie.c%02d LIKE '%%%s%%' OR movie.c%02d LIKE '%%%s%%'",
+                           VIDEODB_ID_TITLE, strSearch.c_str(), VIDEODB_ID_ORIGINALTITLE,
+                           strSearch.c_str()),
+                strSQL);
 
     while (!m_pDS->eof())
     {
@@ -10325,12 +10655,16 @@ void CVideoDatabase::GetTvShowsByName(const std::string& strSearch, CFileItemLis
     if (nullptr == m_pDS)
       return;
 
+    std::string strQuery;
     if (m_profileManager.GetMasterProfile().getLockMode() != LockMode::EVERYONE &&
         !g_passwordManager.bMasterUser)
-      strSQL = PrepareSQL("SELECT tvshow.idShow, tvshow.c%02d, path.strPath FROM tvshow INNER JOIN tvshowlinkpath ON tvshowlinkpath.idShow=tvshow.idShow INNER JOIN path ON path.idPath=tvshowlinkpath.idPath WHERE tvshow.c%02d LIKE '%%%s%%'", VIDEODB_ID_TV_TITLE, VIDEODB_ID_TV_TITLE, strSearch.c_str());
+      strQuery = PrepareSQL("SELECT tvshow.idShow, tvshow.c%02d, path.strPath FROM tvshow INNER JOIN tvshowlinkpath ON tvshowlinkpath.idShow=tvshow.idShow INNER JOIN path ON path.idPath=tvshowlinkpath.idPath ", VIDEODB_ID_TV_TITLE);
     else
-      strSQL = PrepareSQL("select tvshow.idShow,tvshow.c%02d from tvshow where tvshow.c%02d like '%%%s%%'",VIDEODB_ID_TV_TITLE,VIDEODB_ID_TV_TITLE,strSearch.c_str());
-    m_pDS->query( strSQL );
+      strQuery = PrepareSQL("select tvshow.idShow,tvshow.c%02d from tvshow ", VIDEODB_ID_TV_TITLE);
+
+    QueryByName(strQuery, TVSHOW_TITLE_INDEX, "tvshow.idShow", strSearch,
+                PrepareSQL("tvshow.c%02d LIKE '%%%s%%'", VIDEODB_ID_TV_TITLE, strSearch.c_str()),
+                strSQL);
 
     while (!m_pDS->eof())
     {
@@ -10371,12 +10705,17 @@ void CVideoDatabase::GetEpisodesByName(const std::string& strSearch, CFileItemLi
     if (nullptr == m_pDS)
       return;
 
+    std::string strQuery;
     if (m_profileManager.GetMasterProfile().getLockMode() != LockMode::EVERYONE &&
         !g_passwordManager.bMasterUser)
-      strSQL = PrepareSQL("SELECT episode.idEpisode, episode.c%02d, episode.c%02d, episode.idShow, tvshow.c%02d, path.strPath FROM episode INNER JOIN tvshow ON tvshow.idShow=episode.idShow INNER JOIN files ON files.idFile=episode.idFile INNER JOIN path ON path.idPath=files.idPath WHERE episode.c%02d LIKE '%%%s%%'", VIDEODB_ID_EPISODE_TITLE, VIDEODB_ID_EPISODE_SEASON, VIDEODB_ID_TV_TITLE, VIDEODB_ID_EPISODE_TITLE, strSearch.c_str());
+      strQuery = PrepareSQL("SELECT episode.idEpisode, episode.c%02d, episode.c%02d, episode.idShow, tvshow.c%02d, path.strPath FROM episode INNER JOIN tvshow ON tvshow.idShow=episode.idShow INNER JOIN files ON files.idFile=episode.idFile INNER JOIN path ON path.idPath=files.idPath ", VIDEODB_ID_EPISODE_TITLE, VIDEODB_ID_EPISODE_SEASON, VIDEODB_ID_TV_TITLE);
     else
-      strSQL = PrepareSQL("SELECT episode.idEpisode, episode.c%02d, episode.c%02d, episode.idShow, tvshow.c%02d FROM episode INNER JOIN tvshow ON tvshow.idShow=episode.idShow WHERE episode.c%02d like '%%%s%%'", VIDEODB_ID_EPISODE_TITLE, VIDEODB_ID_EPISODE_SEASON, VIDEODB_ID_TV_TITLE, VIDEODB_ID_EPISODE_TITLE, strSearch.c_str());
-    m_pDS->query( strSQL );
+      strQuery = PrepareSQL("SELECT episode.idEpisode, episode.c%02d, episode.c%02d, episode.idShow, tvshow.c%02d FROM episode INNER JOIN tvshow ON tvshow.idShow=episode.idShow ", VIDEODB_ID_EPISODE_TITLE, VIDEODB_ID_EPISODE_SEASON, VIDEODB_ID_TV_TITLE);
+
+    QueryByName(strQuery, EPISODE_TITLE_INDEX, "episode.idEpisode", strSearch,
+                PrepareSQL("episode.c%02d LIKE '%%%s%%'", VIDEODB_ID_EPISODE_TITLE,
+                           strSearch.c_str()),
+                strSQL);
 
     while (!m_pDS->eof())
     {
@@ -10421,12 +10760,18 @@ void CVideoDatabase::GetMusicVideosByName(const std::string& strSearch, CFileIte
     if (nullptr == m_pDS)
       return;
 
+    std::string strQuery;
     if (m_profileManager.GetMasterProfile().getLockMode() != LockMode::EVERYONE &&
         !g_passwordManager.bMasterUser)
-      strSQL = PrepareSQL("SELECT musicvideo.idMVideo, musicvideo.c%02d, path.strPath FROM musicvideo INNER JOIN files ON files.idFile=musicvideo.idFile INNER JOIN path ON path.idPath=files.idPath WHERE musicvideo.c%02d LIKE '%%%s%%'", VIDEODB_ID_MUSICVIDEO_TITLE, VIDEODB_ID_MUSICVIDEO_TITLE, strSearch.c_str());
+      strQuery = PrepareSQL("SELECT musicvideo.idMVideo, musicvideo.c%02d, path.strPath FROM musicvideo INNER JOIN files ON files.idFile=musicvideo.idFile INNER JOIN path ON path.idPath=files.idPath ", VIDEODB_ID_MUSICVIDEO_TITLE);
     else
-      strSQL = PrepareSQL("select musicvideo.idMVideo,musicvideo.c%02d from musicvideo where musicvideo.c%02d like '%%%s%%'",VIDEODB_ID_MUSICVIDEO_TITLE,VIDEODB_ID_MUSICVIDEO_TITLE,strSearch.c_str());
-    m_pDS->query( strSQL );
+      strQuery = PrepareSQL("select musicvideo.idMVideo,musicvideo.c%02d from musicvideo ",
+                            VIDEODB_ID_MUSICVIDEO_TITLE);
+
+    QueryByName(strQuery, MUSICVIDEO_TITLE_INDEX, "musicvideo.idMVideo", strSearch,
+                PrepareSQL("musicvideo.c%02d LIKE '%%%s%%'", VIDEODB_ID_MUSICVIDEO_TITLE,
+                           strSearch.c_str()),
+                strSQL);
 
     while (!m_pDS->eof())
     {
@@ -11060,6 +11405,9 @@ void CVideoDatabase::CleanDatabase(CGUIDialogProgressBarHandle* handle,
             "WHERE NOT EXISTS (SELECT 1 FROM movie WHERE movie.idSet = sets.idSet)";
       m_pDS->exec(sql);
 
+      CLog::LogFC(LOGDEBUG, LOGDATABASE, "Pruning change journal");
+      PruneJournal();
+
       CommitTransaction();
 
       if (handle)
@@ -12927,6 +13275,7 @@ int CVideoDatabase::AddVideoVersionType(const std::string& typeVideoVersion,
 
   int id = -1;
 
+  PrimaryReads primaryReads(*this);
   try
   {
     if (!m_pDB || !m_pDS)
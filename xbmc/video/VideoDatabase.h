@@ -29,6 +29,7 @@
 
 #include <fmt/format.h>
 
+class CDatabaseColumns;
 class CFileItem;
 class CFileItemList;
 class CStreamDetails;
@@ -630,6 +631,15 @@ public:
   bool GetEpisodeBasicInfo(const std::string& strFilenameAndPath, CVideoInfoTag& details, int idEpisode  = -1);
   bool GetEpisodeInfo(const std::string& strFilenameAndPath, CVideoInfoTag& details, int idEpisode = -1, int getDetails = VideoDbDetailsAll);
   bool GetMusicVideoInfo(const std::string& strFilenameAndPath, CVideoInfoTag& details, int idMVideo = -1, int getDetails = VideoDbDetailsAll);
+  /*! \brief Load the details which aren't part of a library listing for several items at once.
+   Library listings only carry the details stored with the item itself. The cast, tags, ratings
+   and unique ids of the given items are loaded with one query per media type instead of one per
+   item, e.g. for the items around the selected one of a list.
+   \param details the tags to load the details for, identified by their database id and media type
+   (and show id for episodes).
+   \param getDetails the VideoDbDetails to load, only cast, tag, rating and unique id are supported.
+   */
+  void GetDetailsForItems(std::vector<CVideoInfoTag>& details, int getDetails);
   bool GetSetInfo(int idSet, CVideoInfoTag& details, CFileItem* item = nullptr);
   bool GetFileInfo(const std::string& strFilenameAndPath, CVideoInfoTag& details, int idFile = -1);
 
@@ -1087,6 +1097,23 @@ public:
 
   // smart playlists and main retrieval work in these functions
   bool GetMoviesByWhere(const std::string& strBaseDir, const Filter &filter, CFileItemList& items, const SortDescription &sortDescription = SortDescription(), int getDetails = VideoDbDetailsNone);
+  /*!
+   \brief Get some fields of movies without creating a CFileItem for every movie.
+   \param strBaseDir the videodb:// url of the movies.
+   \param filter additional filter for the movies.
+   \param fields the fields to get, FieldId is always included.
+   \param results the fields of the movies in the requested order.
+   \param total the number of movies without the limits of the sort description.
+   \param sortDescription the sorting and limits to apply.
+   \return false on error, or if the movies have to be checked against locked sources or the url
+   lists versions or extras and GetMoviesByWhere() has to be used instead.
+   */
+  bool GetMoviesByWhere(const std::string& strBaseDir,
+                        const Filter& filter,
+                        FieldList fields,
+                        CDatabaseColumns& results,
+                        int& total,
+                        const SortDescription& sortDescription = SortDescription());
   bool GetSetsByWhere(const std::string& strBaseDir, const Filter &filter, CFileItemList& items, bool ignoreSingleMovieSets = false);
   bool GetTvShowsByWhere(const std::string& strBaseDir, const Filter &filter, CFileItemList& items, const SortDescription &sortDescription = SortDescription(), int getDetails = VideoDbDetailsNone);
   bool GetSeasonsByWhere(const std::string& strBaseDir, const Filter &filter, CFileItemList& items, bool appendFullShowPath = true, const SortDescription &sortDescription = SortDescription());
@@ -1449,6 +1476,23 @@ private:
    */
   int RunQuery(const std::string &sql);
 
+  /*! \brief Search titles on the main dataset, using the full text index if there is one.
+   Titles containing the search in the middle of a word are only found if no title has a word
+   starting with it.
+   \param query the SQL selecting the titles.
+   \param index the full text index of the titles.
+   \param keyField the (qualified) field of the query holding the key of the indexed table.
+   \param search the search as entered by the user.
+   \param like the condition matching the titles without the index.
+   \param sql [out] the SQL which was run.
+   */
+  void QueryByName(const std::string& query,
+                   const FullTextIndex& index,
+                   const std::string& keyField,
+                   const std::string& search,
+                   const std::string& like,
+                   std::string& sql);
+
   void AppendIdLinkFilter(const char* field,
                           const char* table,
                           const MediaType& mediaType,
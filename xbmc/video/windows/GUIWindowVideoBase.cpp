@@ -52,6 +52,7 @@
 #include "utils/FileExtensionProvider.h"
 #include "utils/FileUtils.h"
 #include "utils/GroupUtils.h"
+#include "utils/JobManager.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 #include "utils/Variant.h"
@@ -69,6 +70,7 @@
 #include "video/guilib/VideoSelectActionProcessor.h"
 #include "view/GUIViewState.h"
 
+#include <algorithm>
 #include <memory>
 
 using namespace XFILE;
@@ -88,6 +90,15 @@ using namespace KODI::MESSAGING;
 #define PROPERTY_GROUP_BY           "group.by"
 #define PROPERTY_GROUP_MIXED        "group.mixed"
 
+namespace
+{
+// the details missing from library listings which are loaded for the items around the selected one
+constexpr int PREFETCH_DETAILS =
+    VideoDbDetailsCast | VideoDbDetailsTag | VideoDbDetailsRating | VideoDbDetailsUniqueID;
+// how many items before and after the selected one to prefetch the details for
+constexpr int PREFETCH_WINDOW = 25;
+} // unnamed namespace
+
 CGUIWindowVideoBase::CGUIWindowVideoBase(int id, const std::string &xmlFile)
     : CGUIMediaWindow(id, xmlFile.c_str())
 {
@@ -1106,6 +1117,8 @@ bool CGUIWindowVideoBase::Update(const std::string &strDirectory, bool updateFil
   if (m_thumbLoader.IsLoading())
     m_thumbLoader.StopThread();
 
+  m_prefetchedItem = -1;
+
   if (!CGUIMediaWindow::Update(strDirectory, updateFilterPath))
     return false;
 
@@ -1116,6 +1129,99 @@ bool CGUIWindowVideoBase::Update(const std::string &strDirectory, bool updateFil
   return true;
 }
 
+void CGUIWindowVideoBase::FrameMove()
+{
+  ApplyPrefetchedDetails();
+  PrefetchDetails();
+
+  CGUIMediaWindow::FrameMove();
+}
+
+void CGUIWindowVideoBase::PrefetchDetails()
+{
+  // one batch at a time
+  if (m_prefetchedDetails)
+    return;
+
+  const int selected = m_viewControl.GetSelectedItem();
+  if (selected < 0 || selected == m_prefetchedItem || selected >= m_vecItems->Size())
+    return;
+  m_prefetchedItem = selected;
+
+  auto prefetch = std::make_shared<PrefetchedDetails>();
+  const int last = std::min(m_vecItems->Size() - 1, selected + PREFETCH_WINDOW);
+  for (int i = std::max(0, selected - PREFETCH_WINDOW); i <= last; ++i)
+  {
+    const std::shared_ptr<CFileItem> item = m_vecItems->Get(i);
+    if (!item->HasVideoInfoTag())
+      continue;
+
+    const CVideoInfoTag& tag = *item->GetVideoInfoTag();
+    if (tag.m_iDbId <= 0 || (tag.m_parsedDetails & PREFETCH_DETAILS) == PREFETCH_DETAILS ||
+        (tag.m_type != MediaTypeMovie && tag.m_type != MediaTypeTvShow &&
+         tag.m_type != MediaTypeEpisode && tag.m_type != MediaTypeMusicVideo))
+      continue;
+
+    // the job works on tags of its own so that the items are only changed by the GUI thread
+    CVideoInfoTag details;
+    details.m_iDbId = tag.m_iDbId;
+    details.m_type = tag.m_type;
+    details.m_iIdShow = tag.m_iIdShow;
+    prefetch->details.emplace_back(std::move(details));
+    prefetch->items.emplace_back(item);
+  }
+
+  if (prefetch->items.empty())
+    return;
+
+  m_prefetchedDetails = prefetch;
+  CServiceBroker::GetJobManager()->Submit(
+      [prefetch]()
+      {
+        CVideoDatabase database;
+        if (database.Open())
+        {
+          database.GetDetailsForItems(prefetch->details, PREFETCH_DETAILS);
+          database.Close();
+        }
+        prefetch->done = true;
+      });
+}
+
+void CGUIWindowVideoBase::ApplyPrefetchedDetails()
+{
+  if (!m_prefetchedDetails || !m_prefetchedDetails->done)
+    return;
+
+  for (size_t i = 0; i < m_prefetchedDetails->items.size(); ++i)
+  {
+    CVideoInfoTag& details = m_prefetchedDetails->details[i];
+    if ((details.m_parsedDetails & PREFETCH_DETAILS) == 0)
+      continue;
+
+    const std::shared_ptr<CFileItem>& item = m_prefetchedDetails->items[i];
+    CVideoInfoTag& tag = *item->GetVideoInfoTag();
+    if ((tag.m_parsedDetails & VideoDbDetailsCast) == 0)
+      tag.m_cast = std::move(details.m_cast);
+    if ((tag.m_parsedDetails & VideoDbDetailsTag) == 0)
+      tag.m_tags = std::move(details.m_tags);
+    if ((tag.m_parsedDetails & VideoDbDetailsRating) == 0)
+    {
+      for (const auto& [type, rating] : details.m_ratings)
+        tag.m_ratings[type] = rating;
+    }
+    if ((tag.m_parsedDetails & VideoDbDetailsUniqueID) == 0)
+    {
+      for (const auto& [type, uniqueID] : details.GetUniqueIDs())
+        tag.SetUniqueID(uniqueID, type);
+    }
+    tag.m_parsedDetails |= details.m_parsedDetails;
+    item->SetInvalid();
+  }
+
+  m_prefetchedDetails.reset();
+}
+
 bool CGUIWindowVideoBase::GetDirectory(const std::string &strDirectory, CFileItemList &items)
 {
   bool bResult = CGUIMediaWindow::GetDirectory(strDirectory, items);
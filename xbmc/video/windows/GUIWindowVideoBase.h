@@ -13,6 +13,10 @@
 #include "video/VideoThumbLoader.h"
 #include "windows/GUIMediaWindow.h"
 
+#include <atomic>
+#include <memory>
+#include <vector>
+
 class CGUIWindowVideoBase : public CGUIMediaWindow, public IBackgroundLoaderObserver
 {
 public:
@@ -21,6 +25,7 @@ public:
   bool OnMessage(CGUIMessage& message) override;
   bool OnAction(const CAction &action) override;
   bool OnPopupMenu(int iItem) override;
+  void FrameMove() override;
 
   /*! \brief Gets called to process the "info" action for the given file item
    Default implementation shows a dialog containing information for the movie/episode/...
@@ -137,4 +142,23 @@ private:
    */
   ShowInfoResult ShowInfo(const std::shared_ptr<CFileItem>& item,
                           const std::shared_ptr<ADDON::CScraper>& content);
+
+  /*!
+   \brief Load the details which library listings don't carry (cast, tags, ratings and unique ids)
+   for the items around the selected one in the background.
+   */
+  void PrefetchDetails();
+  /*!
+   \brief Move the details loaded by PrefetchDetails() into the items once they are available.
+   */
+  void ApplyPrefetchedDetails();
+
+  struct PrefetchedDetails
+  {
+    std::vector<std::shared_ptr<CFileItem>> items;
+    std::vector<CVideoInfoTag> details; ///< written by the job only, one per item
+    std::atomic<bool> done{false};
+  };
+  std::shared_ptr<PrefetchedDetails> m_prefetchedDetails;
+  int m_prefetchedItem{-1}; ///< the selected item the details were last prefetched around
 };
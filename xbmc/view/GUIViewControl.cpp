@@ -124,10 +124,18 @@ void CGUIViewControl::SetItems(CFileItemList &items)
 {
   //  CLog::Log(LOGDEBUG,"SetItems: {}", m_currentView);
   m_fileItems = &items;
+  m_preview = false;
   // update our current view control...
   UpdateView();
 }
 
+void CGUIViewControl::SetPreviewItems(CFileItemList& items)
+{
+  m_fileItems = &items;
+  m_preview = true;
+  UpdateView();
+}
+
 void CGUIViewControl::UpdateContents(const CGUIControl *control, int currentItem) const
 {
   if (!control || !m_fileItems) return;
@@ -167,12 +175,15 @@ int CGUIViewControl::GetSelectedItem() const
   if (m_currentView < 0 || m_currentView >= (int)m_visibleViews.size())
     return -1; // no valid current view!
 
+  if (m_preview)
+    return -1;
+
   return GetSelectedItem(m_visibleViews[m_currentView]);
 }
 
 std::string CGUIViewControl::GetSelectedItemPath() const
 {
-  if (m_currentView < 0 || (size_t)m_currentView >= m_visibleViews.size())
+  if (m_currentView < 0 || (size_t)m_currentView >= m_visibleViews.size() || m_preview)
     return "";
 
   int selectedItem = GetSelectedItem(m_visibleViews[m_currentView]);
@@ -30,6 +30,12 @@ public:
   void SetCurrentView(int viewMode, bool bRefresh = false);
 
   void SetItems(CFileItemList &items);
+  /*!
+   \brief Show items which aren't the items of the window yet, e.g. while a directory is listed.
+   No item is selected until SetItems() is called, so actions of the window don't pick an item
+   of the wrong list.
+   */
+  void SetPreviewItems(CFileItemList& items);
 
   void SetSelectedItem(int item);
   void SetSelectedItem(const std::string &itemPath);
@@ -61,6 +67,7 @@ protected:
   typedef std::vector<CGUIControl*>::const_iterator ciViews;
 
   CFileItemList* m_fileItems;
+  bool m_preview = false;
   int m_viewAsControl;
   int m_parentWindow;
   int m_currentView;
@@ -31,46 +31,98 @@
 
 using KODI::UTILS::COLOR::Color;
 
+namespace
+{
+// the transform state of the calling thread if it doesn't use the one of the context
+thread_local CGraphicContext::TransformState* t_transformState = nullptr;
+// whether the calling thread processes controls in parallel with other threads
+thread_local bool t_processing = false;
+} // unnamed namespace
+
 CGraphicContext::CGraphicContext() = default;
 CGraphicContext::~CGraphicContext() = default;
 
+void CGraphicContext::SetThreadTransformState(TransformState* state)
+{
+  t_transformState = state;
+}
+
+void CGraphicContext::lock()
+{
+  if (t_processing)
+    m_processingSection.lock();
+  else
+    CCriticalSection::lock();
+}
+
+bool CGraphicContext::try_lock()
+{
+  return t_processing ? m_processingSection.try_lock() : CCriticalSection::try_lock();
+}
+
+void CGraphicContext::unlock()
+{
+  if (t_processing)
+    m_processingSection.unlock();
+  else
+    CCriticalSection::unlock();
+}
+
+void CGraphicContext::SetThreadProcessing(bool processing)
+{
+  t_processing = processing;
+}
+
+CGraphicContext::TransformState& CGraphicContext::State()
+{
+  return t_transformState ? *t_transformState : m_state;
+}
+
+const CGraphicContext::TransformState& CGraphicContext::State() const
+{
+  return t_transformState ? *t_transformState : m_state;
+}
+
 void CGraphicContext::SetOrigin(float x, float y)
 {
-  if (!m_origins.empty())
-    m_origins.push(CPoint(x,y) + m_origins.top());
+  TransformState& state = State();
+  if (!state.origins.empty())
+    state.origins.push(CPoint(x,y) + state.origins.top());
   else
-    m_origins.emplace(x, y);
+    state.origins.emplace(x, y);
 
   AddTransform(TransformMatrix::CreateTranslation(x, y));
 }
 
 void CGraphicContext::RestoreOrigin()
 {
-  if (!m_origins.empty())
-    m_origins.pop();
+  TransformState& state = State();
+  if (!state.origins.empty())
+    state.origins.pop();
   RemoveTransform();
 }
 
 // add a new clip region, intersecting with the previous clip region.
 bool CGraphicContext::SetClipRegion(float x, float y, float w, float h)
 { // transform from our origin
+  TransformState& state = State();
   CPoint origin;
-  if (!m_origins.empty())
-    origin = m_origins.top();
+  if (!state.origins.empty())
+    origin = state.origins.top();
 
   // ok, now intersect with our old clip region
   CRect rect(x, y, x + w, y + h);
   rect += origin;
-  if (!m_clipRegions.empty())
+  if (!state.clipRegions.empty())
   {
     // intersect with original clip region
-    rect.Intersect(m_clipRegions.top());
+    rect.Intersect(state.clipRegions.top());
   }
 
   if (rect.IsEmpty())
     return false;
 
-  m_clipRegions.push(rect);
+  state.clipRegions.push(rect);
 
   // here we could set the hardware clipping, if applicable
   return true;
@@ -78,23 +130,25 @@ bool CGraphicContext::SetClipRegion(float x, float y, float w, float h)
 
 void CGraphicContext::RestoreClipRegion()
 {
-  if (!m_clipRegions.empty())
-    m_clipRegions.pop();
+  TransformState& state = State();
+  if (!state.clipRegions.empty())
+    state.clipRegions.pop();
 
   // here we could reset the hardware clipping, if applicable
 }
 
 void CGraphicContext::ClipRect(CRect &vertex, CRect &texture, CRect *texture2)
 {
+  TransformState& state = State();
   // this is the software clipping routine.  If the graphics hardware is set to do the clipping
   // (eg via SetClipPlane in D3D for instance) then this routine is unneeded.
-  if (!m_clipRegions.empty())
+  if (!state.clipRegions.empty())
   {
     // take a copy of the vertex rectangle and intersect
     // it with our clip region (moved to the same coordinate system)
-    CRect clipRegion(m_clipRegions.top());
-    if (!m_origins.empty())
-      clipRegion -= m_origins.top();
+    CRect clipRegion(state.clipRegions.top());
+    if (!state.origins.empty())
+      clipRegion -= state.origins.top();
     CRect original(vertex);
     vertex.Intersect(clipRegion);
     // and use the original to compute the texture coordinates
@@ -121,52 +175,59 @@ void CGraphicContext::ClipRect(CRect &vertex, CRect &texture, CRect *texture2)
 
 CRect CGraphicContext::GetClipRegion()
 {
-  if (m_clipRegions.empty())
+  TransformState& state = State();
+  if (state.clipRegions.empty())
     return CRect(0, 0, m_iScreenWidth, m_iScreenHeight);
-  CRect clipRegion(m_clipRegions.top());
-  if (!m_origins.empty())
-    clipRegion -= m_origins.top();
+  CRect clipRegion(state.clipRegions.top());
+  if (!state.origins.empty())
+    clipRegion -= state.origins.top();
   return clipRegion;
 }
 
 void CGraphicContext::AddGUITransform()
 {
-  m_transforms.push(m_finalTransform);
-  m_finalTransform = m_guiTransform;
+  TransformState& state = State();
+  state.transforms.push(state.finalTransform);
+  state.finalTransform = m_guiTransform;
 }
 
 TransformMatrix CGraphicContext::AddTransform(const TransformMatrix &matrix)
 {
-  m_transforms.push(m_finalTransform);
-  m_finalTransform.matrix *= matrix;
-  return m_finalTransform.matrix;
+  TransformState& state = State();
+  state.transforms.push(state.finalTransform);
+  state.finalTransform.matrix *= matrix;
+  return state.finalTransform.matrix;
 }
 
 void CGraphicContext::SetTransform(const TransformMatrix &matrix)
 {
-  m_transforms.push(m_finalTransform);
-  m_finalTransform.matrix = matrix;
+  TransformState& state = State();
+  state.transforms.push(state.finalTransform);
+  state.finalTransform.matrix = matrix;
 }
 
 void CGraphicContext::SetTransform(const TransformMatrix &matrix, float scaleX, float scaleY)
 {
-  m_transforms.push(m_finalTransform);
-  m_finalTransform.matrix = matrix;
-  m_finalTransform.scaleX = scaleX;
-  m_finalTransform.scaleY = scaleY;
+  TransformState& state = State();
+  state.transforms.push(state.finalTransform);
+  state.finalTransform.matrix = matrix;
+  state.finalTransform.scaleX = scaleX;
+  state.finalTransform.scaleY = scaleY;
 }
 
 void CGraphicContext::RemoveTransform()
 {
-  if (!m_transforms.empty())
+  TransformState& state = State();
+  if (!state.transforms.empty())
   {
-    m_finalTransform = m_transforms.top();
-    m_transforms.pop();
+    state.finalTransform = state.transforms.top();
+    state.transforms.pop();
   }
 }
 
 bool CGraphicContext::SetViewPort(float fx, float fy, float fwidth, float fheight, bool intersectPrevious /* = false */)
 {
+  TransformState& state = State();
   // transform coordinates - we may have a rotation which changes the positioning of the
   // minimal and maximal viewport extents.  We currently go to the maximal extent.
   float x[4], y[4];
@@ -234,19 +295,20 @@ bool CGraphicContext::SetViewPort(float fx, float fy, float fwidth, float fheigh
   CServiceBroker::GetRenderSystem()->SetViewPort(newviewport);
 
 
-  UpdateCameraPosition(m_cameras.top(), m_stereoFactors.top());
+  UpdateCameraPosition(state.cameras.top(), state.stereoFactors.top());
   return true;
 }
 
 void CGraphicContext::RestoreViewPort()
 {
+  TransformState& state = State();
   if (m_viewStack.size() <= 1) return;
 
   m_viewStack.pop();
   CRect viewport = StereoCorrection(m_viewStack.top());
   CServiceBroker::GetRenderSystem()->SetViewPort(viewport);
 
-  UpdateCameraPosition(m_cameras.top(), m_stereoFactors.top());
+  UpdateCameraPosition(state.cameras.top(), state.stereoFactors.top());
 }
 
 CPoint CGraphicContext::StereoCorrection(const CPoint &point) const
@@ -714,6 +776,7 @@ void CGraphicContext::GetGUIScaling(const RESOLUTION_INFO &res, float &scaleX, f
 
 void CGraphicContext::SetScalingResolution(const RESOLUTION_INFO &res, bool needsScaling)
 {
+  TransformState& state = State();
   m_windowResolution = res;
   if (needsScaling && m_Resolution != RES_INVALID)
     GetGUIScaling(res, m_guiTransform.scaleX, m_guiTransform.scaleY, &m_guiTransform.matrix);
@@ -723,26 +786,27 @@ void CGraphicContext::SetScalingResolution(const RESOLUTION_INFO &res, bool need
   }
 
   // reset our origin and camera
-  while (!m_origins.empty())
-    m_origins.pop();
-  m_origins.emplace(.0f, .0f);
-  while (!m_cameras.empty())
-    m_cameras.pop();
-  m_cameras.emplace(0.5f * m_iScreenWidth, 0.5f * m_iScreenHeight);
-  while (!m_stereoFactors.empty())
-    m_stereoFactors.pop();
-  m_stereoFactors.push(0.0f);
+  while (!state.origins.empty())
+    state.origins.pop();
+  state.origins.emplace(.0f, .0f);
+  while (!state.cameras.empty())
+    state.cameras.pop();
+  state.cameras.emplace(0.5f * m_iScreenWidth, 0.5f * m_iScreenHeight);
+  while (!state.stereoFactors.empty())
+    state.stereoFactors.pop();
+  state.stereoFactors.push(0.0f);
 
   // and reset the final transform
-  m_finalTransform = m_guiTransform;
+  state.finalTransform = m_guiTransform;
 }
 
 void CGraphicContext::SetRenderingResolution(const RESOLUTION_INFO &res, bool needsScaling)
 {
+  TransformState& state = State();
   std::unique_lock lock(*this);
 
   SetScalingResolution(res, needsScaling);
-  UpdateCameraPosition(m_cameras.top(), m_stereoFactors.top());
+  UpdateCameraPosition(state.cameras.top(), state.stereoFactors.top());
 }
 
 void CGraphicContext::SetStereoView(RENDER_STEREO_VIEW view)
@@ -764,69 +828,74 @@ void CGraphicContext::SetStereoView(RENDER_STEREO_VIEW view)
 
 void CGraphicContext::InvertFinalCoords(float &x, float &y) const
 {
-  m_finalTransform.matrix.InverseTransformPosition(x, y);
+  State().finalTransform.matrix.InverseTransformPosition(x, y);
 }
 
 float CGraphicContext::ScaleFinalXCoord(float x, float y) const
 {
-  return m_finalTransform.matrix.TransformXCoord(x, y, 0);
+  return State().finalTransform.matrix.TransformXCoord(x, y, 0);
 }
 
 float CGraphicContext::ScaleFinalYCoord(float x, float y) const
 {
-  return m_finalTransform.matrix.TransformYCoord(x, y, 0);
+  return State().finalTransform.matrix.TransformYCoord(x, y, 0);
 }
 
 float CGraphicContext::ScaleFinalZCoord(float x, float y) const
 {
-  return m_finalTransform.matrix.TransformZCoord(x, y, 0);
+  return State().finalTransform.matrix.TransformZCoord(x, y, 0);
 }
 
 void CGraphicContext::ScaleFinalCoords(float &x, float &y, float &z) const
 {
-  m_finalTransform.matrix.TransformPosition(x, y, z);
+  State().finalTransform.matrix.TransformPosition(x, y, z);
 }
 
 float CGraphicContext::GetScalingPixelRatio() const
 {
+  const TransformState& state = State();
   // assume the resolutions are different - we want to return the aspect ratio of the video resolution
   // but only once it's been corrected for the skin -> screen coordinates scaling
-  return GetResInfo().fPixelRatio * (m_finalTransform.scaleY / m_finalTransform.scaleX);
+  return GetResInfo().fPixelRatio * (state.finalTransform.scaleY / state.finalTransform.scaleX);
 }
 
 void CGraphicContext::SetCameraPosition(const CPoint &camera)
 {
+  TransformState& state = State();
   // offset the camera from our current location (this is in XML coordinates) and scale it up to
   // the screen resolution
   CPoint cam(camera);
-  if (!m_origins.empty())
-    cam += m_origins.top();
+  if (!state.origins.empty())
+    cam += state.origins.top();
 
   cam.x *= (float)m_iScreenWidth / m_windowResolution.iWidth;
   cam.y *= (float)m_iScreenHeight / m_windowResolution.iHeight;
 
-  m_cameras.push(cam);
-  UpdateCameraPosition(m_cameras.top(), m_stereoFactors.top());
+  state.cameras.push(cam);
+  UpdateCameraPosition(state.cameras.top(), state.stereoFactors.top());
 }
 
 void CGraphicContext::RestoreCameraPosition()
 { // remove the top camera from the stack
-  assert(m_cameras.size());
-  m_cameras.pop();
-  UpdateCameraPosition(m_cameras.top(), m_stereoFactors.top());
+  TransformState& state = State();
+  assert(state.cameras.size());
+  state.cameras.pop();
+  UpdateCameraPosition(state.cameras.top(), state.stereoFactors.top());
 }
 
 void CGraphicContext::SetStereoFactor(float factor)
 {
-  m_stereoFactors.push(factor);
-  UpdateCameraPosition(m_cameras.top(), m_stereoFactors.top());
+  TransformState& state = State();
+  state.stereoFactors.push(factor);
+  UpdateCameraPosition(state.cameras.top(), state.stereoFactors.top());
 }
 
 void CGraphicContext::RestoreStereoFactor()
 { // remove the top factor from the stack
-  assert(m_stereoFactors.size());
-  m_stereoFactors.pop();
-  UpdateCameraPosition(m_cameras.top(), m_stereoFactors.top());
+  TransformState& state = State();
+  assert(state.stereoFactors.size());
+  state.stereoFactors.pop();
+  UpdateCameraPosition(state.cameras.top(), state.stereoFactors.top());
 }
 
 float CGraphicContext::GetNormalizedDepth(uint32_t depth)
@@ -839,7 +908,7 @@ float CGraphicContext::GetNormalizedDepth(uint32_t depth)
 
 float CGraphicContext::GetTransformDepth(int32_t depthOffset)
 {
-  float depth = static_cast<float>(m_finalTransform.matrix.depth + depthOffset);
+  float depth = static_cast<float>(State().finalTransform.matrix.depth + depthOffset);
   depth /= m_layer;
   depth = depth * 2 - 1;
   return depth;
@@ -887,6 +956,10 @@ CRect CGraphicContext::GenerateAABB(const CRect &rect) const
 //       to cut down on one setting)
 void CGraphicContext::UpdateCameraPosition(const CPoint &camera, const float &factor)
 {
+  // the render system is only set up for the state of the context
+  if (t_transformState)
+    return;
+
   float stereoFactor = 0.f;
   if ( m_stereoMode != RENDER_STEREO_MODE_OFF
     && m_stereoMode != RENDER_STEREO_MODE_MONO
@@ -903,37 +976,38 @@ void CGraphicContext::UpdateCameraPosition(const CPoint &camera, const float &fa
 
 bool CGraphicContext::RectIsAngled(float x1, float y1, float x2, float y2) const
 { // need only test 3 points, as they must be co-planer
-  if (m_finalTransform.matrix.TransformZCoord(x1, y1, 0)) return true;
-  if (m_finalTransform.matrix.TransformZCoord(x2, y2, 0)) return true;
-  if (m_finalTransform.matrix.TransformZCoord(x1, y2, 0)) return true;
+  const TransformState& state = State();
+  if (state.finalTransform.matrix.TransformZCoord(x1, y1, 0)) return true;
+  if (state.finalTransform.matrix.TransformZCoord(x2, y2, 0)) return true;
+  if (state.finalTransform.matrix.TransformZCoord(x1, y2, 0)) return true;
   return false;
 }
 
 const TransformMatrix &CGraphicContext::GetGUIMatrix() const
 {
-  return m_finalTransform.matrix;
+  return State().finalTransform.matrix;
 }
 
 float CGraphicContext::GetGUIScaleX() const
 {
-  return m_finalTransform.scaleX;
+  return State().finalTransform.scaleX;
 }
 
 float CGraphicContext::GetGUIScaleY() const
 {
-  return m_finalTransform.scaleY;
+  return State().finalTransform.scaleY;
 }
 
 Color CGraphicContext::MergeAlpha(Color color) const
 {
-  Color alpha = m_finalTransform.matrix.TransformAlpha((color >> 24) & 0xff);
+  Color alpha = State().finalTransform.matrix.TransformAlpha((color >> 24) & 0xff);
   if (alpha > 255) alpha = 255;
   return ((alpha << 24) & 0xff000000) | (color & 0xffffff);
 }
 
 Color CGraphicContext::MergeColor(Color color) const
 {
-  return m_finalTransform.matrix.TransformColor(color);
+  return State().finalTransform.matrix.TransformColor(color);
 }
 
 int CGraphicContext::GetWidth() const
@@ -67,6 +67,41 @@ enum RENDER_ORDER
 class CGraphicContext : public CCriticalSection
 {
 public:
+  class UITransform
+  {
+  public:
+    UITransform() : matrix() {}
+    UITransform(const TransformMatrix& m, const float sX = 1.0f, const float sY = 1.0f)
+      : matrix(m), scaleX(sX), scaleY(sY)
+    {
+    }
+    void Reset()
+    {
+      matrix.Reset();
+      scaleX = scaleY = 1.0f;
+    }
+
+    TransformMatrix matrix;
+    float scaleX = 1.0f;
+    float scaleY = 1.0f;
+  };
+
+  /*!
+   \brief The transforms, origins, clip regions and cameras pushed by the controls.
+
+   The state can be replaced for a thread, so that controls can be processed on other threads than
+   the render thread, see SetThreadTransformState().
+   */
+  struct TransformState
+  {
+    std::stack<CPoint> cameras;
+    std::stack<CPoint> origins;
+    std::stack<CRect> clipRegions;
+    std::stack<float> stereoFactors;
+    UITransform finalTransform;
+    std::stack<UITransform> transforms;
+  };
+
   CGraphicContext(void);
   virtual ~CGraphicContext();
 
@@ -224,7 +259,40 @@ public:
   void SetTransferPQ(bool PQ) { m_isTransferPQ = PQ; }
   bool IsTransferPQ() const { return m_isTransferPQ; }
 
+  /*!
+   \brief Get a copy of the transform state of the calling thread.
+   */
+  TransformState GetTransformState() const { return State(); }
+
+  /*!
+   \brief Use a state of its own for the transforms of the calling thread.
+
+   The camera of the render system is not updated for such a state, so controls with a camera
+   can't be processed with it.
+   \param state the state to use or nullptr to use the state of the context again.
+   */
+  static void SetThreadTransformState(TransformState* state);
+
+  /*!
+   \brief Lock the context.
+
+   While controls are processed in parallel, the thread that started the processing keeps the
+   context locked, so that other threads can't get in until all controls are processed. The threads
+   processing the controls lock a section of their own instead, see SetThreadProcessing().
+   */
+  void lock();
+  bool try_lock();
+  void unlock();
+
+  /*!
+   \brief Mark the calling thread as processing controls in parallel with other threads.
+   \param processing true while the thread processes controls.
+   */
+  static void SetThreadProcessing(bool processing);
+
 protected:
+  TransformState& State();
+  const TransformState& State() const;
 
   void UpdateCameraPosition(const CPoint &camera, const float &factor);
   void SetVideoResolutionInternal(RESOLUTION res, bool forceUpdate);
@@ -242,35 +310,13 @@ protected:
   float m_fFPSOverride = 0.0f;
 
   RESOLUTION_INFO m_windowResolution;
-  std::stack<CPoint> m_cameras;
-  std::stack<CPoint> m_origins;
-  std::stack<CRect> m_clipRegions;
-  std::stack<float> m_stereoFactors;
   std::stack<CRect> m_viewStack;
   CRect m_scissors;
 
-  class UITransform
-  {
-  public:
-    UITransform() : matrix() {}
-    UITransform(const TransformMatrix& m, const float sX = 1.0f, const float sY = 1.0f)
-      : matrix(m), scaleX(sX), scaleY(sY)
-    {
-    }
-    void Reset()
-    {
-      matrix.Reset();
-      scaleX = scaleY = 1.0f;
-    }
-
-    TransformMatrix matrix;
-    float scaleX = 1.0f;
-    float scaleY = 1.0f;
-  };
-
   UITransform m_guiTransform;
-  UITransform m_finalTransform;
-  std::stack<UITransform> m_transforms;
+  TransformState m_state;
+  // locked instead of the context by the threads processing controls in parallel
+  CCriticalSection m_processingSection;
   RENDER_STEREO_VIEW m_stereoView = RENDER_STEREO_VIEW_OFF;
   RENDER_STEREO_MODE m_stereoMode = RENDER_STEREO_MODE_OFF;
   RENDER_STEREO_MODE m_nextStereoMode = RENDER_STEREO_MODE_OFF;
@@ -120,6 +120,7 @@ CGUIMediaWindow::CGUIMediaWindow(int id, const char *xmlFile)
   m_loadType = KEEP_IN_MEMORY;
   m_vecItems = new CFileItemList;
   m_unfilteredItems = new CFileItemList;
+  m_previewItems = new CFileItemList;
   m_vecItems->SetPath("?");
   m_iLastControl = -1;
   m_canFilterAdvanced = false;
@@ -131,6 +132,7 @@ CGUIMediaWindow::~CGUIMediaWindow()
 {
   delete m_vecItems;
   delete m_unfilteredItems;
+  delete m_previewItems;
 }
 
 bool CGUIMediaWindow::Load(TiXmlElement *pRootElement)
@@ -334,6 +336,14 @@ bool CGUIMediaWindow::OnMessage(CGUIMessage& message)
     }
     break;
 
+  case GUI_MSG_DIRECTORY_ITEMS:
+    {
+      const auto batch = std::static_pointer_cast<CFileItemList>(message.GetItem());
+      if (batch)
+        OnDirectoryItems(message.GetStringParam(), *batch);
+      return true;
+    }
+
   case GUI_MSG_NOTIFY_ALL:
     { // Message is received even if this window is inactive
       if (message.GetParam1() == GUI_MSG_WINDOW_RESET)
@@ -949,6 +959,9 @@ bool CGUIMediaWindow::Update(const std::string &strDirectory, bool updateFilterP
   OnFilterItems(GetProperty("filter").asString());
   UpdateButtons();
 
+  // the final listing is shown now
+  m_previewItems->Clear();
+
   // Restore selected item from history
   RestoreSelectedItemFromHistory();
 
@@ -2210,6 +2223,24 @@ bool CGUIMediaWindow::GetDirectoryItems(CURL &url, CFileItemList &items, bool us
   if (m_backgroundLoad)
   {
     bool ret = true;
+
+    // show the items of slow directories while they're still being listed
+    const std::string path = url.Get();
+    const int windowId = GetID();
+    m_previewItems->Clear();
+    m_previewPath = path;
+    m_rootDir.SetItemsCallback(
+        [path, windowId](const CFileItemList& batch)
+        {
+          auto items = std::make_shared<CFileItemList>(path);
+          items->Append(batch);
+          CGUIMessage msg(GUI_MSG_DIRECTORY_ITEMS, windowId, 0);
+          msg.SetStringParam(path);
+          msg.SetItem(items);
+          CServiceBroker::GetGUI()->GetWindowManager().SendThreadMessage(msg, windowId);
+          return true;
+        });
+
     CGetDirectoryItems getItems(m_rootDir, url, items, useDir);
 
     if (!WaitGetDirectoryItems(getItems))
@@ -2231,7 +2262,10 @@ bool CGUIMediaWindow::GetDirectoryItems(CURL &url, CFileItemList &items, bool us
     }
 
     m_updateJobActive = false;
+    m_rootDir.SetItemsCallback(nullptr);
     m_rootDir.ReleaseDirImpl();
+    // batches still in the message queue are outdated now
+    m_previewPath.clear();
     return ret;
   }
   else
@@ -2285,6 +2319,23 @@ bool CGUIMediaWindow::WaitGetDirectoryItems(CGetDirectoryItems &items)
   return ret;
 }
 
+void CGUIMediaWindow::OnDirectoryItems(const std::string& path, const CFileItemList& batch)
+{
+  if (m_previewPath.empty() || path != m_previewPath || !IsActive())
+    return;
+
+  // only format and sort the new items and merge them into the ones already shown, so the preview
+  // is always in order
+  CFileItemList items(path);
+  items.Append(batch);
+  FormatAndSort(items);
+
+  m_previewItems->SetPath(path);
+  m_previewItems->Merge(items);
+  // the items of the window are still the ones of the previous directory, so none can be selected
+  m_viewControl.SetPreviewItems(*m_previewItems);
+}
+
 void CGUIMediaWindow::CancelUpdateItems()
 {
   if (m_updateJobActive)
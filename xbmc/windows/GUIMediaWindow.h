@@ -165,6 +165,11 @@ protected:
   bool GetDirectoryItems(CURL &url, CFileItemList &items, bool useDir);
   bool WaitGetDirectoryItems(CGetDirectoryItems &items);
   void CancelUpdateItems();
+  /*! \brief Show a batch of items of the directory that is still being loaded in the background
+   \param path the path of the directory being loaded
+   \param batch the items to add to the preview
+   */
+  void OnDirectoryItems(const std::string& path, const CFileItemList& batch);
 
   /*! \brief Translate the folder to start in from the given quick path
    \param url the folder the user wants
@@ -186,6 +191,8 @@ protected:
   // current path and history
   CFileItemList* m_vecItems;
   CFileItemList* m_unfilteredItems;        ///< \brief items prior to filtering using FilterItems()
+  CFileItemList* m_previewItems;           ///< \brief items shown while a slow directory is loading
+  std::string m_previewPath;               ///< \brief path of the directory being previewed
   CDirectoryHistory m_history;
   std::unique_ptr<CGUIViewState> m_guiState;
   std::atomic_bool m_vecItemsUpdating = {false};
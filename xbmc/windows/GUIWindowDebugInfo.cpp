@@ -17,9 +17,12 @@
 #include "guilib/GUIControlFactory.h"
 #include "guilib/GUIControlProfiler.h"
 #include "guilib/GUIFontManager.h"
+#include "guilib/GUIFrameProfiler.h"
+#include "guilib/GUIQuadBatch.h"
 #include "guilib/GUITextLayout.h"
 #include "guilib/GUIWindowManager.h"
 #include "input/WindowTranslator.h"
+#include "rendering/RenderSystem.h"
 #include "settings/AdvancedSettings.h"
 #include "settings/SettingsComponent.h"
 #include "utils/CPUInfo.h"
@@ -129,6 +132,29 @@ void CGUIWindowDebugInfo::Process(unsigned int currentTime, CDirtyRegionList &di
                                    .GetFPS(),
                                strCores, ucAppName, dCPU, profiling);
 #endif
+
+    const CGUIQuadBatch* quadBatch = CServiceBroker::GetRenderSystem()->GetQuadBatch();
+    if (quadBatch && quadBatch->IsEnabled())
+    {
+      const CGUIQuadBatch::Stats& stats = quadBatch->GetFrameStats();
+      info += StringUtils::Format("\nGUI: {} draw calls - {} textures - {} vertices",
+                                  stats.drawCalls, stats.textures, stats.vertices);
+    }
+
+    const CGUIFrameProfiler::Stats frames = CGUIFrameProfiler::Instance().GetStats();
+    if (frames.m_frames > 0)
+    {
+      const auto& phases = frames.m_phases;
+      info += StringUtils::Format(
+          "\nFRAME: {:.1f}/{:.1f}/{:.1f} ms (p50/p95/p99) - max {:.1f} ms\n"
+          "p95: process {:.1f} - render {:.1f} - dirty {:.1f} - upload {:.1f} - present {:.1f} ms",
+          frames.m_frame.m_p50, frames.m_frame.m_p95, frames.m_frame.m_p99, frames.m_frame.m_max,
+          phases[static_cast<size_t>(CGUIFrameProfiler::Phase::GUI_PROCESS)].m_p95,
+          phases[static_cast<size_t>(CGUIFrameProfiler::Phase::GUI_RENDER)].m_p95,
+          phases[static_cast<size_t>(CGUIFrameProfiler::Phase::DIRTY_REGIONS)].m_p95,
+          phases[static_cast<size_t>(CGUIFrameProfiler::Phase::TEXTURE_UPLOAD)].m_p95,
+          phases[static_cast<size_t>(CGUIFrameProfiler::Phase::PRESENT)].m_p95);
+    }
   }
 
   // render the skin debug info